@@ -71,6 +71,18 @@ static const char maximum_inference_rate_message[] =
     "If not specified, default value is 0, the inference will run at maximium rate depending on a device capabilities. "
     "Tweaking this value allow better accuracy in power usage measurement by limiting the execution.";
 
+/// @brief message for open-loop arrival rate
+static const char arrival_rate_message[] =
+    "Optional. Enables the open-loop mode: the requests are submitted at the given mean rate (requests per second) "
+    "independently of the completion of the previous ones, the waiting for an idle infer request is reported as the "
+    "queueing delay and is included into the latency. Requires async API.";
+
+/// @brief message for open-loop arrival process
+static const char arrival_message[] =
+    "Optional. Arrival process of the open-loop mode: \"poisson\" (default), \"constant\" or a path to a trace file "
+    "with an arrival time in milliseconds on every line. The trace is replayed cyclically and enables the open-loop "
+    "mode itself, -arrival_rate rescales it to the given mean rate.";
+
 /// @brief message for execution time
 static const char execution_time_message[] = "Optional. Time in seconds to execute topology.";
 
@@ -205,6 +217,12 @@ static const char report_type_message[] =
 // @brief message for report_folder option
 static const char report_folder_message[] = "Optional. Path to a folder where statistics report is stored.";
 
+// @brief message for latency_histogram option
+static const char latency_histogram_message[] =
+    "Optional. Path to a file where the latency histograms (p50/p90/p99/p99.9 and the buckets) of the latency "
+    "including the queueing delay and of the queueing delay itself are stored. JSON format is used for .json "
+    "extension, CSV otherwise.";
+
 // @brief message for json_stats option
 static const char json_stats_message[] = "Optional. Enables JSON-based statistics output (by default reporting system "
                                          "will use CSV format). Should be used together with -report_folder option.";
@@ -313,6 +331,12 @@ DEFINE_uint64(nireq, 0, infer_requests_count_message);
 /// @brief Execute infer requests at a fixed frequency
 DEFINE_double(max_irate, 0, maximum_inference_rate_message);
 
+/// @brief Mean rate of the open-loop requests submission
+DEFINE_double(arrival_rate, 0, arrival_rate_message);
+
+/// @brief Arrival process of the open-loop mode
+DEFINE_string(arrival, "poisson", arrival_message);
+
 /// @brief Number of streams to use for inference on the CPU (also affects Hetero cases)
 DEFINE_string(nstreams, "", infer_num_streams_message);
 
@@ -359,6 +383,9 @@ DEFINE_string(report_type, "", report_type_message);
 /// @brief Path to a folder where statistics report is stored
 DEFINE_string(report_folder, "", report_folder_message);
 
+/// @brief Path to a file where the latency histograms are stored
+DEFINE_string(latency_histogram, "", latency_histogram_message);
+
 /// @brief Enables JSON-based statistics reporting
 DEFINE_bool(json_stats, false, json_stats_message);
 
@@ -396,6 +423,8 @@ static void show_usage() {
     std::cout << "    -niter  <integer>             " << iterations_count_message << std::endl;
     std::cout << "    -max_irate \"<float>\"        " << maximum_inference_rate_message << std::endl;
     std::cout << "    -t                            " << execution_time_message << std::endl;
+    std::cout << "    -arrival_rate \"<float>\"     " << arrival_rate_message << std::endl;
+    std::cout << "    -arrival  <string>            " << arrival_message << std::endl;
     std::cout << std::endl;
     std::cout << "Input shapes" << std::endl;
     std::cout << "    -b  <integer>                 " << batch_size_message << std::endl;
@@ -431,6 +460,7 @@ static void show_usage() {
     std::cout << "    -report_type  <type>    " << report_type_message << std::endl;
     std::cout << "    -report_folder          " << report_folder_message << std::endl;
     std::cout << "    -json_stats             " << json_stats_message << std::endl;
+    std::cout << "    -latency_histogram      " << latency_histogram_message << std::endl;
     std::cout << "    -pc                     " << pc_message << std::endl;
     std::cout << "    -pcsort                 " << pc_sort_message << std::endl;
     std::cout << "    -pcseq                  " << pcseq_message << std::endl;
@@ -18,6 +18,7 @@
 
 // clang-format off
 
+#include "latency_histogram.hpp"
 #include "remote_tensors_filling.hpp"
 #include "statistics_report.hpp"
 #include "utils.hpp"
@@ -47,6 +48,15 @@ public:
 
     void start_async() {
         _startTime = Time::now();
+        _arrivalTime = _startTime;
+        _request.start_async();
+    }
+
+    /// @brief Starts the request which arrived at the given time (the open-loop mode), the time passed since the
+    /// arrival is the queueing delay
+    void start_async(const Time::time_point& arrivalTime) {
+        _startTime = Time::now();
+        _arrivalTime = std::min(arrivalTime, _startTime);
         _request.start_async();
     }
 
@@ -56,6 +66,7 @@ public:
 
     void infer() {
         _startTime = Time::now();
+        _arrivalTime = _startTime;
         _request.infer();
         _endTime = Time::now();
         _callbackQueue(_id, _lat_group_id, get_execution_time_in_milliseconds(), nullptr);
@@ -83,6 +94,11 @@ public:
         return static_cast<double>(execTime.count()) * 0.000001;
     }
 
+    double get_queueing_delay_in_milliseconds() const {
+        auto queueingTime = std::chrono::duration_cast<ns>(_startTime - _arrivalTime);
+        return static_cast<double>(queueingTime.count()) * 0.000001;
+    }
+
     void set_latency_group_id(size_t id) {
         _lat_group_id = id;
     }
@@ -96,6 +112,7 @@ public:
 
 private:
     ov::InferRequest _request;
+    Time::time_point _arrivalTime;
     Time::time_point _startTime;
     Time::time_point _endTime;
     size_t _id;
@@ -137,6 +154,8 @@ public:
         _startTime = Time::time_point::max();
         _endTime = Time::time_point::min();
         _latencies.clear();
+        _latency_histogram.clear();
+        _queueing_histogram.clear();
         for (auto& group : _latency_groups) {
             group.clear();
         }
@@ -155,6 +174,9 @@ public:
             inferenceException = ptr;
         } else {
             _latencies.push_back(latency);
+            const auto queueing_delay = requests.at(id)->get_queueing_delay_in_milliseconds();
+            _latency_histogram.record(queueing_delay + latency);
+            _queueing_histogram.record(queueing_delay);
             if (enable_lat_groups) {
                 _latency_groups[lat_group_id].push_back(latency);
             }
@@ -196,6 +218,15 @@ public:
         return _latency_groups;
     }
 
+    /// @brief Latencies including the queueing delay
+    const LatencyHistogram& get_latency_histogram() const {
+        return _latency_histogram;
+    }
+
+    const LatencyHistogram& get_queueing_histogram() const {
+        return _queueing_histogram;
+    }
+
     std::vector<InferReqWrap::Ptr> requests;
 
 private:
@@ -206,6 +237,8 @@ private:
     Time::time_point _endTime;
     std::vector<double> _latencies;
     std::vector<std::vector<double>> _latency_groups;
+    LatencyHistogram _latency_histogram;
+    LatencyHistogram _queueing_histogram;
     bool enable_lat_groups;
     std::exception_ptr inferenceException = nullptr;
 };
@@ -0,0 +1,176 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// clang-format off
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "samples/common.hpp"
+#include "samples/csv_dumper.hpp"
+#include "samples/slog.hpp"
+
+#include "latency_histogram.hpp"
+// clang-format on
+
+namespace {
+constexpr uint64_t sub_bucket_count = 1ULL << LatencyHistogram::sub_bucket_bits;
+constexpr uint64_t half_sub_bucket_count = sub_bucket_count / 2;
+
+uint32_t floor_log2(uint64_t value) {
+    uint32_t result = 0;
+    while (value >>= 1) {
+        result++;
+    }
+    return result;
+}
+
+std::string percentile_name(double percentile) {
+    std::ostringstream str;
+    str << "p" << percentile;
+    return str.str();
+}
+}  // namespace
+
+const std::vector<double> LatencyHistogram::reported_percentiles = {50, 90, 99, 99.9};
+
+size_t LatencyHistogram::bucket_index(uint64_t value_us) {
+    if (value_us < sub_bucket_count) {
+        return static_cast<size_t>(value_us);
+    }
+    // every next power of two is split into the half of the sub buckets of the twice bigger width
+    const uint64_t shift = floor_log2(value_us) - LatencyHistogram::sub_bucket_bits + 1;
+    return static_cast<size_t>(sub_bucket_count + (shift - 1) * half_sub_bucket_count + (value_us >> shift) -
+                               half_sub_bucket_count);
+}
+
+uint64_t LatencyHistogram::bucket_lowest(size_t index) {
+    if (index < sub_bucket_count) {
+        return index;
+    }
+    const uint64_t offset = index - sub_bucket_count;
+    const uint64_t shift = offset / half_sub_bucket_count + 1;
+    return (offset % half_sub_bucket_count + half_sub_bucket_count) << shift;
+}
+
+uint64_t LatencyHistogram::bucket_highest(size_t index) {
+    return bucket_lowest(index + 1) - 1;
+}
+
+void LatencyHistogram::record(double latency_ms) {
+    const auto value_us = static_cast<uint64_t>(std::llround(std::max(latency_ms, 0.0) * 1000.0));
+    const auto index = bucket_index(value_us);
+    if (index >= _counts.size()) {
+        _counts.resize(index + 1, 0);
+    }
+    _counts[index]++;
+    _count++;
+    _min_us = std::min(_min_us, value_us);
+    _max_us = std::max(_max_us, value_us);
+    _sum_ms += latency_ms;
+}
+
+void LatencyHistogram::clear() {
+    *this = LatencyHistogram();
+}
+
+double LatencyHistogram::min() const {
+    return _count ? _min_us / 1000.0 : 0.0;
+}
+
+double LatencyHistogram::max() const {
+    return _max_us / 1000.0;
+}
+
+double LatencyHistogram::mean() const {
+    return _count ? _sum_ms / _count : 0.0;
+}
+
+double LatencyHistogram::value_at_percentile(double percentile) const {
+    if (_count == 0) {
+        return 0.0;
+    }
+    const auto target =
+        std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(std::min(percentile, 100.0) / 100.0 * _count)));
+    uint64_t accumulated = 0;
+    for (size_t i = 0; i < _counts.size(); i++) {
+        accumulated += _counts[i];
+        if (accumulated >= target) {
+            return std::min(bucket_highest(i), _max_us) / 1000.0;
+        }
+    }
+    return max();
+}
+
+std::vector<LatencyHistogram::Bucket> LatencyHistogram::buckets() const {
+    std::vector<Bucket> result;
+    for (size_t i = 0; i < _counts.size(); i++) {
+        if (_counts[i] != 0) {
+            result.push_back({bucket_lowest(i) / 1000.0, (bucket_highest(i) + 1) / 1000.0, _counts[i]});
+        }
+    }
+    return result;
+}
+
+nlohmann::json LatencyHistogram::to_json() const {
+    nlohmann::json js;
+    js["count"] = _count;
+    js["min"] = min();
+    js["mean"] = mean();
+    js["max"] = max();
+    for (auto percentile : reported_percentiles) {
+        js[percentile_name(percentile)] = value_at_percentile(percentile);
+    }
+    js["buckets"] = nlohmann::json::array();
+    for (const auto& bucket : buckets()) {
+        js["buckets"].push_back({{"from", bucket.from_ms}, {"to", bucket.to_ms}, {"count", bucket.count}});
+    }
+    return js;
+}
+
+void LatencyHistogram::write_to_slog(const std::string& title) const {
+    slog::info << title << slog::endl;
+    for (auto percentile : reported_percentiles) {
+        std::string name = "   " + percentile_name(percentile) + ":";
+        name.resize(21, ' ');
+        slog::info << name << double_to_string(value_at_percentile(percentile)) << " ms" << slog::endl;
+    }
+    slog::info << "   Max:              " << double_to_string(max()) << " ms" << slog::endl;
+}
+
+void dump_latency_histograms(const std::string& file_name,
+                             const std::vector<std::pair<std::string, const LatencyHistogram*>>& histograms) {
+    const auto is_json = file_name.size() >= 5 && file_name.compare(file_name.size() - 5, 5, ".json") == 0;
+    if (is_json) {
+        nlohmann::json js;
+        for (const auto& histogram : histograms) {
+            js[histogram.first] = histogram.second->to_json();
+        }
+        std::ofstream out_stream(file_name);
+        out_stream << std::setw(4) << js << std::endl;
+    } else {
+        CsvDumper dumper(true, file_name, 3);
+        dumper << "histogram"
+               << "from (ms)"
+               << "to (ms)"
+               << "count"
+               << "cumulative (%)";
+        dumper.endLine();
+        for (const auto& histogram : histograms) {
+            uint64_t accumulated = 0;
+            for (const auto& bucket : histogram.second->buckets()) {
+                accumulated += bucket.count;
+                dumper << histogram.first << bucket.from_ms << bucket.to_ms << bucket.count
+                       << 100.0 * accumulated / histogram.second->count();
+                dumper.endLine();
+            }
+        }
+    }
+    slog::info << "Latency histograms are stored to " << file_name << slog::endl;
+}
@@ -0,0 +1,66 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifdef JSON_HEADER
+#    include <json.hpp>
+#else
+#    include <nlohmann/json.hpp>
+#endif
+
+/// @brief Latency histogram with the log-linear buckets (HDR-style): the values below 2^sub_bucket_bits microseconds
+/// are counted exactly, the larger ones with the relative precision of 2^(1 - sub_bucket_bits). The memory does not
+/// depend on the number of the recorded values, so the tail percentiles of the long runs are not approximated.
+class LatencyHistogram {
+public:
+    struct Bucket {
+        double from_ms;
+        double to_ms;
+        uint64_t count;
+    };
+
+    static constexpr uint32_t sub_bucket_bits = 8;
+
+    void record(double latency_ms);
+    void clear();
+
+    uint64_t count() const {
+        return _count;
+    }
+
+    double min() const;
+    double max() const;
+    double mean() const;
+    /// @brief The highest value equivalent to the one at the percentile (in the range [0, 100])
+    double value_at_percentile(double percentile) const;
+    /// @brief The non-empty buckets in the ascending order
+    std::vector<Bucket> buckets() const;
+
+    /// @brief p50/p90/p99/p99.9 and the histogram itself
+    nlohmann::json to_json() const;
+    void write_to_slog(const std::string& title) const;
+
+    static const std::vector<double> reported_percentiles;
+
+private:
+    static size_t bucket_index(uint64_t value_us);
+    static uint64_t bucket_lowest(size_t index);
+    static uint64_t bucket_highest(size_t index);
+
+    std::vector<uint64_t> _counts;
+    uint64_t _count = 0;
+    uint64_t _min_us = UINT64_MAX;
+    uint64_t _max_us = 0;
+    double _sum_ms = 0;
+};
+
+/// @brief Dumps the histograms as JSON (if the file has .json extension) or CSV
+void dump_latency_histograms(const std::string& file_name,
+                             const std::vector<std::pair<std::string, const LatencyHistogram*>>& histograms);
@@ -0,0 +1,99 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// clang-format off
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "load_generator.hpp"
+// clang-format on
+
+ArrivalProcess::ArrivalProcess(const std::string& arrival, double rate)
+    : _type(arrival == "poisson" ? Type::POISSON : arrival == "constant" ? Type::CONSTANT : Type::TRACE),
+      _rate(rate),
+      _generator(std::random_device{}()) {
+    if (_type != Type::TRACE) {
+        if (_rate <= 0) {
+            throw std::logic_error("Arrival rate should be positive for the " + arrival + " arrivals.");
+        }
+        _interval = std::exponential_distribution<double>(_rate * 1e-9);
+        return;
+    }
+
+    _trace_name = arrival;
+    std::ifstream trace(arrival);
+    if (!trace) {
+        throw std::logic_error("Cannot open the arrivals trace file " + arrival);
+    }
+    std::string line;
+    while (std::getline(trace, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        _trace_ns.push_back(std::stod(line) * 1e6);
+    }
+    if (_trace_ns.size() < 2) {
+        throw std::logic_error("The arrivals trace " + arrival + " should contain at least 2 arrival times.");
+    }
+    std::sort(_trace_ns.begin(), _trace_ns.end());
+    const auto first = _trace_ns.front();
+    for (auto& time : _trace_ns) {
+        time -= first;
+    }
+    // the trace is replayed cyclically keeping its mean interval between the last and the first arrivals
+    const auto span = _trace_ns.back();
+    if (span <= 0) {
+        throw std::logic_error("The arrivals trace " + arrival + " should span a positive time interval.");
+    }
+    _trace_period_ns = span + span / (_trace_ns.size() - 1);
+    const auto trace_rate = _trace_ns.size() / _trace_period_ns * 1e9;
+    if (_rate > 0) {
+        const auto scale = trace_rate / _rate;
+        for (auto& time : _trace_ns) {
+            time *= scale;
+        }
+        _trace_period_ns *= scale;
+    } else {
+        _rate = trace_rate;
+    }
+}
+
+ns ArrivalProcess::next() {
+    double time_ns = 0;
+    switch (_type) {
+    case Type::POISSON:
+        time_ns = _time_ns;
+        _time_ns += _interval(_generator);
+        break;
+    case Type::CONSTANT:
+        time_ns = _index++ * 1e9 / _rate;
+        break;
+    case Type::TRACE:
+        time_ns = (_index / _trace_ns.size()) * _trace_period_ns + _trace_ns[_index % _trace_ns.size()];
+        _index++;
+        break;
+    }
+    return ns(static_cast<ns::rep>(time_ns));
+}
+
+std::string ArrivalProcess::description() const {
+    std::stringstream ss;
+    switch (_type) {
+    case Type::POISSON:
+        ss << "Poisson";
+        break;
+    case Type::CONSTANT:
+        ss << "constant";
+        break;
+    case Type::TRACE:
+        ss << "trace " << _trace_name;
+        break;
+    }
+    ss << " arrivals at " << _rate << " requests per second";
+    return ss.str();
+}
@@ -0,0 +1,49 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "utils.hpp"
+
+/// @brief Arrival times of the requests for the open-loop load generation. The requests are submitted at these times
+/// independently of the completion of the previous ones, so the waiting for an idle infer request is the queueing
+/// delay which is a part of the request latency.
+class ArrivalProcess {
+public:
+    /// @param arrival "poisson", "constant" or a path to the trace file with an arrival time (ms) on every line
+    /// @param rate mean number of the requests per second, rescales the trace if it is not 0
+    ArrivalProcess(const std::string& arrival, double rate);
+
+    /// @brief Offset of the next arrival from the start of the measurement
+    ns next();
+
+    /// @brief Mean number of the requests per second
+    double rate() const {
+        return _rate;
+    }
+
+    std::string description() const;
+
+    static bool is_trace(const std::string& arrival) {
+        return arrival != "poisson" && arrival != "constant";
+    }
+
+private:
+    enum class Type { POISSON, CONSTANT, TRACE };
+
+    Type _type;
+    double _rate;
+    std::mt19937_64 _generator;
+    std::exponential_distribution<double> _interval;
+    double _time_ns = 0;
+    std::string _trace_name;
+    std::vector<double> _trace_ns;  // ascending, starts with 0
+    double _trace_period_ns = 0;
+    size_t _index = 0;
+};
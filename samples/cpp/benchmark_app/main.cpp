@@ -32,6 +32,8 @@
 #include "benchmark_app.hpp"
 #include "infer_request_wrap.hpp"
 #include "inputs_filling.hpp"
+#include "latency_histogram.hpp"
+#include "load_generator.hpp"
 #include "remote_tensors_filling.hpp"
 #include "statistics_report.hpp"
 #include "utils.hpp"
@@ -120,6 +122,10 @@ int64_t get_peak_memory_usage() {
 
 #endif
 
+bool is_open_loop() {
+    return FLAGS_arrival_rate > 0 || ArrivalProcess::is_trace(FLAGS_arrival);
+}
+
 bool parse_and_check_command_line(int argc, char* argv[]) {
     // ---------------------------Parsing and validating input
     // arguments--------------------------------------
@@ -140,12 +146,23 @@ bool parse_and_check_command_line(int argc, char* argv[]) {
         show_usage();
         throw std::logic_error("The percentile value is incorrect. The applicable values range is [1, 100].");
     }
+    if (FLAGS_arrival_rate < 0) {
+        throw std::logic_error("The arrival rate should be positive.");
+    }
     if (FLAGS_api == "") {
-        FLAGS_api = FLAGS_hint == "latency" ? "sync" : "async";
+        FLAGS_api = FLAGS_hint == "latency" && !is_open_loop() ? "sync" : "async";
     }
     if (FLAGS_api != "async" && FLAGS_api != "sync") {
         throw std::logic_error("Incorrect API. Please set -api option to `sync` or `async` value.");
     }
+    if (is_open_loop()) {
+        if (FLAGS_api != "async") {
+            throw std::logic_error("The open-loop mode (-arrival_rate or -arrival trace) requires async API.");
+        }
+        if (FLAGS_max_irate > 0) {
+            throw std::logic_error("-max_irate can't be used together with the open-loop mode.");
+        }
+    }
     if (FLAGS_api == "sync") {
         if ((FLAGS_t == 0) && (FLAGS_nireq > FLAGS_niter)) {
             throw std::logic_error(
@@ -1015,6 +1032,11 @@ int main(int argc, char* argv[]) {
         }
         uint64_t duration_nanoseconds = get_duration_in_nanoseconds(duration_seconds);
 
+        std::unique_ptr<ArrivalProcess> arrivals;
+        if (is_open_loop()) {
+            arrivals = std::make_unique<ArrivalProcess>(FLAGS_arrival, FLAGS_arrival_rate);
+        }
+
         if (statistics) {
             statistics->add_parameters(
                 StatisticsReport::Category::RUNTIME_CONFIG,
@@ -1028,6 +1050,12 @@ int main(int argc, char* argv[]) {
                      StatisticsVariant("number of iterations", "iterations_num", niter),
                      StatisticsVariant("number of parallel infer requests", "nireq", nireq),
                      StatisticsVariant("duration (ms)", "duration", get_duration_in_milliseconds(duration_seconds))}));
+            if (arrivals) {
+                statistics->add_parameters(
+                    StatisticsReport::Category::RUNTIME_CONFIG,
+                    {StatisticsVariant("arrival process", "arrival", FLAGS_arrival),
+                     StatisticsVariant("arrival rate (requests/s)", "arrival_rate", arrivals->rate())});
+            }
             for (auto& nstreams : device_nstreams) {
                 std::stringstream ss;
                 ss << "number of " << nstreams.first << " streams";
@@ -1118,6 +1146,9 @@ int main(int argc, char* argv[]) {
             if (!device_ss.str().empty()) {
                 ss << " using " << device_ss.str();
             }
+            if (arrivals) {
+                ss << ", open-loop " << arrivals->description();
+            }
         }
         ss << ", limits: ";
         if (duration_seconds > 0) {
@@ -1227,6 +1258,12 @@ int main(int argc, char* argv[]) {
         while ((niter != 0LL && iteration < niter) ||
                (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
                (FLAGS_api == "async" && iteration % nireq != 0)) {
+            // the request waits for an idle infer request after its arrival, so the queueing is a part of its latency
+            Time::time_point arrivalTime;
+            if (arrivals) {
+                arrivalTime = startTime + arrivals->next();
+                std::this_thread::sleep_until(arrivalTime);
+            }
             inferRequest = inferRequestsQueue.get_idle_request();
             if (!inferRequest) {
                 OPENVINO_THROW("No idle Infer Requests!");
@@ -1260,6 +1297,8 @@ int main(int argc, char* argv[]) {
 
             if (FLAGS_api == "sync") {
                 inferRequest->infer();
+            } else if (arrivals) {
+                inferRequest->start_async(arrivalTime);
             } else {
                 inferRequest->start_async();
             }
@@ -1326,9 +1365,31 @@ int main(int argc, char* argv[]) {
                     }
                 }
             }
+            if (arrivals) {
+                const auto& latencyHistogram = inferRequestsQueue.get_latency_histogram();
+                const auto& queueingHistogram = inferRequestsQueue.get_queueing_histogram();
+                for (auto percentile : LatencyHistogram::reported_percentiles) {
+                    std::stringstream name;
+                    name << percentile;
+                    statistics->add_parameters(
+                        StatisticsReport::Category::EXECUTION_RESULTS,
+                        {StatisticsVariant("p" + name.str() + " latency with queueing (ms)",
+                                           "latency_with_queueing_p" + name.str(),
+                                           latencyHistogram.value_at_percentile(percentile)),
+                         StatisticsVariant("p" + name.str() + " queueing delay (ms)",
+                                           "queueing_delay_p" + name.str(),
+                                           queueingHistogram.value_at_percentile(percentile))});
+                }
+            }
             statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                        {StatisticsVariant("throughput", "throughput", fps)});
         }
+
+        if (!FLAGS_latency_histogram.empty()) {
+            dump_latency_histograms(FLAGS_latency_histogram,
+                                    {{"latency_with_queueing", &inferRequestsQueue.get_latency_histogram()},
+                                     {"queueing_delay", &inferRequestsQueue.get_queueing_histogram()}});
+        }
         // ----------------- 11. Dumping statistics report
         // -------------------------------------------------------------
         next_step();
@@ -1404,6 +1465,13 @@ int main(int argc, char* argv[]) {
             }
         }
 
+        if (arrivals && device_name.find("MULTI") == std::string::npos) {
+            inferRequestsQueue.get_latency_histogram().write_to_slog("Latency including queueing delay:");
+            inferRequestsQueue.get_queueing_histogram().write_to_slog("Queueing delay:");
+            slog::info << "Offered load:        " << double_to_string(arrivals->rate()) << " requests/s"
+                       << slog::endl;
+        }
+
         slog::info << "Throughput:          " << double_to_string(fps) << " FPS" << slog::endl;
 
     } catch (const std::exception& ex) {
@@ -72,6 +72,29 @@ ov_tensor_create_from_string_array(const char** string_array,
                                    const ov_shape_t shape,
                                    ov_tensor_t** tensor);
 
+/**
+ * @brief Constructs a new string tensor from the packed strings: the i-th string is the range [begins[i], ends[i]) of
+ * the chars buffer, i.e. the layout of the StringTensorUnpack outputs. The strings are copied in a single pass over
+ * the buffer without the intermediate C strings.
+ * @ingroup ov_tensor_c_api
+ * @param begins The offsets of the first characters of the strings
+ * @param ends The offsets past the last characters of the strings
+ * @param chars The buffer with the characters of all the strings
+ * @param chars_size The size of the chars buffer
+ * @param array_size The number of the strings
+ * @param shape Tensor shape
+ * @param tensor A point to ov_tensor_t
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_tensor_create_from_packed_strings(const int32_t* begins,
+                                     const int32_t* ends,
+                                     const uint8_t* chars,
+                                     const size_t chars_size,
+                                     const size_t array_size,
+                                     const ov_shape_t shape,
+                                     ov_tensor_t** tensor);
+
 /**
  * @brief Get shape for tensor.
  * @ingroup ov_tensor_c_api
@@ -102,6 +125,44 @@ ov_tensor_get_element_type(const ov_tensor_t* tensor, ov_element_type_e* type);
 OPENVINO_C_API(ov_status_e)
 ov_tensor_set_string_data(ov_tensor_t* tensor, const char** string_array, const size_t array_size);
 
+/**
+ * @brief Set string data for tensor from the packed strings, see ov_tensor_create_from_packed_strings
+ * @ingroup ov_tensor_c_api
+ * @param tensor A point to ov_tensor_t
+ * @param begins The offsets of the first characters of the strings
+ * @param ends The offsets past the last characters of the strings
+ * @param chars The buffer with the characters of all the strings
+ * @param chars_size The size of the chars buffer
+ * @param array_size The number of the strings
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_tensor_set_packed_string_data(ov_tensor_t* tensor,
+                                 const int32_t* begins,
+                                 const int32_t* ends,
+                                 const uint8_t* chars,
+                                 const size_t chars_size,
+                                 const size_t array_size);
+
+/**
+ * @brief Get string data of tensor in the packed form, so the strings are read without the C++ std::string objects.
+ * If chars is NULL, only the total length of the strings is returned in chars_size, otherwise the begins and the ends
+ * hold the number of the tensor elements and the chars buffer holds chars_size characters.
+ * @ingroup ov_tensor_c_api
+ * @param tensor A point to ov_tensor_t
+ * @param begins The offsets of the first characters of the strings
+ * @param ends The offsets past the last characters of the strings
+ * @param chars The buffer for the characters of all the strings
+ * @param chars_size The size of the chars buffer
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_tensor_get_packed_string_data(const ov_tensor_t* tensor,
+                                 int32_t* begins,
+                                 int32_t* ends,
+                                 uint8_t* chars,
+                                 size_t* chars_size);
+
 /**
  * @brief the total number of elements (a product of all the dims or 1 for scalar).
  * @ingroup ov_tensor_c_api
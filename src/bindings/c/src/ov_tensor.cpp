@@ -3,6 +3,8 @@
 //
 #include "openvino/c/ov_tensor.h"
 
+#include <limits>
+
 #include "common.h"
 
 const std::map<ov_element_type_e, ov::element::Type> element_type_map = {
@@ -105,6 +107,49 @@ ov_status_e ov_tensor_create_from_string_array(const char** string_array,
     return ov_status_e::OK;
 }
 
+namespace {
+bool is_valid_packed_strings(const int32_t* begins, const int32_t* ends, const size_t chars_size, const size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        if (begins[i] < 0 || begins[i] > ends[i] || static_cast<size_t>(ends[i]) > chars_size) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void unpack_strings(const int32_t* begins, const int32_t* ends, const uint8_t* chars, std::string* data, size_t count) {
+    const auto symbols = reinterpret_cast<const char*>(chars);
+    for (size_t i = 0; i < count; ++i) {
+        data[i].assign(symbols + begins[i], symbols + ends[i]);
+    }
+}
+}  // namespace
+
+ov_status_e ov_tensor_create_from_packed_strings(const int32_t* begins,
+                                                 const int32_t* ends,
+                                                 const uint8_t* chars,
+                                                 const size_t chars_size,
+                                                 const size_t array_size,
+                                                 const ov_shape_t shape,
+                                                 ov_tensor_t** tensor) {
+    if (!tensor || (array_size && (!begins || !ends || (chars_size && !chars)))) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        auto _tensor = std::make_unique<ov_tensor_t>();
+        ov::Shape tmp_shape;
+        std::copy_n(shape.dims, shape.rank, std::back_inserter(tmp_shape));
+        if (shape_size(tmp_shape) < array_size || !is_valid_packed_strings(begins, ends, chars_size, array_size)) {
+            return ov_status_e::INVALID_C_PARAM;
+        }
+        _tensor->object = std::make_shared<ov::Tensor>(ov::element::string, tmp_shape);
+        unpack_strings(begins, ends, chars, _tensor->object->data<std::string>(), array_size);
+        *tensor = _tensor.release();
+    }
+    CATCH_OV_EXCEPTIONS
+    return ov_status_e::OK;
+}
+
 ov_status_e ov_tensor_set_shape(ov_tensor_t* tensor, const ov_shape_t shape) {
     if (!tensor) {
         return ov_status_e::INVALID_C_PARAM;
@@ -151,6 +196,62 @@ ov_status_e ov_tensor_set_string_data(ov_tensor_t* tensor, const char** string_a
     return ov_status_e::OK;
 }
 
+ov_status_e ov_tensor_set_packed_string_data(ov_tensor_t* tensor,
+                                             const int32_t* begins,
+                                             const int32_t* ends,
+                                             const uint8_t* chars,
+                                             const size_t chars_size,
+                                             const size_t array_size) {
+    if (!tensor || tensor->object->get_element_type() != ov::element::string ||
+        tensor->object->get_size() != array_size || (array_size && (!begins || !ends || (chars_size && !chars)))) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        if (!is_valid_packed_strings(begins, ends, chars_size, array_size)) {
+            return ov_status_e::INVALID_C_PARAM;
+        }
+        unpack_strings(begins, ends, chars, tensor->object->data<std::string>(), array_size);
+    }
+    CATCH_OV_EXCEPTIONS
+    return ov_status_e::OK;
+}
+
+ov_status_e ov_tensor_get_packed_string_data(const ov_tensor_t* tensor,
+                                             int32_t* begins,
+                                             int32_t* ends,
+                                             uint8_t* chars,
+                                             size_t* chars_size) {
+    if (!tensor || !chars_size || tensor->object->get_element_type() != ov::element::string) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        const auto data = tensor->object->data<std::string>();
+        const auto count = tensor->object->get_size();
+        size_t total_size = 0;
+        for (size_t i = 0; i < count; ++i) {
+            total_size += data[i].length();
+        }
+        if (!chars) {
+            *chars_size = total_size;
+            return ov_status_e::OK;
+        }
+        if (*chars_size < total_size || total_size > static_cast<size_t>(std::numeric_limits<int32_t>::max()) ||
+            (count && (!begins || !ends))) {
+            return ov_status_e::INVALID_C_PARAM;
+        }
+        int32_t offset = 0;
+        for (size_t i = 0; i < count; ++i) {
+            begins[i] = offset;
+            chars = std::copy(data[i].begin(), data[i].end(), chars);
+            offset += static_cast<int32_t>(data[i].length());
+            ends[i] = offset;
+        }
+        *chars_size = total_size;
+    }
+    CATCH_OV_EXCEPTIONS
+    return ov_status_e::OK;
+}
+
 ov_status_e ov_tensor_get_element_type(const ov_tensor_t* tensor, ov_element_type_e* type) {
     if (!tensor || !type) {
         return ov_status_e::INVALID_C_PARAM;
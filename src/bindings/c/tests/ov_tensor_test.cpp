@@ -42,6 +42,33 @@ TEST(ov_tensor, ov_tensor_create_from_string_array) {
     ov_tensor_free(tensor);
 }
 
+TEST(ov_tensor, ov_tensor_create_from_packed_strings) {
+    const int32_t begins[4] = {0, 4, 6, 6};
+    const int32_t ends[4] = {4, 6, 6, 11};
+    const uint8_t chars[] = {'t', 'e', 's', 't', 'm', 'e', 't', 'h', 'e', 'r', 'e'};
+    ov_tensor_t* tensor = nullptr;
+    ov_shape_t shape;
+    const int64_t dims[2] = {2, 2};
+    ov_shape_create(2, dims, &shape);
+    OV_EXPECT_OK(ov_tensor_create_from_packed_strings(begins, ends, chars, sizeof(chars), 4, shape, &tensor));
+    EXPECT_NE(nullptr, tensor);
+    void* data = nullptr;
+    OV_EXPECT_OK(ov_tensor_data(tensor, &data));
+    auto string_data = static_cast<std::string*>(data);
+    EXPECT_EQ(string_data[0], "test");
+    EXPECT_EQ(string_data[1], "me");
+    EXPECT_EQ(string_data[2], "");
+    EXPECT_EQ(string_data[3], "there");
+    ov_tensor_free(tensor);
+    tensor = nullptr;
+
+    const int32_t out_of_buffer_ends[4] = {4, 6, 6, 12};
+    OV_EXPECT_NOT_OK(
+        ov_tensor_create_from_packed_strings(begins, out_of_buffer_ends, chars, sizeof(chars), 4, shape, &tensor));
+    EXPECT_EQ(nullptr, tensor);
+    ov_shape_free(&shape);
+}
+
 static size_t product(const std::vector<size_t>& dims) {
     if (dims.empty())
         return 0;
@@ -182,3 +209,30 @@ TEST_F(ov_string_tensor_create_test, set_tensor_string) {
         EXPECT_EQ(current_string, std::string(string_array[i]));
     }
 }
+
+TEST_F(ov_string_tensor_create_test, set_get_tensor_packed_strings) {
+    const size_t number_of_strings = 4;
+    const int32_t begins[number_of_strings] = {0, 5, 7, 12};
+    const int32_t ends[number_of_strings] = {5, 7, 12, 12};
+    const uint8_t chars[] = {'h', 'e', 'l', 'l', 'o', 'h', 'i', 'w', 'o', 'r', 'l', 'd'};
+    OV_EXPECT_OK(ov_tensor_set_packed_string_data(tensor, begins, ends, chars, sizeof(chars), number_of_strings));
+
+    size_t chars_size = 0;
+    OV_EXPECT_OK(ov_tensor_get_packed_string_data(tensor, nullptr, nullptr, nullptr, &chars_size));
+    EXPECT_EQ(chars_size, sizeof(chars));
+
+    int32_t out_begins[number_of_strings] = {};
+    int32_t out_ends[number_of_strings] = {};
+    uint8_t out_chars[sizeof(chars)] = {};
+    OV_EXPECT_OK(ov_tensor_get_packed_string_data(tensor, out_begins, out_ends, out_chars, &chars_size));
+    for (size_t i = 0; i < number_of_strings; ++i) {
+        EXPECT_EQ(out_begins[i], begins[i]);
+        EXPECT_EQ(out_ends[i], ends[i]);
+    }
+    for (size_t i = 0; i < sizeof(chars); ++i) {
+        EXPECT_EQ(out_chars[i], chars[i]);
+    }
+
+    chars_size = sizeof(chars) - 1;
+    OV_EXPECT_NOT_OK(ov_tensor_get_packed_string_data(tensor, out_begins, out_ends, out_chars, &chars_size));
+}
@@ -4772,6 +4772,24 @@ class Tensor:
                                         :rtype: openvino.Type
         """
     @property
+    def packed_string_data(self) -> tuple:
+        """
+                    Access to Tensor's data with string Type in the packed form of the StringTensorUnpack outputs.
+        
+                    Getter returns a tuple of `begins` and `ends` numpy arrays of int32 with Tensor's shape
+                    and a flat `chars` numpy array of uint8 with all the strings encoded in UTF-8,
+                    the i-th string is `chars[begins[i]:ends[i]]`.
+                    Warning: Data of string type is always a copy of underlaying memory!
+        
+                    Setter fills underlaying Tensor's memory by copying strings from the `(begins, ends, chars)` tuple
+                    without creating a Python object per string.
+                    `begins` and `ends` must have the same size (number of elements) as the Tensor.
+                    Tensor's shape is not changed by performing this operation!
+        """
+    @packed_string_data.setter
+    def packed_string_data(self, arg1: tuple) -> None:
+        ...
+    @property
     def shape(self) -> Shape:
         """
                     Tensor's shape get/set.
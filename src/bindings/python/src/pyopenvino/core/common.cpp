@@ -4,6 +4,9 @@
 
 #include "common.hpp"
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
 #include <unordered_map>
 
 #include "Python.h"
@@ -124,6 +127,109 @@ const char* find_last_not_null(const char* str, size_t length) {
                         })
         .base();
 }
+
+// Decodes the strict UTF-8 (no surrogates and overlong forms) as Python does, the out may be nullptr to count the
+// code points only. Returns false for the invalid sequences, which are decoded by Python with the replacements.
+bool decode_utf8(const std::string& str, uint32_t* out, size_t& length) {
+    const auto bytes = reinterpret_cast<const uint8_t*>(str.data());
+    const size_t size = str.size();
+    length = 0;
+    for (size_t i = 0; i < size; ++length) {
+        const uint32_t lead = bytes[i];
+        size_t tail = 0;
+        uint32_t code_point = 0;
+        uint8_t low = 0x80, high = 0xBF;
+        if (lead < 0x80) {
+            code_point = lead;
+        } else if (lead >= 0xC2 && lead <= 0xDF) {
+            tail = 1;
+            code_point = lead & 0x1F;
+        } else if (lead >= 0xE0 && lead <= 0xEF) {
+            tail = 2;
+            code_point = lead & 0x0F;
+            low = lead == 0xE0 ? 0xA0 : low;
+            high = lead == 0xED ? 0x9F : high;
+        } else if (lead >= 0xF0 && lead <= 0xF4) {
+            tail = 3;
+            code_point = lead & 0x07;
+            low = lead == 0xF0 ? 0x90 : low;
+            high = lead == 0xF4 ? 0x8F : high;
+        } else {
+            return false;
+        }
+        if (i + tail >= size) {
+            return false;
+        }
+        for (size_t j = 1; j <= tail; ++j) {
+            const uint8_t byte = bytes[i + j];
+            if (byte < (j == 1 ? low : 0x80) || byte > (j == 1 ? high : 0xBF)) {
+                return false;
+            }
+            code_point = (code_point << 6) | (byte & 0x3F);
+        }
+        if (out) {
+            out[length] = code_point;
+        }
+        i += tail + 1;
+    }
+    return true;
+}
+
+// Encodes the UCS4 code points to UTF-8, returns false for the surrogates which are rejected by Python.
+bool encode_utf8(const uint8_t* ucs4, size_t length, std::string& str) {
+    auto code_point_at = [ucs4](size_t i) {
+        uint32_t code_point = 0;
+        std::memcpy(&code_point, ucs4 + i * sizeof(uint32_t), sizeof(uint32_t));
+        return code_point;
+    };
+    // trailing null characters are not stored in the tensor, as for the bytes
+    while (length > 0 && code_point_at(length - 1) == 0) {
+        --length;
+    }
+    size_t size = 0;
+    for (size_t i = 0; i < length; ++i) {
+        const auto code_point = code_point_at(i);
+        if ((code_point >= 0xD800 && code_point <= 0xDFFF) || code_point > 0x10FFFF) {
+            return false;
+        }
+        size += code_point < 0x80 ? 1 : code_point < 0x800 ? 2 : code_point < 0x10000 ? 3 : 4;
+    }
+    str.resize(size);
+    auto out = reinterpret_cast<uint8_t*>(&str[0]);
+    for (size_t i = 0; i < length; ++i) {
+        const auto code_point = code_point_at(i);
+        if (code_point < 0x80) {
+            *out++ = static_cast<uint8_t>(code_point);
+        } else if (code_point < 0x800) {
+            *out++ = static_cast<uint8_t>(0xC0 | (code_point >> 6));
+            *out++ = static_cast<uint8_t>(0x80 | (code_point & 0x3F));
+        } else if (code_point < 0x10000) {
+            *out++ = static_cast<uint8_t>(0xE0 | (code_point >> 12));
+            *out++ = static_cast<uint8_t>(0x80 | ((code_point >> 6) & 0x3F));
+            *out++ = static_cast<uint8_t>(0x80 | (code_point & 0x3F));
+        } else {
+            *out++ = static_cast<uint8_t>(0xF0 | (code_point >> 18));
+            *out++ = static_cast<uint8_t>(0x80 | ((code_point >> 12) & 0x3F));
+            *out++ = static_cast<uint8_t>(0x80 | ((code_point >> 6) & 0x3F));
+            *out++ = static_cast<uint8_t>(0x80 | (code_point & 0x3F));
+        }
+    }
+    return true;
+}
+
+py::array string_array_from_objects(const ov::Tensor& t, const std::string* data) {
+    // Approach that is compact and faster than np.char.decode(tensor.data):
+    py::list _list;
+    for (size_t i = 0; i < t.get_size(); ++i) {
+        PyObject* _unicode_obj = PyUnicode_DecodeUTF8(&data[i][0], data[i].length(), "replace");
+        _list.append(_unicode_obj);
+        Py_XDECREF(_unicode_obj);
+    }
+    // Adjusting shape to follow the numpy convention:
+    py::array array(_list);
+    array.resize(t.get_shape());
+    return array;
+}
 }  // namespace
 
 py::array bytes_array_from_tensor(ov::Tensor&& t) {
@@ -165,17 +271,31 @@ py::array string_array_from_tensor(ov::Tensor&& t) {
     if (t.get_element_type() != ov::element::string) {
         OPENVINO_THROW("Tensor's type must be a string!");
     }
-    // Approach that is compact and faster than np.char.decode(tensor.data):
     auto data = t.data<std::string>();
-    py::list _list;
-    for (size_t i = 0; i < t.get_size(); ++i) {
-        PyObject* _unicode_obj = PyUnicode_DecodeUTF8(&data[i][0], data[i].length(), "replace");
-        _list.append(_unicode_obj);
-        Py_XDECREF(_unicode_obj);
+    const auto size = t.get_size();
+    // The strings are decoded directly to the fixed width items of the numpy array, without a Python object per string.
+    // The invalid UTF-8 sequences are left to Python to be replaced.
+    size_t max_length = 0;
+    for (size_t i = 0; i < size; ++i) {
+        size_t length = 0;
+        if (!decode_utf8(data[i], nullptr, length)) {
+            return string_array_from_objects(t, data);
+        }
+        max_length = std::max(max_length, length);
+    }
+    if (size == 0) {
+        return string_array_from_objects(t, data);
+    }
+
+    // numpy does not create the zero width strings
+    max_length = std::max<size_t>(max_length, 1);
+    auto array = py::array(py::dtype("U" + std::to_string(max_length)), t.get_shape());
+    auto ptr = reinterpret_cast<uint32_t*>(array.mutable_data());
+    for (size_t i = 0; i < size; ++i, ptr += max_length) {
+        size_t length = 0;
+        decode_utf8(data[i], ptr, length);
+        std::fill(ptr + length, ptr + max_length, 0);
     }
-    // Adjusting shape to follow the numpy convention:
-    py::array array(_list);
-    array.resize(t.get_shape());
     return array;
 }
 
@@ -188,7 +308,7 @@ void fill_tensor_from_bytes(ov::Tensor& tensor, py::array& array) {
     for (size_t i = 0; i < tensor.get_size(); ++i) {
         const char* ptr = reinterpret_cast<const char*>(buf.ptr) + (i * buf.itemsize);
         auto first_not_null = find_last_not_null(ptr, buf.itemsize);
-        data[i] = std::string(ptr, first_not_null);
+        data[i].assign(ptr, first_not_null);
     }
 }
 
@@ -202,7 +322,10 @@ void fill_tensor_from_strings(ov::Tensor& tensor, py::array& array) {
 
     for (auto a_first = reinterpret_cast<const uint8_t*>(buf.ptr), a_last = a_first + array.nbytes(); a_first < a_last;
          a_first += array.itemsize(), ++data) {
-        // TODO: check other unicode kinds? 2BYTE and 1BYTE?
+        // The code points are encoded in place of the tensor's string, Python handles the surrogates.
+        if (encode_utf8(a_first, array.itemsize() / 4, *data)) {
+            continue;
+        }
         auto _unicode_obj = PyUnicode_FromKindAndData(PyUnicode_4BYTE_KIND, a_first, array.itemsize() / 4);
 
         Py_ssize_t utf8_size = 0;
@@ -213,6 +336,63 @@ void fill_tensor_from_strings(ov::Tensor& tensor, py::array& array) {
     }
 }
 
+py::tuple packed_arrays_from_tensor(ov::Tensor& t) {
+    if (t.get_element_type() != ov::element::string) {
+        OPENVINO_THROW("Tensor's type must be a string!");
+    }
+    auto data = t.data<std::string>();
+    const auto size = t.get_size();
+    size_t chars_size = 0;
+    for (size_t i = 0; i < size; ++i) {
+        chars_size += data[i].length();
+    }
+    if (chars_size > static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+        OPENVINO_THROW("Strings of the Tensor are too long to be packed with int32 offsets!");
+    }
+
+    // The layout of the StringTensorUnpack outputs:
+    py::array_t<int32_t> begins(t.get_shape());
+    py::array_t<int32_t> ends(t.get_shape());
+    py::array_t<uint8_t> chars(static_cast<py::ssize_t>(chars_size));
+    auto begins_ptr = begins.mutable_data();
+    auto ends_ptr = ends.mutable_data();
+    auto chars_ptr = chars.mutable_data();
+    int32_t offset = 0;
+    for (size_t i = 0; i < size; ++i) {
+        begins_ptr[i] = offset;
+        chars_ptr = std::copy(data[i].begin(), data[i].end(), chars_ptr);
+        offset += static_cast<int32_t>(data[i].length());
+        ends_ptr[i] = offset;
+    }
+    return py::make_tuple(begins, ends, chars);
+}
+
+void fill_tensor_from_packed(ov::Tensor& tensor, py::array& begins, py::array& ends, py::array& chars) {
+    if (tensor.get_element_type() != ov::element::string) {
+        OPENVINO_THROW("Tensor's type must be a string!");
+    }
+    const auto _begins = begins.cast<py::array_t<int32_t, py::array::c_style | py::array::forcecast>>();
+    const auto _ends = ends.cast<py::array_t<int32_t, py::array::c_style | py::array::forcecast>>();
+    const auto _chars = chars.cast<py::array_t<uint8_t, py::array::c_style | py::array::forcecast>>();
+    const auto size = tensor.get_size();
+    if (size != static_cast<size_t>(_begins.size()) || size != static_cast<size_t>(_ends.size())) {
+        OPENVINO_THROW("Passed begins and ends must have the same size (number of elements) as the Tensor!");
+    }
+    auto begins_ptr = _begins.data();
+    auto ends_ptr = _ends.data();
+    const auto chars_size = static_cast<size_t>(_chars.size());
+    for (size_t i = 0; i < size; ++i) {
+        if (begins_ptr[i] < 0 || begins_ptr[i] > ends_ptr[i] || static_cast<size_t>(ends_ptr[i]) > chars_size) {
+            OPENVINO_THROW("Passed begins and ends of the string ", i, " are out of the chars bounds!");
+        }
+    }
+    auto chars_ptr = reinterpret_cast<const char*>(_chars.data());
+    auto data = tensor.data<std::string>();
+    for (size_t i = 0; i < size; ++i) {
+        data[i].assign(chars_ptr + begins_ptr[i], chars_ptr + ends_ptr[i]);
+    }
+}
+
 void fill_string_tensor_data(ov::Tensor& tensor, py::array& array) {
     // More about character codes:
     // https://numpy.org/doc/stable/reference/arrays.scalars.html
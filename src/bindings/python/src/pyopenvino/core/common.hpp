@@ -71,6 +71,10 @@ void fill_tensor_from_strings(ov::Tensor& tensor, py::array& array);
 
 void fill_string_tensor_data(ov::Tensor& tensor, py::array& array);
 
+py::tuple packed_arrays_from_tensor(ov::Tensor& t);
+
+void fill_tensor_from_packed(ov::Tensor& tensor, py::array& begins, py::array& ends, py::array& chars);
+
 }; // namespace string_helpers
 
 // Helpers for numpy arrays
@@ -383,6 +383,37 @@ void regclass_Tensor(py::module m) {
             Tensor's shape is not changed by performing this operation!
         )");
 
+    cls.def_property(
+        "packed_string_data",
+        [](ov::Tensor& self) {
+            return Common::string_helpers::packed_arrays_from_tensor(self);
+        },
+        [](ov::Tensor& self, py::tuple& other) {
+            if (other.size() != 3) {
+                OPENVINO_THROW("Packed string data must be a tuple of begins, ends and chars!");
+            }
+            auto begins = py::array::ensure(other[0]);
+            auto ends = py::array::ensure(other[1]);
+            auto chars = py::array::ensure(other[2]);
+            if (!begins || !ends || !chars) {
+                OPENVINO_THROW("Invalid data to fill String Tensor!");
+            }
+            Common::string_helpers::fill_tensor_from_packed(self, begins, ends, chars);
+        },
+        R"(
+            Access to Tensor's data with string Type in the packed form of the StringTensorUnpack outputs.
+
+            Getter returns a tuple of `begins` and `ends` numpy arrays of int32 with Tensor's shape
+            and a flat `chars` numpy array of uint8 with all the strings encoded in UTF-8,
+            the i-th string is `chars[begins[i]:ends[i]]`.
+            Warning: Data of string type is always a copy of underlaying memory!
+
+            Setter fills underlaying Tensor's memory by copying strings from the `(begins, ends, chars)` tuple
+            without creating a Python object per string.
+            `begins` and `ends` must have the same size (number of elements) as the Tensor.
+            Tensor's shape is not changed by performing this operation!
+        )");
+
     cls.def("get_shape",
             &ov::Tensor::get_shape,
             R"(
@@ -291,3 +291,33 @@ def test_invalid_bytes_replaced():
     check_bytes_based(tensor, string_data, to_flat=True)
     # Decoded:
     check_string_based(tensor, np.char.decode(string_data, encoding="utf=8", errors="replace"), to_flat=True)
+
+
+@pytest.mark.parametrize(
+    ("string_data"),
+    [
+        (np.array(["text", "", "openvino"])),
+        (np.array([["jeszcze więcej słów"], ["효과가 있었어"]])),
+        (np.array([[b"text\0with\0null"], [b"openvino"]])),
+    ],
+)
+def test_packed_string_data(string_data):
+    tensor = ov.Tensor(string_data, shared_memory=False)
+    begins, ends, chars = tensor.packed_string_data
+    encoded_data = string_data if string_data.dtype.kind == "S" else np.char.encode(string_data)
+    assert begins.shape == string_data.shape
+    assert ends.shape == string_data.shape
+    assert chars.dtype == np.uint8
+    for begin, end, expected in zip(begins.flatten(), ends.flatten(), encoded_data.flatten()):
+        assert chars[begin:end].tobytes() == expected
+
+    packed_tensor = ov.Tensor(type=ov.Type.string, shape=ov.Shape(list(string_data.shape)))
+    packed_tensor.packed_string_data = (begins, ends, chars)
+    check_bytes_based(packed_tensor, encoded_data)
+
+
+def test_packed_string_data_out_of_bounds():
+    tensor = ov.Tensor(type=ov.Type.string, shape=ov.Shape([2]))
+    with pytest.raises(RuntimeError) as e:
+        tensor.packed_string_data = (np.array([0, 3]), np.array([3, 5]), np.frombuffer(b"text", dtype=np.uint8))
+    assert "out of the chars bounds" in str(e.value)
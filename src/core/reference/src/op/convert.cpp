@@ -4,6 +4,7 @@
 
 #include "openvino/reference/convert.hpp"
 
+#include "openvino/core/parallel.hpp"
 #include "openvino/reference/utils/convert_util.hpp"
 
 #ifdef OV_CORE_USE_XBYAK_JIT
@@ -479,7 +480,7 @@ public:
 #endif  // OV_CORE_USE_XBYAK_JIT
 
 template <class Clamp, typename TI, typename TO>
-void convert_impl(const TI* arg, TO* out, size_t count) {
+void convert_chunk(const TI* arg, TO* out, size_t count) {
 #ifdef OV_CORE_USE_XBYAK_JIT
     if (util::may_i_use_dynamic_code()) {
         if (auto converter = jit_convert_array::get<TI, TO, Clamp::enabled>()) {
@@ -491,6 +492,23 @@ void convert_impl(const TI* arg, TO* out, size_t count) {
 #endif  // OV_CORE_USE_XBYAK_JIT
     Converter<TI, TO>::template apply<Clamp>(arg, out, count);
 }
+
+// The large arrays (e.g. the compressed weights converted by the constant folding) are split between the threads,
+// the smaller ones are not worth the threading overhead.
+constexpr size_t parallel_convert_threshold = 1 << 16;
+
+template <class Clamp, typename TI, typename TO>
+void convert_impl(const TI* arg, TO* out, size_t count) {
+    if (count < parallel_convert_threshold) {
+        convert_chunk<Clamp>(arg, out, count);
+        return;
+    }
+    ov::parallel_nt_static(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        ov::splitter(count, nthr, ithr, start, end);
+        convert_chunk<Clamp>(arg + start, out + start, end - start);
+    });
+}
 }  // namespace
 
 template <>
@@ -4,8 +4,12 @@
 
 #include "openvino/pass/constant_folding.hpp"
 
+#include <exception>
+#include <unordered_set>
+
 #include "openvino/cc/pass/itt.hpp"
 #include "openvino/core/constant_fold_utils.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/rt_info.hpp"
 #include "openvino/core/rt_info/weightless_caching_attributes.hpp"
 #include "openvino/op/constant.hpp"
@@ -101,41 +105,34 @@ static void remove_requires_precision_conversion_attribute(const std::shared_ptr
     }
 }
 
+namespace {
+// The node with the constant inputs: the node of the model and the node evaluated instead of it, which may differ
+// when the node is evaluated in the supported precision.
+struct FoldingCandidate {
+    std::shared_ptr<ov::Node> original_node;
+    std::shared_ptr<ov::Node> node;
+    ov::OutputVector replacements;
+    bool folded = false;
+    std::exception_ptr error;
+};
+}  // namespace
+
 bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& model) {
     RUN_ON_MODEL_SCOPE(ConstantFolding);
 
     bool rewritten = pre_calculated_values_folding(model);
 
-    for (const auto& original_node : model->get_ordered_ops()) {
-        auto node = original_node;
-        if (!original_node->can_constant_fold(original_node->input_values())) {
-            if (auto sub_graph_node = ov::as_type_ptr<ov::op::util::MultiSubGraphOp>(node)) {
-                // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
-                size_t sub_graphs_num = sub_graph_node->get_internal_subgraphs_size();
-                for (size_t sub_graph_ind = 0; sub_graph_ind < sub_graphs_num; ++sub_graph_ind) {
-                    rewritten =
-                        run_on_model(sub_graph_node->get_function(static_cast<int>(sub_graph_ind))) || rewritten;
-                }
-            }
-            rewritten = restore_original_input_precision(original_node) || rewritten;
-            if (rewritten) {
-                original_node->validate_and_infer_types();
-            }
-            continue;
-        }
-        if (node_has_requires_precision_conversion_attribute(node)) {
-            remove_requires_precision_conversion_attribute(node);
-            node = util::convert_to_supported_precision(node.get());
-        } else {
-            rewritten = restore_original_input_precision(node) || rewritten;
-        }
-
-        if (rewritten) {
-            node->validate_and_infer_types();
-        }
-
-        OutputVector replacements(node->get_output_size());
-        if (node->constant_fold(replacements, node->input_values())) {
+    // The nodes with the constant inputs are evaluated in batches in parallel. A batch is evaluated and replaced with
+    // the constants before any node consuming the outputs of its nodes is visited, and the model is only modified
+    // serially in the topological order, so the result is the same as for the node by node folding.
+    std::vector<FoldingCandidate> batch;
+    std::unordered_set<const Node*> batch_nodes;
+
+    auto apply_folding = [&](FoldingCandidate& candidate) {
+        const auto& original_node = candidate.original_node;
+        const auto& node = candidate.node;
+        const auto& replacements = candidate.replacements;
+        if (candidate.folded) {
             OPENVINO_ASSERT(!constant_folding_is_disabled(original_node),
                             "Node folded but constant folding disabled. Check constant_fold implementation for ",
                             node);
@@ -169,7 +166,77 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& m
                 rewritten = true;
             }
         }
+    };
+
+    auto fold_batch = [&]() {
+        // the evaluation only reads the input constants and creates the new nodes
+        ov::parallel_for(batch.size(), [&](size_t i) {
+            auto& candidate = batch[i];
+            try {
+                const auto& node = candidate.node;
+                candidate.folded = node->constant_fold(candidate.replacements, node->input_values());
+            } catch (...) {
+                candidate.error = std::current_exception();
+            }
+        });
+        for (auto& candidate : batch) {
+            if (candidate.error) {
+                std::rethrow_exception(candidate.error);
+            }
+            apply_folding(candidate);
+        }
+        batch.clear();
+        batch_nodes.clear();
+    };
+
+    for (const auto& original_node : model->get_ordered_ops()) {
+        const auto depends_on_batch = std::any_of(original_node->inputs().begin(),
+                                                  original_node->inputs().end(),
+                                                  [&](const Input<Node>& input) {
+                                                      return batch_nodes.count(input.get_source_output().get_node());
+                                                  });
+        if (depends_on_batch) {
+            fold_batch();
+        }
+
+        auto node = original_node;
+        if (!original_node->can_constant_fold(original_node->input_values())) {
+            if (auto sub_graph_node = ov::as_type_ptr<ov::op::util::MultiSubGraphOp>(node)) {
+                // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
+                size_t sub_graphs_num = sub_graph_node->get_internal_subgraphs_size();
+                for (size_t sub_graph_ind = 0; sub_graph_ind < sub_graphs_num; ++sub_graph_ind) {
+                    rewritten =
+                        run_on_model(sub_graph_node->get_function(static_cast<int>(sub_graph_ind))) || rewritten;
+                }
+            }
+            rewritten = restore_original_input_precision(original_node) || rewritten;
+            if (rewritten) {
+                original_node->validate_and_infer_types();
+            }
+            continue;
+        }
+        if (node_has_requires_precision_conversion_attribute(node)) {
+            remove_requires_precision_conversion_attribute(node);
+            node = util::convert_to_supported_precision(node.get());
+        } else {
+            rewritten = restore_original_input_precision(node) || rewritten;
+        }
+
+        if (rewritten) {
+            node->validate_and_infer_types();
+        }
+
+        FoldingCandidate candidate{original_node, node, OutputVector(node->get_output_size())};
+        if (node->get_input_size() == 0) {
+            // nothing to evaluate in parallel (e.g. Parameter), the consumers do not have to wait for the batch
+            candidate.folded = node->constant_fold(candidate.replacements, node->input_values());
+            apply_folding(candidate);
+            continue;
+        }
+        batch.push_back(std::move(candidate));
+        batch_nodes.insert(original_node.get());
     }
+    fold_batch();
 
     return rewritten;
 }
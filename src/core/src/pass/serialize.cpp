@@ -145,7 +145,7 @@ public:
             // the same hash for {2, 2} and {0, 128} arrays.
             // But even strong hashing algorithms sometimes give collisions.
             // Therefore we always have to compare values when finding a match in the hash multimap.
-            const HashValue hash = ov::runtime::compute_hash(ptr_to_write, new_size);
+            const HashValue hash = get_hash(ptr_to_write, new_size);
 
             auto found = m_hash_to_file_positions.equal_range(hash);
             // iterate over all matches of the key in the multimap
@@ -168,7 +168,50 @@ public:
         return offset;
     }
 
+    // Computes the hashes of the constants of the model (and of its bodies) on the multiple threads, so the sequential
+    // writing only looks them up. The constants compressed to fp16 on the fly are hashed by write() as before, the
+    // written data and the deduplication do not depend on the precomputation.
+    void precompute_hashes(const ov::Model& model) {
+        if (!m_enable_compression) {
+            return;
+        }
+        std::vector<std::pair<const void*, size_t>> buffers;
+        collect_buffers(model, buffers);
+
+        std::vector<HashValue> hashes(buffers.size());
+        ov::parallel_for(buffers.size(), [&](size_t i) {
+            hashes[i] = ov::runtime::compute_hash(buffers[i].first, buffers[i].second);
+        });
+        for (size_t i = 0; i < buffers.size(); ++i) {
+            m_precomputed_hashes[buffers[i].first] = {buffers[i].second, hashes[i]};
+        }
+    }
+
 private:
+    HashValue get_hash(const char* ptr, size_t size) const {
+        const auto found = m_precomputed_hashes.find(ptr);
+        if (found != m_precomputed_hashes.end() && found->second.first == size) {
+            return found->second.second;
+        }
+        return ov::runtime::compute_hash(ptr, size);
+    }
+
+    static void collect_buffers(const ov::Model& model, std::vector<std::pair<const void*, size_t>>& buffers) {
+        for (const auto& node : model.get_ops()) {
+            if (const auto constant = ov::as_type<ov::op::v0::Constant>(node.get())) {
+                // the string constants are written element by element
+                if (constant->get_element_type() != ov::element::string && constant->get_byte_size() != 0 &&
+                    !is_fp16_compression_postponed(constant->get_rt_info())) {
+                    buffers.emplace_back(constant->get_data_ptr(), constant->get_byte_size());
+                }
+            } else if (const auto multi_subgraph = ov::as_type<ov::op::util::MultiSubGraphOp>(node.get())) {
+                for (const auto& body : multi_subgraph->get_functions()) {
+                    collect_buffers(*body, buffers);
+                }
+            }
+        }
+    }
+
     static std::unique_ptr<char[]> compress_data_to_fp16(const char* ptr,
                                                          size_t size,
                                                          ov::element::Type src_type,
@@ -206,6 +249,8 @@ private:
     }
 
     ConstWritePositions m_hash_to_file_positions;
+    // data pointer -> its size and hash
+    std::unordered_map<const void*, std::pair<size_t, HashValue>> m_precomputed_hashes;
     std::ostream& m_binary_output;
     bool m_enable_compression;
     bool m_write_hash_value = false;
@@ -1268,6 +1313,7 @@ void serializeFunc(std::ostream& xml_file,
     pugi::xml_document xml_doc;
     pugi::xml_node net_node = xml_doc.append_child(name.c_str());
     ConstantWriter constant_write_handler(bin_file);
+    constant_write_handler.precompute_hashes(*model);
     XmlSerializer visitor(net_node, name, constant_write_handler, version, deterministic);
     visitor.on_attribute(name, model);
 
@@ -1296,7 +1342,12 @@ bool pass::Serialize::run_on_model(const std::shared_ptr<ov::Model>& model) {
     } else {
         ov::util::create_directory_recursive(m_xmlPath);
 
-        std::ofstream bin_file(m_binPath, std::ios::binary);
+        // the small constants are coalesced into the large writes, the big ones are written by the stream directly
+        constexpr size_t bin_buffer_size = 4 * 1024 * 1024;
+        std::vector<char> bin_buffer(bin_buffer_size);
+        std::ofstream bin_file;
+        bin_file.rdbuf()->pubsetbuf(bin_buffer.data(), bin_buffer.size());
+        bin_file.open(m_binPath, std::ios::binary);
         OPENVINO_ASSERT(bin_file, "Can't open bin file: \"", m_binPath, "\"");
 
         // create xml file
@@ -1392,6 +1443,7 @@ bool pass::StreamSerialize::run_on_model(const std::shared_ptr<ov::Model>& model
     pugi::xml_document xml_doc;
     pugi::xml_node net_node = xml_doc.append_child(name.c_str());
     ConstantWriter constant_write_handler(m_stream);
+    constant_write_handler.precompute_hashes(*model);
     XmlSerializer visitor(net_node, name, constant_write_handler, version);
     std::shared_ptr<ov::Model> fun = model;
     visitor.on_attribute(name, fun);
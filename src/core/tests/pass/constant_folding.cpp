@@ -659,6 +659,46 @@ TEST(constant_folding, const_convert) {
     }
 }
 
+TEST(constant_folding, independent_decompression_subgraphs) {
+    // the branches are folded in parallel, the large ones are converted by several threads
+    constexpr size_t branches = 8;
+    const Shape shape{300, 300};
+    auto data = make_shared<op::v0::Parameter>(element::f32, shape);
+
+    ResultVector results;
+    for (size_t i = 0; i < branches; i++) {
+        auto weights = op::v0::Constant::create(element::f16, shape, {static_cast<float>(i)});
+        auto convert = make_shared<op::v0::Convert>(weights, element::f32);
+        auto scale = op::v0::Constant::create(element::f32, Shape{}, {0.5f});
+        auto multiply = make_shared<op::v1::Multiply>(convert, scale);
+        multiply->set_friendly_name("dequantize_" + std::to_string(i));
+        results.push_back(make_shared<op::v0::Result>(multiply));
+    }
+    // depends on the folded branches, the data path is not folded
+    auto sum = make_shared<op::v1::Add>(results[0]->input_value(0), results[1]->input_value(0));
+    sum->set_friendly_name("sum");
+    results.push_back(make_shared<op::v0::Result>(sum));
+    results.push_back(make_shared<op::v0::Result>(make_shared<op::v1::Add>(data, results[2]->input_value(0))));
+
+    auto model = make_shared<Model>(results, ParameterVector{data});
+    run_constant_folding(model);
+
+    ASSERT_EQ(count_ops_of_type<op::v0::Convert>(model), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Multiply>(model), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Add>(model), 1);
+    for (size_t i = 0; i < branches; i++) {
+        auto folded = get_result_constant(model, i);
+        ASSERT_TRUE(folded);
+        EXPECT_EQ(folded->get_friendly_name(), "dequantize_" + std::to_string(i));
+        EXPECT_EQ(folded->get_shape(), shape);
+        EXPECT_EQ(folded->cast_vector<float>(), std::vector<float>(shape_size(shape), 0.5f * i));
+    }
+    auto folded_sum = get_result_constant(model, branches);
+    ASSERT_TRUE(folded_sum);
+    EXPECT_EQ(folded_sum->get_friendly_name(), "sum");
+    EXPECT_EQ(folded_sum->cast_vector<float>(), std::vector<float>(shape_size(shape), 0.5f));
+}
+
 TEST(constant_folding, shape_of_v0) {
     Shape input_shape{3, 4, 0, 22, 608, 909, 3};
 
@@ -5,10 +5,14 @@
 #include <gtest/gtest.h>
 
 #include <fstream>
+#include <numeric>
 
 #include "common_test_utils/common_utils.hpp"
 #include "common_test_utils/graph_comparator.hpp"
 #include "common_test_utils/test_common.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/loop.hpp"
+#include "openvino/op/parameter.hpp"
 #include "openvino/pass/serialize.hpp"
 #include "openvino/runtime/core.hpp"
 #include "transformations/common_optimizations/compress_float_constants.hpp"
@@ -382,3 +386,47 @@ TEST_F(SerializationConstantCompressionTest, EmptyAndNotEmptyConstantsDifferentV
     std::tie(success, message) = compare_functions(model_initial, model_imported, true, true, false, true, true);
     ASSERT_TRUE(success) << message;
 }
+
+TEST_F(SerializationConstantCompressionTest, IdenticalLargeConstantsInsideBody) {
+    // the hashes of the large constants are precomputed in parallel, including the ones of the Loop body
+    const ov::Shape shape{512, 1024};
+    std::vector<float> values(ov::shape_size(shape));
+    std::iota(values.begin(), values.end(), 0.0f);
+    const std::vector<float> other_values(values.rbegin(), values.rend());
+
+    auto body_param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+    auto body_const = ov::op::v0::Constant::create(ov::element::f32, shape, values);
+    auto body_add = std::make_shared<ov::op::v1::Add>(body_param, body_const);
+    auto body_cond = ov::op::v0::Constant::create(ov::element::boolean, ov::Shape{}, {true});
+    auto body = std::make_shared<ov::Model>(ov::OutputVector{body_cond, body_add}, ov::ParameterVector{body_param});
+
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+    auto trip_count = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{}, {1});
+    auto exec_cond = ov::op::v0::Constant::create(ov::element::boolean, ov::Shape{}, {true});
+    auto loop = std::make_shared<ov::op::v5::Loop>(trip_count, exec_cond);
+    loop->set_function(body);
+    loop->set_special_body_ports({-1, 0});
+    loop->set_invariant_input(body_param, param);
+    auto loop_out = loop->get_iter_value(body_add, -1);
+
+    auto A = ov::op::v0::Constant::create(ov::element::f32, shape, values);
+    auto B = ov::op::v0::Constant::create(ov::element::f32, shape, other_values);
+    auto model_initial =
+        std::make_shared<ov::Model>(ov::OutputVector{loop_out, A, B}, ov::ParameterVector{param});
+
+    ov::pass::Serialize(m_out_xml_path_1, m_out_bin_path_1).run_on_model(model_initial);
+
+    std::ifstream xml_1(m_out_xml_path_1, std::ios::binary);
+    std::ifstream bin_1(m_out_bin_path_1, std::ios::binary);
+
+    // A is the same as the body constant, the body condition is the same as the loop one
+    ASSERT_EQ(file_size(bin_1), 2 * ov::shape_size(shape) * sizeof(float) + sizeof(int64_t) + sizeof(char));
+
+    ov::Core core;
+    auto model_imported = core.read_model(m_out_xml_path_1, m_out_bin_path_1);
+
+    bool success;
+    std::string message;
+    std::tie(success, message) = compare_functions(model_initial, model_imported, true, true, false, true, true);
+    ASSERT_TRUE(success) << message;
+}
@@ -8,6 +8,7 @@
 #include <onnx/shape_inference/implementation.h>
 
 #include <fstream>
+#include <limits>
 #include <stack>
 
 #include "detail/subgraph_extraction.hpp"
@@ -18,6 +19,7 @@
 #include "openvino/util/log.hpp"
 #include "utils/common.hpp"
 #include "utils/onnx_internal.hpp"
+#include "utils/tensor_external_data.hpp"
 
 using namespace ov;
 using namespace ov::frontend::onnx;
@@ -300,6 +302,8 @@ struct ONNXModelEditor::Impl {
     std::shared_ptr<ModelProto> m_model_proto;
     EdgeMapper m_edge_mapper;
     bool m_is_mapper_updated = false;
+    // set if the initializers reference the mapped model file
+    std::shared_ptr<ov::MappedMemory> m_mapped_model;
 
     Impl() = delete;
 
@@ -307,13 +311,47 @@ struct ONNXModelEditor::Impl {
         graph_topological_sort(m_model_proto->mutable_graph());
     }
 
-    Impl(const std::string& model_path) : Impl(std::make_shared<ModelProto>(parse_from_file(model_path))) {}
+    /// \brief With mmap enabled the model is parsed from the mapped file and the large initializers keep referencing
+    /// the mapping, instead of being copied to the ModelProto and then to the Constants
+    Impl(const std::string& model_path, const detail::MappedMemoryHandles& mmap_cache) {
+        std::shared_ptr<ov::MappedMemory> mapped_model;
+        if (mmap_cache) {
+            try {
+                mapped_model = ov::load_mmap_object(model_path);
+            } catch (const std::exception&) {
+                // the regular parsing reports the error
+            }
+        }
+        if (mapped_model && mapped_model->size() <= static_cast<size_t>(std::numeric_limits<int>::max())) {
+            m_model_proto = std::make_shared<ModelProto>();
+            const auto size = static_cast<int>(mapped_model->size());
+            OPENVINO_ASSERT(m_model_proto->ParseFromArray(mapped_model->data(), size),
+                            "Error during import of ONNX model from file: ",
+                            model_path);
+            if (detail::map_inline_data(*m_model_proto, model_path, mapped_model, mmap_cache) > 0) {
+                m_mapped_model = std::move(mapped_model);
+            }
+        } else {
+            m_model_proto = std::make_shared<ModelProto>(parse_from_file(model_path));
+        }
+        graph_topological_sort(m_model_proto->mutable_graph());
+    }
 
     Impl(std::istream& model_stream) : Impl(std::make_shared<ModelProto>(parse_from_istream(model_stream))) {}
 
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
     Impl(const std::wstring& model_path) : Impl(std::make_shared<ModelProto>(parse_from_file(model_path))) {}
 #endif
+
+    /// \brief Returns the model with the data of all initializers embedded
+    std::shared_ptr<ModelProto> self_contained_model() const {
+        if (!m_mapped_model) {
+            return m_model_proto;
+        }
+        auto model_proto = std::make_shared<ModelProto>(*m_model_proto);
+        detail::restore_inline_data(*model_proto, *m_mapped_model);
+        return model_proto;
+    }
 };
 
 ONNXModelEditor::ONNXModelEditor(const std::string& model_path,
@@ -323,7 +361,7 @@ ONNXModelEditor::ONNXModelEditor(const std::string& model_path,
       m_mmap_cache{enable_mmap ? std::make_shared<std::map<std::string, std::shared_ptr<ov::MappedMemory>>>()
                                : nullptr},
       m_extensions{std::move(extensions)},
-      m_pimpl{new ONNXModelEditor::Impl{model_path}, [](Impl* impl) {
+      m_pimpl{new ONNXModelEditor::Impl{model_path, m_mmap_cache}, [](Impl* impl) {
                   delete impl;
               }} {}
 
@@ -369,7 +407,7 @@ void ONNXModelEditor::serialize(const std::string& out_file_path) const {
 
     OPENVINO_ASSERT(out_file.is_open(), "Could not open the file: ", out_file_path);
 
-    OPENVINO_ASSERT(m_pimpl->m_model_proto->SerializeToOstream(&out_file),
+    OPENVINO_ASSERT(m_pimpl->self_contained_model()->SerializeToOstream(&out_file),
                     "Could not serialize the model to: ",
                     out_file_path);
     out_file.close();
@@ -538,7 +576,7 @@ bool ONNXModelEditor::is_output(const OutputEdge& edge) const {
 }
 
 std::string ONNXModelEditor::model_string() const {
-    return m_pimpl->m_model_proto->SerializeAsString();
+    return m_pimpl->self_contained_model()->SerializeAsString();
 }
 
 std::shared_ptr<Model> ONNXModelEditor::get_function() const {
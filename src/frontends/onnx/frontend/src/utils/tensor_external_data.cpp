@@ -4,8 +4,10 @@
 
 #include "utils/tensor_external_data.hpp"
 
+#include <algorithm>
 #include <fstream>
 #include <sstream>
+#include <vector>
 
 #include "exceptions.hpp"
 #include "openvino/util/file_util.hpp"
@@ -15,6 +17,133 @@ namespace ov {
 namespace frontend {
 namespace onnx {
 namespace detail {
+namespace {
+// the smaller tensors (i.e. the shapes and axes) stay in the ModelProto
+constexpr uint64_t min_mapped_size = 1024;
+
+// field numbers from onnx.proto
+constexpr uint32_t model_graph_field = 7;
+constexpr uint32_t graph_initializer_field = 5;
+constexpr uint32_t tensor_raw_data_field = 9;
+
+enum WireType : uint32_t { VARINT = 0, FIXED64 = 1, LENGTH_DELIMITED = 2, FIXED32 = 5 };
+
+struct ByteRange {
+    uint64_t offset = 0;
+    uint64_t length = 0;
+};
+
+bool read_varint(const uint8_t*& ptr, const uint8_t* end, uint64_t& value) {
+    value = 0;
+    for (uint32_t shift = 0; ptr < end && shift < 64; shift += 7) {
+        const uint8_t byte = *ptr++;
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/// \brief Calls on_message(field number, begin, end) for each length-delimited field of the message in [ptr, end)
+///
+/// \return false if the message is malformed or uses the deprecated groups
+template <class OnMessage>
+bool for_each_length_delimited(const uint8_t* ptr, const uint8_t* end, OnMessage&& on_message) {
+    while (ptr < end) {
+        uint64_t tag = 0;
+        if (!read_varint(ptr, end, tag)) {
+            return false;
+        }
+        uint64_t value = 0;
+        switch (tag & 0x7) {
+        case VARINT:
+            if (!read_varint(ptr, end, value)) {
+                return false;
+            }
+            break;
+        case FIXED64:
+            if (end - ptr < 8) {
+                return false;
+            }
+            ptr += 8;
+            break;
+        case FIXED32:
+            if (end - ptr < 4) {
+                return false;
+            }
+            ptr += 4;
+            break;
+        case LENGTH_DELIMITED:
+            if (!read_varint(ptr, end, value) || value > static_cast<uint64_t>(end - ptr)) {
+                return false;
+            }
+            if (!on_message(static_cast<uint32_t>(tag >> 3), ptr, ptr + value)) {
+                return false;
+            }
+            ptr += value;
+            break;
+        default:
+            return false;
+        }
+    }
+    return true;
+}
+
+/// \brief Finds raw_data of the main graph initializers, in the order of ModelProto::graph().initializer()
+bool find_initializers_raw_data(const uint8_t* begin, const uint8_t* end, std::vector<ByteRange>& ranges) {
+    const auto on_tensor = [&](uint32_t field, const uint8_t* tensor, const uint8_t* tensor_end) {
+        if (field != graph_initializer_field) {
+            return true;
+        }
+        ByteRange range;
+        // the last occurrence of the field wins, as in protobuf parser
+        const auto on_field = [&](uint32_t field, const uint8_t* data, const uint8_t* data_end) {
+            if (field == tensor_raw_data_field) {
+                range = {static_cast<uint64_t>(data - begin), static_cast<uint64_t>(data_end - data)};
+            }
+            return true;
+        };
+        const bool valid = for_each_length_delimited(tensor, tensor_end, on_field);
+        ranges.push_back(range);
+        return valid;
+    };
+    return for_each_length_delimited(begin, end, [&](uint32_t field, const uint8_t* graph, const uint8_t* graph_end) {
+        return field != model_graph_field || for_each_length_delimited(graph, graph_end, on_tensor);
+    });
+}
+
+// the size of the element the raw data is aligned to, 0 for the types which are not mapped
+size_t get_element_size(int32_t data_type) {
+    switch (data_type) {
+    case TensorProto::BOOL:
+    case TensorProto::INT4:
+    case TensorProto::INT8:
+    case TensorProto::UINT4:
+    case TensorProto::UINT8:
+    case TensorProto::FLOAT8E4M3FN:
+    case TensorProto::FLOAT8E5M2:
+        return 1;
+    case TensorProto::BFLOAT16:
+    case TensorProto::FLOAT16:
+    case TensorProto::INT16:
+    case TensorProto::UINT16:
+        return 2;
+    case TensorProto::FLOAT:
+    case TensorProto::INT32:
+    case TensorProto::UINT32:
+        return 4;
+    case TensorProto::DOUBLE:
+    case TensorProto::INT64:
+    case TensorProto::UINT64:
+        return 8;
+    default:
+        return 0;
+    }
+}
+
+}  // namespace
+
 TensorExternalData::TensorExternalData(const TensorProto& tensor) {
     for (const auto& entry : tensor.external_data()) {
         if (entry.key() == "location") {
@@ -105,6 +234,77 @@ std::string TensorExternalData::to_string() const {
     }
     return s.str();
 }
+
+size_t map_inline_data(ModelProto& model_proto,
+                       const std::string& model_path,
+                       const std::shared_ptr<ov::MappedMemory>& mapped_model,
+                       MappedMemoryHandles cache) {
+    if (!model_proto.has_graph() || model_proto.graph().initializer_size() == 0) {
+        return 0;
+    }
+    const auto begin = reinterpret_cast<const uint8_t*>(mapped_model->data());
+    std::vector<ByteRange> ranges;
+    if (!find_initializers_raw_data(begin, begin + mapped_model->size(), ranges) ||
+        ranges.size() != static_cast<size_t>(model_proto.graph().initializer_size())) {
+        return 0;
+    }
+
+    const auto location = ov::util::get_file_name(model_path);
+    const auto model_dir = ov::util::get_directory(model_path).string();
+    const auto full_path = ov::util::get_absolute_file_path(ov::util::path_join({model_dir, location}).string());
+    size_t mapped_count = 0;
+    for (size_t i = 0; i < ranges.size(); ++i) {
+        auto* tensor = model_proto.mutable_graph()->mutable_initializer(static_cast<int>(i));
+        if (!tensor->has_raw_data() || tensor->raw_data().size() != ranges[i].length ||
+            ranges[i].length < min_mapped_size || tensor->has_segment() ||
+            (tensor->has_data_location() && tensor->data_location() == TensorProto::EXTERNAL)) {
+            continue;
+        }
+        // the Constant aliases the mapped data, so it must be aligned for the element type, the file is mapped from a
+        // page boundary
+        const auto element_size = get_element_size(tensor->data_type());
+        if (element_size == 0 || ranges[i].offset % element_size != 0) {
+            continue;
+        }
+        auto add_entry = [&](const std::string& key, const std::string& value) {
+            auto* entry = tensor->add_external_data();
+            entry->set_key(key);
+            entry->set_value(value);
+        };
+        add_entry("location", location);
+        add_entry("offset", std::to_string(ranges[i].offset));
+        add_entry("length", std::to_string(ranges[i].length));
+        add_entry(INLINE_DATA_KEY, "1");
+        tensor->set_data_location(TensorProto::EXTERNAL);
+        // clear_raw_data() keeps the capacity of the string, while the copy of the data has to be released
+        std::string().swap(*tensor->mutable_raw_data());
+        tensor->clear_raw_data();
+        ++mapped_count;
+    }
+    if (mapped_count > 0) {
+        (*cache)[full_path] = mapped_model;
+    }
+    return mapped_count;
+}
+
+void restore_inline_data(ModelProto& model_proto, ov::MappedMemory& mapped_model) {
+    if (!model_proto.has_graph()) {
+        return;
+    }
+    for (auto& tensor : *model_proto.mutable_graph()->mutable_initializer()) {
+        const auto& entries = tensor.external_data();
+        const bool is_inline = std::any_of(entries.begin(), entries.end(), [](const auto& entry) {
+            return entry.key() == INLINE_DATA_KEY;
+        });
+        if (!is_inline) {
+            continue;
+        }
+        const TensorExternalData data(tensor);
+        tensor.set_raw_data(mapped_model.data() + data.offset(), data.size());
+        tensor.clear_external_data();
+        tensor.clear_data_location();
+    }
+}
 }  // namespace detail
 }  // namespace onnx
 }  // namespace frontend
@@ -14,6 +14,7 @@ namespace ov {
 namespace frontend {
 namespace onnx {
 namespace detail {
+using ::ONNX_NAMESPACE::ModelProto;
 using ::ONNX_NAMESPACE::TensorProto;
 template <class T>
 using Buffer = std::shared_ptr<ov::SharedBuffer<std::shared_ptr<T>>>;
@@ -54,12 +55,42 @@ public:
         return m_data_length;
     }
 
+    /// \brief      Returns the offset of the data in the file in bytes
+    uint64_t offset() const {
+        return m_offset;
+    }
+
 private:
     std::string m_data_location{};
     uint64_t m_offset = 0;
     uint64_t m_data_length = 0;
     std::string m_sha1_digest{};
 };
+
+/// \brief      Key of the external data entry which marks the initializers redirected by map_inline_data
+constexpr const char* INLINE_DATA_KEY = "openvino.inline_raw_data";
+
+/// \brief      Redirects the raw_data of the main graph initializers into the mapped model file. The initializers
+///             are described as the external data located in the model file itself, so the Constants reference
+///             the mapping instead of the copies of the data, and their raw_data is released.
+///
+/// \note       The byte ranges are found by scanning the protobuf wire format of the mapped file, the model must be
+///             parsed from the same memory. Small tensors are left intact.
+///
+/// \param      model_proto   The model parsed from the mapped memory
+/// \param      model_path    Path to the model file
+/// \param      mapped_model  The mapped model file
+/// \param      cache         The mapped files, the model file is registered here
+///
+/// \return     Number of the redirected initializers
+size_t map_inline_data(ModelProto& model_proto,
+                       const std::string& model_path,
+                       const std::shared_ptr<ov::MappedMemory>& mapped_model,
+                       MappedMemoryHandles cache);
+
+/// \brief      Restores the raw_data of the initializers redirected by map_inline_data, i.e. before the model
+///             serialization
+void restore_inline_data(ModelProto& model_proto, ov::MappedMemory& mapped_model);
 }  // namespace detail
 }  // namespace onnx
 }  // namespace frontend
@@ -3,13 +3,17 @@
 //
 
 #include <gtest/gtest.h>
+#include <onnx/onnx_pb.h>
 
 #include <algorithm>
+#include <cstdio>
+#include <numeric>
 #include <fstream>
 #include <set>
 #include <streambuf>
 #include <string>
 
+#include "common_test_utils/common_utils.hpp"
 #include "common_test_utils/file_utils.hpp"
 #include "common_test_utils/test_case.hpp"
 #include "common_test_utils/unicode_utils.hpp"
@@ -331,4 +335,56 @@ TEST_P(OnnxFeMmapFixture, onnx_external_data_uint4) {
     test_case.run();
 }
 
+TEST_P(OnnxFeMmapFixture, onnx_inline_raw_data) {
+    // Add(A, B) where the initializer B is large enough to be mapped from the model file
+    ::ONNX_NAMESPACE::ModelProto model_proto;
+    model_proto.set_ir_version(7);
+    model_proto.add_opset_import()->set_version(13);
+    auto* graph = model_proto.mutable_graph();
+    graph->set_name("inline_raw_data");
+    auto add_value_info = [](::ONNX_NAMESPACE::ValueInfoProto* info, const string& name) {
+        info->set_name(name);
+        auto* tensor_type = info->mutable_type()->mutable_tensor_type();
+        tensor_type->set_elem_type(::ONNX_NAMESPACE::TensorProto::FLOAT);
+        tensor_type->mutable_shape()->add_dim()->set_dim_value(1024);
+    };
+    add_value_info(graph->add_input(), "A");
+    add_value_info(graph->add_output(), "C");
+    auto* add = graph->add_node();
+    add->set_op_type("Add");
+    add->add_input("A");
+    add->add_input("B");
+    add->add_output("C");
+
+    vector<float> data(1024);
+    iota(data.begin(), data.end(), 0.f);
+    auto* initializer = graph->add_initializer();
+    initializer->set_name("B");
+    initializer->set_data_type(::ONNX_NAMESPACE::TensorProto::FLOAT);
+    initializer->add_dims(data.size());
+    initializer->set_raw_data(data.data(), data.size() * sizeof(float));
+
+    const auto path = test::utils::generateTestFilePrefix() + "_inline_raw_data.onnx";
+    {
+        ofstream stream{path, ios::out | ios::binary};
+        ASSERT_TRUE(model_proto.SerializeToOstream(&stream));
+    }
+
+    {
+        // the model may reference the mapped file, it is released before the removal
+        Core core;
+        core.set_property(enable_mmap(GetParam()));
+        const auto model = core.read_model(path);
+        auto test_case = test::TestCase(model);
+        test_case.add_input<float>(vector<float>(data.size(), 1.f));
+        vector<float> expected(data.size());
+        transform(data.begin(), data.end(), expected.begin(), [](float value) {
+            return value + 1.f;
+        });
+        test_case.add_expected_output<float>(Shape{data.size()}, expected);
+        test_case.run();
+    }
+    remove(path.c_str());
+}
+
 INSTANTIATE_TEST_SUITE_P(OnnxFeMMapReadModel, OnnxFeMmapFixture, ::testing::Bool());
@@ -79,12 +79,14 @@ bool FrontEnd::supported_impl(const std::vector<ov::Any>& variants) const {
 ov::frontend::InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const {
     // Last boolean flag in `variants` (if presented) is reserved for FE configuration
     size_t extra_variants_num = variants.size() > 0 && variants[variants.size() - 1].is<bool>() ? 1 : 0;
+    // Enable mmap by default
+    bool mmap_enabled = extra_variants_num == 1 ? variants[variants.size() - 1].as<bool>() : true;
     if (variants.size() == 1 + extra_variants_num) {
         if (variants[0].is<std::string>()) {
             std::string model_path = variants[0].as<std::string>();
             if (GraphIteratorFlatBuffer::is_supported(model_path)) {
                 return std::make_shared<tensorflow_lite::InputModel>(
-                    std::make_shared<GraphIteratorFlatBuffer>(model_path),
+                    std::make_shared<GraphIteratorFlatBuffer>(model_path, mmap_enabled),
                     m_telemetry);
             }
         }
@@ -93,7 +95,7 @@ ov::frontend::InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& va
             std::wstring model_path = variants[0].as<std::wstring>();
             if (GraphIteratorFlatBuffer::is_supported(model_path)) {
                 return std::make_shared<tensorflow_lite::InputModel>(
-                    std::make_shared<GraphIteratorFlatBuffer>(model_path),
+                    std::make_shared<GraphIteratorFlatBuffer>(model_path, mmap_enabled),
                     m_telemetry);
             }
         }
@@ -15,6 +15,7 @@
 #include "openvino/frontend/tensorflow_lite/graph_iterator.hpp"
 #include "openvino/util/common_util.hpp"
 #include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "schema_generated.h"
 
 namespace ov {
@@ -39,6 +40,8 @@ std::basic_string<wchar_t> get_model_extension<wchar_t>();
 class GraphIteratorFlatBuffer : public GraphIterator {
     size_t node_index = 0;
     std::vector<uint8_t> m_data;
+    // the model file if it is mapped instead of being read to m_data
+    std::shared_ptr<ov::MappedMemory> m_mapped_memory;
     std::vector<ov::Any> m_nodes;
     const tflite::Model* m_model{};
     std::vector<const tflite::SubGraph*> m_subgraphs;
@@ -46,10 +49,10 @@ class GraphIteratorFlatBuffer : public GraphIterator {
 
 public:
     GraphIteratorFlatBuffer() = default;
-    explicit GraphIteratorFlatBuffer(const std::string& path);
+    explicit GraphIteratorFlatBuffer(const std::string& path, bool mmap_enabled = false);
 
 #ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
-    explicit GraphIteratorFlatBuffer(const std::wstring& path);
+    explicit GraphIteratorFlatBuffer(const std::wstring& path, bool mmap_enabled = false);
 #endif
 
     using Ptr = std::shared_ptr<GraphIteratorFlatBuffer>;
@@ -92,6 +95,12 @@ public:
         }
     }
 
+    /// \brief Returns the mapped model file or nullptr if the file is read to memory.
+    /// The tensor buffers of the model are stored inside the mapping, so the constants may reference them in place
+    std::shared_ptr<ov::MappedMemory> get_mapped_memory() const {
+        return m_mapped_memory;
+    }
+
     /// Set iterator to the start position
     void reset() override {
         node_index = 0;
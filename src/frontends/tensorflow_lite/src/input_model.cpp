@@ -4,12 +4,18 @@
 
 #include "input_model.hpp"
 
+#include <algorithm>
+#include <cstdint>
 #include <iterator>
 #include <queue>
 
+#include "graph_iterator_flatbuffer.hpp"
+#include "openvino/core/type/element_iterator.hpp"
 #include "openvino/frontend/exception.hpp"
 #include "openvino/opsets/opset10.hpp"
+#include "openvino/runtime/shared_buffer.hpp"
 #include "openvino/util/log.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "tensor_lite_place.hpp"
 #include "utils.hpp"
 
@@ -95,6 +101,9 @@ public:
 private:
     void load_model();
     void clean_up();
+    std::shared_ptr<ov::op::v0::Constant> create_constant(const ov::element::Type& type,
+                                                          const ov::Shape& shape,
+                                                          const void* data) const;
 
     std::vector<std::shared_ptr<OpPlace>> m_op_places;
     std::map<std::string, std::shared_ptr<OpPlace>> m_op_places_map;
@@ -107,8 +116,32 @@ private:
     const ov::frontend::InputModel& m_input_model;
     std::vector<std::shared_ptr<ov::frontend::tensorflow_lite::InputModel>> m_subgraphs;
     std::shared_ptr<TelemetryExtension> m_telemetry;
+    // the mapped model file which holds the tensor buffers, nullptr if the model is not mmaped
+    std::shared_ptr<ov::MappedMemory> m_mapped_memory;
 };
 
+std::shared_ptr<ov::op::v0::Constant> InputModel::InputModelTFLiteImpl::create_constant(const ov::element::Type& type,
+                                                                                       const ov::Shape& shape,
+                                                                                       const void* data) const {
+    // The buffer of the mapped model is referenced by the constant instead of being copied, unless it is the densified
+    // sparse tensor, which is allocated by the frontend, or its alignment does not fit the element type
+    if (m_mapped_memory && type != ov::element::string) {
+        const auto begin = reinterpret_cast<uintptr_t>(m_mapped_memory->data());
+        const auto end = begin + m_mapped_memory->size();
+        const auto ptr = reinterpret_cast<uintptr_t>(data);
+        const auto byte_size = ov::element::get_memory_size(type, ov::shape_size(shape));
+        const auto alignment = std::max<size_t>(type.size(), 1);
+        if (ptr >= begin && ptr <= end && byte_size <= end - ptr && ptr % alignment == 0) {
+            auto buffer = std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::MappedMemory>>>(
+                m_mapped_memory->data() + (ptr - begin),
+                byte_size,
+                m_mapped_memory);
+            return std::make_shared<ov::op::v0::Constant>(type, shape, buffer);
+        }
+    }
+    return ov::op::v0::Constant::create(type, shape, data);
+}
+
 void InputModel::InputModelTFLiteImpl::load_model() {
     std::map<std::string, uint64_t> op_statistics;  // for telemetry
 
@@ -145,9 +178,8 @@ void InputModel::InputModelTFLiteImpl::load_model() {
             if (m_tensor_places.count(name) == 0) {
                 m_tensor_places[name] = place;
                 if (auto data = place->get_data()) {
-                    auto constant = ov::op::v0::Constant::create(place->get_element_type(),
-                                                                 place->get_partial_shape().to_shape(),
-                                                                 data);
+                    auto constant =
+                        create_constant(place->get_element_type(), place->get_partial_shape().to_shape(), data);
                     constant->set_friendly_name(name);
                     m_tensor_values[name] = constant;
                 } else if (place->get_partial_shape() == PartialShape{0}) {  // empty constant
@@ -223,6 +255,9 @@ InputModel::InputModelTFLiteImpl::InputModelTFLiteImpl(const GraphIterator::Ptr&
     : m_graph_iterator(graph_iterator),
       m_input_model(input_model) {
     FRONT_END_GENERAL_CHECK(m_graph_iterator, "Null pointer specified for GraphIterator");
+    if (auto flatbuffer_iterator = std::dynamic_pointer_cast<GraphIteratorFlatBuffer>(m_graph_iterator)) {
+        m_mapped_memory = flatbuffer_iterator->get_mapped_memory();
+    }
     load_model();
 }
 
@@ -233,6 +268,9 @@ InputModel::InputModelTFLiteImpl::InputModelTFLiteImpl(const GraphIterator::Ptr&
       m_input_model(input_model),
       m_telemetry(telemetry) {
     FRONT_END_GENERAL_CHECK(m_graph_iterator, "Null pointer specified for GraphIterator");
+    if (auto flatbuffer_iterator = std::dynamic_pointer_cast<GraphIteratorFlatBuffer>(m_graph_iterator)) {
+        m_mapped_memory = flatbuffer_iterator->get_mapped_memory();
+    }
     load_model();
 }
 
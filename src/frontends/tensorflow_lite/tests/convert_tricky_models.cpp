@@ -2,6 +2,13 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <utility>
+
 #include "common_test_utils/file_utils.hpp"
 #include "common_test_utils/ov_test_utils.hpp"
 #include "common_test_utils/test_case.hpp"
@@ -10,7 +17,9 @@
 #include "common_test_utils/type_prop.hpp"
 #include "conversion_extension.hpp"
 #include "gtest/gtest.h"
+#include "openvino/op/constant.hpp"
 #include "tf_utils.hpp"
+#include "utils.hpp"
 
 using namespace ov;
 using namespace ov::frontend::tensorflow_lite::tests;
@@ -20,6 +29,27 @@ static std::string s_manifest = "";
 using Inputs = std::vector<std::vector<float>>;
 using Outputs = std::vector<std::vector<float>>;
 
+#ifdef __linux__
+// the address ranges the file is mapped to in the current process
+static std::vector<std::pair<uintptr_t, uintptr_t>> get_mapped_ranges(const std::string& path) {
+    const auto canonical_path = std::filesystem::canonical(path).string();
+    std::vector<std::pair<uintptr_t, uintptr_t>> ranges;
+    std::ifstream maps("/proc/self/maps");
+    for (std::string line; std::getline(maps, line);) {
+        std::istringstream fields(line);
+        std::string range, perms, offset, device, inode, mapped_path;
+        fields >> range >> perms >> offset >> device >> inode;
+        std::getline(fields >> std::ws, mapped_path);
+        if (mapped_path == canonical_path) {
+            const auto dash = range.find('-');
+            ranges.emplace_back(std::stoull(range.substr(0, dash), nullptr, 16),
+                                std::stoull(range.substr(dash + 1), nullptr, 16));
+        }
+    }
+    return ranges;
+}
+#endif
+
 OPENVINO_TEST(TensorFlowLiteTrickyModels, tflite_densify) {
     auto model = convert_model("densify.tflite");
 
@@ -28,3 +58,45 @@ OPENVINO_TEST(TensorFlowLiteTrickyModels, tflite_densify) {
     test_case.add_expected_output<float>(Shape{1, 2, 2, 4}, {2, 1, 0, 0, 0, 3, 1, 0, 0, 2, 0, 0, 2, 0, 1, 0});
     test_case.run();
 }
+
+OPENVINO_TEST(TensorFlowLiteTrickyModels, tflite_mmap_constants) {
+    ov::frontend::FrontEndManager fem;
+    auto front_end = fem.load_by_framework(TF_LITE_FE);
+    ASSERT_NE(front_end, nullptr);
+    const auto model_path =
+        FrontEndTestUtils::make_model_path(std::string(TEST_TENSORFLOW_LITE_MODELS_DIRNAME) + "dequantize.tflite");
+
+    // the constants of the mapped model reference the file, they must not differ from the copied ones
+    std::vector<std::shared_ptr<ov::Model>> models;
+    for (const bool mmap_enabled : {true, false}) {
+        auto input_model = front_end->load({model_path, mmap_enabled});
+        ASSERT_NE(input_model, nullptr);
+        models.push_back(front_end->convert(input_model));
+        ASSERT_NE(models.back(), nullptr);
+    }
+
+    const auto fc = FunctionsComparator::with_default()
+                        .enable(FunctionsComparator::PRECISIONS)
+                        .enable(FunctionsComparator::CONST_VALUES);
+    const auto res = fc.compare(models[0], models[1]);
+    EXPECT_TRUE(res.valid) << res.message;
+
+#ifdef __linux__
+    // the mapping is kept alive by the constants of the first model
+    const auto ranges = get_mapped_ranges(model_path);
+    ASSERT_FALSE(ranges.empty());
+    size_t mapped_constants = 0;
+    for (const auto& op : models[0]->get_ordered_ops()) {
+        if (const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(op)) {
+            const auto ptr = reinterpret_cast<uintptr_t>(constant->get_data_ptr());
+            for (const auto& [begin, end] : ranges) {
+                if (ptr >= begin && ptr < end) {
+                    ++mapped_constants;
+                    break;
+                }
+            }
+        }
+    }
+    EXPECT_GT(mapped_constants, 0u);
+#endif
+}
@@ -23,7 +23,8 @@ namespace threading {
  * @ingroup ov_dev_api_threading
  * @brief CPU Streams executor implementation. The executor splits the CPU into groups of threads,
  *        that can be pinned to cores or NUMA nodes.
- *        It uses custom threads to pull tasks from single queue.
+ *        It uses custom threads to pull tasks from the per thread queues, the idle threads steal the tasks from
+ *        the queues of the other threads, preferring the threads of the same NUMA node.
  */
 class OPENVINO_RUNTIME_API CPUStreamsExecutor : public IStreamsExecutor {
 public:
@@ -32,6 +33,16 @@ public:
      */
     using Ptr = std::shared_ptr<CPUStreamsExecutor>;
 
+    /**
+     * @brief Counters of the task queues of the executor threads
+     */
+    struct QueueStatistics {
+        size_t queued_tasks = 0;     //!< the number of tasks waiting in the queues
+        size_t max_queue_depth = 0;  //!< the maximum number of tasks observed in a single queue
+        size_t stolen_tasks = 0;     //!< the number of tasks executed by a thread other than the queue owner
+        size_t executed_tasks = 0;   //!< the number of tasks executed by the executor threads
+    };
+
     /**
      * @brief Constructor
      * @param config Stream executor parameters
@@ -59,6 +70,13 @@ public:
 
     void cpu_reset() override;
 
+    /**
+     * @brief Returns the counters of the task queues. The tasks executed in the caller thread (execute(), or run()
+     * of the executor without streams) are not counted.
+     * @return The task queues statistics
+     */
+    QueueStatistics get_queue_statistics() const;
+
 private:
     struct Impl;
     std::unique_ptr<Impl> _impl;
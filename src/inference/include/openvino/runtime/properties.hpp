@@ -876,6 +876,15 @@ static constexpr Property<uint32_t, PropertyMutability::RO> max_batch_size{"MAX_
  */
 static constexpr Property<uint32_t, PropertyMutability::RW> auto_batch_timeout{"AUTO_BATCH_TIMEOUT"};
 
+/**
+ * @brief Read-write property to set the target latency (in ms) for the adaptive collection of the inputs for the
+ * auto-batching. When set to a non-zero value, the ov::auto_batch_timeout is ignored: the wait deadline is derived from
+ * the observed arrival rate and execution latency, so the collected requests are executed either as a full batch or
+ * one by one in time to complete within the target. Zero (default) disables the adaptive mode.
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> auto_batch_latency_slo{"AUTO_BATCH_LATENCY_SLO"};
+
 /**
  * @brief Read-only property to provide a hint for a range for number of async infer requests. If device supports
  * streams, the metric provides range for number of IRs per stream.
@@ -4,8 +4,10 @@
 
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
 
+#include <algorithm>
 #include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <queue>
@@ -24,7 +26,47 @@
 
 namespace ov {
 namespace threading {
+namespace {
+// the executor the current thread is a worker of, and the index of the worker task queue
+thread_local const void* t_workerExecutor = nullptr;
+thread_local size_t t_workerQueueIdx = 0;
+}  // namespace
+
 struct CPUStreamsExecutor::Impl {
+    // the task queue of a worker thread, the idle workers steal the tasks from the queues of the other workers
+    struct WorkerQueue {
+        std::mutex _mutex;
+        std::deque<Task> _tasks;
+        // the NUMA node of the worker stream, -1 until the stream is created on the first task
+        std::atomic<int> _numaNodeId{-1};
+        std::atomic<size_t> _maxDepth{0};
+        std::atomic<size_t> _stolenTasks{0};  // the tasks of this queue executed by the other workers
+        std::atomic<size_t> _executedTasks{0};
+
+        void push(Task task) {
+            size_t depth = 0;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _tasks.emplace_back(std::move(task));
+                depth = _tasks.size();
+            }
+            if (depth > _maxDepth.load(std::memory_order_relaxed)) {
+                _maxDepth.store(depth, std::memory_order_relaxed);
+            }
+        }
+
+        // the tasks are taken from the front by both the owner and the thieves, to keep the order of the requests
+        bool pop(Task& task) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_tasks.empty()) {
+                return false;
+            }
+            task = std::move(_tasks.front());
+            _tasks.pop_front();
+            return true;
+        }
+    };
+
     struct Stream {
 #if OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO
         struct Observer : public custom::task_scheduler_observer {
@@ -354,23 +396,33 @@ struct CPUStreamsExecutor::Impl {
                 std::lock_guard<std::mutex> lock(_cpu_ids_mutex);
                 _cpu_ids_all.insert(_cpu_ids_all.end(), processor_ids[streamId].begin(), processor_ids[streamId].end());
             }
+            _workerQueues.emplace_back(std::make_unique<WorkerQueue>());
+        }
+        for (auto streamId = 0; streamId < streams_num; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config.get_name() + "_" + std::to_string(streamId));
-                for (bool stopped = false; !stopped;) {
+                t_workerExecutor = this;
+                t_workerQueueIdx = streamId;
+                auto& queue = *_workerQueues[streamId];
+                for (;;) {
                     Task task;
-                    {
-                        std::unique_lock<std::mutex> lock(_mutex);
-                        _queueCondVar.wait(lock, [&] {
-                            return !_taskQueue.empty() || (stopped = _isStopped);
-                        });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
-                        }
+                    if (Pop(streamId, task)) {
+                        auto stream = _streams.local();
+                        queue._numaNodeId.store(stream->_numaNodeId, std::memory_order_relaxed);
+                        queue._executedTasks.fetch_add(1, std::memory_order_relaxed);
+                        Execute(task, *stream);
+                        continue;
                     }
-                    if (task) {
-                        Execute(task, *(_streams.local()));
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    // the queued tasks are drained before the worker is stopped
+                    if (_isStopped && _pendingTasks.load() == 0) {
+                        break;
                     }
+                    ++_sleepingWorkers;
+                    _queueCondVar.wait(lock, [&] {
+                        return _pendingTasks.load() > 0 || _isStopped;
+                    });
+                    --_sleepingWorkers;
                 }
             });
         }
@@ -378,11 +430,45 @@ struct CPUStreamsExecutor::Impl {
     }
 
     void Enqueue(Task task) {
-        {
-            std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+        // the workers enqueue to their own queues, the external threads spread the tasks round robin
+        auto queueIdx = t_workerQueueIdx;
+        if (t_workerExecutor != this) {
+            queueIdx = _nextQueueIdx.fetch_add(1, std::memory_order_relaxed) % _workerQueues.size();
+        }
+        // counted before the push, so the counter is never less than the number of the queued tasks
+        _pendingTasks.fetch_add(1);
+        _workerQueues[queueIdx]->push(std::move(task));
+        // the global mutex is only taken if there are idle workers to wake up. Both the counters are sequentially
+        // consistent, so either the worker going to sleep sees the pending task, or the producer sees the worker
+        if (_sleepingWorkers.load() > 0) {
+            { std::lock_guard<std::mutex> lock(_mutex); }
+            _queueCondVar.notify_one();
+        }
+    }
+
+    // takes a task from the own queue, or steals it from the workers of the same NUMA node first, then from the others
+    bool Pop(size_t queueIdx, Task& task) {
+        if (_workerQueues[queueIdx]->pop(task)) {
+            _pendingTasks.fetch_sub(1);
+            return true;
+        }
+        const auto numaNodeId = _workerQueues[queueIdx]->_numaNodeId.load(std::memory_order_relaxed);
+        const auto queuesNum = _workerQueues.size();
+        for (bool sameNode : {true, false}) {
+            for (size_t i = 1; i < queuesNum; ++i) {
+                auto& victim = *_workerQueues[(queueIdx + i) % queuesNum];
+                const bool isSameNode = victim._numaNodeId.load(std::memory_order_relaxed) == numaNodeId;
+                if (isSameNode != sameNode) {
+                    continue;
+                }
+                if (victim.pop(task)) {
+                    _pendingTasks.fetch_sub(1);
+                    victim._stolenTasks.fetch_add(1, std::memory_order_relaxed);
+                    return true;
+                }
+            }
         }
-        _queueCondVar.notify_one();
+        return false;
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -450,9 +536,13 @@ struct CPUStreamsExecutor::Impl {
     int _streamId = 0;
     std::queue<int> _streamIdQueue;
     std::vector<std::thread> _threads;
+    std::vector<std::unique_ptr<WorkerQueue>> _workerQueues;
+    std::atomic<size_t> _nextQueueIdx{0};
+    std::atomic<int64_t> _pendingTasks{0};
+    // the mutex and the condition variable are only used to put the idle workers to sleep and to wake them up
     std::mutex _mutex;
     std::condition_variable _queueCondVar;
-    std::queue<Task> _taskQueue;
+    std::atomic<int> _sleepingWorkers{0};
     bool _isStopped = false;
     std::vector<int> _usedNumaNodes;
     CustomThreadLocal _streams;
@@ -495,6 +585,17 @@ std::vector<int> CPUStreamsExecutor::get_rank() {
     return stream->_rank;
 }
 
+CPUStreamsExecutor::QueueStatistics CPUStreamsExecutor::get_queue_statistics() const {
+    QueueStatistics statistics;
+    statistics.queued_tasks = static_cast<size_t>(std::max<int64_t>(_impl->_pendingTasks.load(), 0));
+    for (const auto& queue : _impl->_workerQueues) {
+        statistics.max_queue_depth = std::max(statistics.max_queue_depth, queue->_maxDepth.load());
+        statistics.stolen_tasks += queue->_stolenTasks.load();
+        statistics.executed_tasks += queue->_executedTasks.load();
+    }
+    return statistics;
+}
+
 void CPUStreamsExecutor::cpu_reset() {
     {
         std::lock_guard<std::mutex> lock(_impl->_cpu_ids_mutex);
@@ -263,3 +263,31 @@ static auto AsyncExecutors = ::testing::Values(
     });
 
 INSTANTIATE_TEST_SUITE_P(ASyncTaskExecutorTests, ASyncTaskExecutorTests, AsyncExecutors);
+
+TEST(CPUStreamsExecutorQueueTests, tasksOfBusyStreamAreStolen) {
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor", 2, 1});
+    constexpr size_t tasksNum = 8;
+    std::vector<Future> futures;
+    std::promise<void> enqueued;
+    auto enqueuedFuture = enqueued.get_future();
+    // the tasks enqueued by a worker go to its own queue, the worker is busy until they are done by another one
+    auto outer = async(taskExecutor, [&] {
+        for (size_t i = 0; i < tasksNum; i++) {
+            futures.emplace_back(async(taskExecutor, [] {}));
+        }
+        enqueued.set_value();
+        for (auto& f : futures) {
+            ASSERT_EQ(f.wait_for(std::chrono::seconds(10)), std::future_status::ready);
+        }
+    });
+    enqueuedFuture.wait();
+    ASSERT_EQ(outer.wait_for(std::chrono::seconds(20)), std::future_status::ready);
+
+    auto statistics = taskExecutor->get_queue_statistics();
+    EXPECT_EQ(statistics.queued_tasks, 0u);
+    // the outer task may be stolen as well if it was queued to the other stream
+    EXPECT_GE(statistics.stolen_tasks, tasksNum);
+    EXPECT_LE(statistics.stolen_tasks, tasksNum + 1);
+    EXPECT_EQ(statistics.executed_tasks, tasksNum + 1);
+    EXPECT_GE(statistics.max_queue_depth, 1u);
+}
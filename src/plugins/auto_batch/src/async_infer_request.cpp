@@ -65,10 +65,15 @@ AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<SyncInferRequest>& re
                 std::pair<AsyncInferRequest*, ov::threading::Task> t;
                 t.first = _this;
                 t.second = std::move(task);
+                const bool adaptive = workerInferRequest->_scheduler.is_adaptive();
+                // the arrival is recorded before the push, so the worker never flushes a request it has not seen
+                if (adaptive)
+                    workerInferRequest->_scheduler.on_arrival(BatchScheduler::Clock::now());
                 workerInferRequest->_tasks.push(t);
                 // it is ok to call size() here as the queue only grows (and the bulk removal happens under the mutex)
                 const int sz = static_cast<int>(workerInferRequest->_tasks.size());
-                if (sz == workerInferRequest->_batch_size) {
+                // in the adaptive mode the worker re-evaluates the deadline on every arrival
+                if (sz == workerInferRequest->_batch_size || adaptive) {
                     workerInferRequest->_is_wakeup = true;
                     workerInferRequest->_cond.notify_one();
                 }
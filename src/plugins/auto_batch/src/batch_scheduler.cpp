@@ -0,0 +1,85 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include "batch_scheduler.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ov {
+namespace autobatch_plugin {
+
+void LatencyEstimator::update(Duration sample) {
+    const double value = sample.count();
+    if (!m_has_samples) {
+        m_mean = value;
+        m_deviation = value / 2;
+        m_has_samples = true;
+        return;
+    }
+    const double error = value - m_mean;
+    m_mean += error / 8;
+    m_deviation += (std::abs(error) - m_deviation) / 4;
+}
+
+void BatchScheduler::on_arrival(Clock::time_point now) {
+    const auto latency_slo = LatencyEstimator::Duration(m_latency_slo.load());
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_has_arrivals) {
+        // the idle periods between the bursts are clipped: any gap longer than the target equally prevents batching
+        auto gap = std::chrono::duration_cast<LatencyEstimator::Duration>(now - m_last_arrival);
+        if (latency_slo.count() > 0)
+            gap = std::min(gap, latency_slo);
+        m_inter_arrival.update(gap);
+    }
+    m_last_arrival = now;
+    m_has_arrivals = true;
+    m_pending_arrivals.push_back(now);
+}
+
+void BatchScheduler::on_flush(std::size_t flushed) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    // fewer arrivals are recorded if the policy was enabled while the requests were already queued
+    flushed = std::min(flushed, m_pending_arrivals.size());
+    m_pending_arrivals.erase(m_pending_arrivals.begin(), m_pending_arrivals.begin() + flushed);
+}
+
+void BatchScheduler::on_batch_executed(LatencyEstimator::Duration latency) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_batch_latency.update(latency);
+}
+
+void BatchScheduler::on_single_executed(LatencyEstimator::Duration latency) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_single_latency.update(latency);
+}
+
+BatchScheduler::Clock::time_point BatchScheduler::get_deadline(Clock::time_point now,
+                                                               std::size_t pending,
+                                                               std::size_t batch_size) const {
+    const auto latency_slo = LatencyEstimator::Duration(m_latency_slo.load());
+    if (pending == 0) {
+        // nothing to execute, just poll for the termination
+        return now + std::chrono::duration_cast<Clock::duration>(latency_slo);
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto first_arrival = m_pending_arrivals.empty() ? now : m_pending_arrivals.front();
+    // the waiting must end early enough to run the requests either as the batch or one by one (if the batch is not
+    // collected) and still complete the oldest one within the target
+    const auto execution = std::max(m_batch_latency.upper_bound(), m_single_latency.upper_bound());
+    const auto budget = std::max(latency_slo - execution, LatencyEstimator::Duration(0));
+    const auto deadline = first_arrival + std::chrono::duration_cast<Clock::duration>(budget);
+
+    if (pending < batch_size && !m_inter_arrival.empty()) {
+        // do not idle if the rest of the batch is not expected to arrive before the deadline
+        const auto fill_time = m_inter_arrival.mean() * static_cast<double>(batch_size - pending);
+        if (now + std::chrono::duration_cast<Clock::duration>(fill_time) > deadline)
+            return now;
+    }
+    return deadline;
+}
+}  // namespace autobatch_plugin
+}  // namespace ov
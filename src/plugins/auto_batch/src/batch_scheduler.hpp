@@ -0,0 +1,106 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+
+#include "plugin.hpp"
+
+namespace ov {
+namespace autobatch_plugin {
+
+/**
+ * @brief Running estimate of a duration and of its mean deviation (the Jacobson/Karels estimator used for the TCP
+ * round-trip time). The mean plus four deviations is used as a cheap approximation of the tail (p99) value.
+ */
+class LatencyEstimator {
+public:
+    using Duration = std::chrono::duration<double, std::milli>;
+
+    void update(Duration sample);
+
+    bool empty() const {
+        return !m_has_samples;
+    }
+
+    Duration mean() const {
+        return Duration(m_mean);
+    }
+
+    // zero if there are no samples yet
+    Duration upper_bound() const {
+        return Duration(m_mean + 4 * m_deviation);
+    }
+
+private:
+    double m_mean = 0;
+    double m_deviation = 0;
+    bool m_has_samples = false;
+};
+
+/**
+ * @brief Adaptive policy for the collection of the batch (enabled with ov::auto_batch_latency_slo).
+ * Tracks the requests arrival rate and the execution latency of the batched and batch1 requests, and derives the
+ * moment when the worker must stop waiting for the batch: the oldest collected request must still complete within
+ * the latency target, and there is no point in waiting when the batch is not expected to be filled in time.
+ * With the target set to zero the policy is disabled and the fixed ov::auto_batch_timeout is used instead.
+ */
+class BatchScheduler {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    void set_latency_slo(uint32_t latency_slo) {
+        m_latency_slo = latency_slo;
+    }
+
+    uint32_t get_latency_slo() const {
+        return m_latency_slo;
+    }
+
+    bool is_adaptive() const {
+        return m_latency_slo != 0;
+    }
+
+    // called before the request is queued, only in the adaptive mode
+    void on_arrival(Clock::time_point now);
+
+    /**
+     * @brief The oldest collected requests are taken for the execution
+     * @param flushed number of the requests taken from the queue, the requests arrived meanwhile stay pending
+     */
+    void on_flush(std::size_t flushed);
+
+    void on_batch_executed(LatencyEstimator::Duration latency);
+
+    void on_single_executed(LatencyEstimator::Duration latency);
+
+    /**
+     * @brief Returns the time until which the worker may wait for more requests
+     * @param now current time
+     * @param pending number of the collected requests
+     * @param batch_size number of the requests executed by the batched request
+     * @return the deadline, values not greater than now mean that the collected requests must be executed immediately
+     */
+    Clock::time_point get_deadline(Clock::time_point now, std::size_t pending, std::size_t batch_size) const;
+
+private:
+    std::atomic<std::uint32_t> m_latency_slo = {0};  // in ms
+
+    mutable std::mutex m_mutex;
+    LatencyEstimator m_inter_arrival;
+    LatencyEstimator m_batch_latency;
+    LatencyEstimator m_single_latency;
+    Clock::time_point m_last_arrival;
+    std::deque<Clock::time_point> m_pending_arrivals;
+    bool m_has_arrivals = false;
+};
+}  // namespace autobatch_plugin
+}  // namespace ov
@@ -29,6 +29,9 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
     auto time_out = config.find(ov::auto_batch_timeout.name());
     OPENVINO_ASSERT(time_out != config.end(), "No timeout property be set in config, default will be used!");
     m_time_out = time_out->second.as<std::uint32_t>();
+    auto latency_slo = config.find(ov::auto_batch_latency_slo.name());
+    if (latency_slo != config.end())
+        m_latency_slo = latency_slo->second.as<std::uint32_t>();
 }
 
 CompiledModel::~CompiledModel() {
@@ -65,8 +68,11 @@ CompiledModel::GetWorkerInferRequest() const {
         workerRequestPtr->_batch_size = m_device_info.device_batch_size;
         workerRequestPtr->_completion_tasks.resize(workerRequestPtr->_batch_size);
         workerRequestPtr->_is_wakeup = false;
+        workerRequestPtr->_scheduler.set_latency_slo(m_latency_slo);
         workerRequestPtr->_infer_request_batched->set_callback(
             [workerRequestPtr](std::exception_ptr exceptionPtr) mutable {
+                workerRequestPtr->_scheduler.on_batch_executed(BatchScheduler::Clock::now() -
+                                                               workerRequestPtr->_start_time);
                 if (exceptionPtr)
                     workerRequestPtr->_exception_ptr = exceptionPtr;
                 OPENVINO_ASSERT(workerRequestPtr->_completion_tasks.size() == (size_t)workerRequestPtr->_batch_size);
@@ -84,7 +90,16 @@ CompiledModel::GetWorkerInferRequest() const {
                 std::cv_status status;
                 {
                     std::unique_lock<std::mutex> lock(workerRequestPtr->_mutex);
-                    status = workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(m_time_out));
+                    if (workerRequestPtr->_scheduler.is_adaptive()) {
+                        // the deadline is re-evaluated on every arrival
+                        status = workerRequestPtr->_cond.wait_until(
+                            lock,
+                            workerRequestPtr->_scheduler.get_deadline(BatchScheduler::Clock::now(),
+                                                                      workerRequestPtr->_tasks.size(),
+                                                                      workerRequestPtr->_batch_size));
+                    } else {
+                        status = workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(m_time_out));
+                    }
                     if ((status != std::cv_status::timeout) && (workerRequestPtr->_is_wakeup == false))
                         continue;
                     workerRequestPtr->_is_wakeup = false;
@@ -97,6 +112,7 @@ CompiledModel::GetWorkerInferRequest() const {
                     const int sz = static_cast<int>(workerRequestPtr->_tasks.size());
                     if (sz == workerRequestPtr->_batch_size) {
                         std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
+                        workerRequestPtr->_scheduler.on_flush(sz);
                         for (int n = 0; n < sz; n++) {
                             OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(t));
                             workerRequestPtr->_completion_tasks[n] = std::move(t.second);
@@ -104,6 +120,7 @@ CompiledModel::GetWorkerInferRequest() const {
                             t.first->m_sync_request->m_batched_request_status =
                                 ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED;
                         }
+                        workerRequestPtr->_start_time = BatchScheduler::Clock::now();
                         workerRequestPtr->_infer_request_batched->start_async();
                     } else if ((status == std::cv_status::timeout) && sz) {
                         // timeout to collect the batch is over, have to execute the requests in the batch1 mode
@@ -112,14 +129,21 @@ CompiledModel::GetWorkerInferRequest() const {
                         std::atomic<int> arrived = {0};
                         std::promise<void> all_completed;
                         auto all_completed_future = all_completed.get_future();
-                        for (int n = 0; n < sz; n++) {
+                        const auto start_time = BatchScheduler::Clock::now();
+                        // only the requests queued by now are executed, the later ones remain pending
+                        const int flushed = static_cast<int>(workerRequestPtr->_tasks.size());
+                        workerRequestPtr->_scheduler.on_flush(flushed);
+                        for (int n = 0; n < flushed; n++) {
                             OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(t));
                             t.first->m_request_without_batch->set_callback(
-                                [t, sz, &arrived, &all_completed](std::exception_ptr p) {
+                                [t, flushed, &arrived, &all_completed, start_time, workerRequestPtr](
+                                    std::exception_ptr p) {
+                                    workerRequestPtr->_scheduler.on_single_executed(BatchScheduler::Clock::now() -
+                                                                                    start_time);
                                     if (p)
                                         t.first->m_sync_request->m_exception_ptr = p;
                                     t.second();
-                                    if (sz == ++arrived) {
+                                    if (flushed == ++arrived) {
                                         all_completed.set_value();
                                     }
                                 });
@@ -170,11 +194,23 @@ void CompiledModel::set_property(const ov::AnyMap& properties) {
         if (property.first == ov::auto_batch_timeout.name()) {
             m_time_out = property.second.as<std::uint32_t>();
             m_config[ov::auto_batch_timeout.name()] = property.second.as<std::uint32_t>();
+        } else if (property.first == ov::auto_batch_latency_slo.name()) {
+            m_latency_slo = property.second.as<std::uint32_t>();
+            m_config[ov::auto_batch_latency_slo.name()] = property.second.as<std::uint32_t>();
+            std::lock_guard<std::mutex> lock(m_worker_requests_mutex);
+            for (const auto& worker : m_worker_requests) {
+                worker->_scheduler.set_latency_slo(m_latency_slo);
+                // re-evaluate the wait deadline
+                worker->_is_wakeup = true;
+                worker->_cond.notify_one();
+            }
         } else {
             OPENVINO_THROW("AutoBatching Compiled Model dosen't support property",
                            property.first,
-                           ". The only property that can be changed on the fly is the ",
-                           ov::auto_batch_timeout.name());
+                           ". The only properties that can be changed on the fly are the ",
+                           ov::auto_batch_timeout.name(),
+                           " and the ",
+                           ov::auto_batch_latency_slo.name());
         }
     }
 }
@@ -212,10 +248,14 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
                 ov::PropertyName{ov::optimal_number_of_infer_requests.name(), ov::PropertyMutability::RO},
                 ov::PropertyName{ov::model_name.name(), ov::PropertyMutability::RO},
                 ov::PropertyName{ov::execution_devices.name(), ov::PropertyMutability::RO},
-                ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RW}};
+                ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RW},
+                ov::PropertyName{ov::auto_batch_latency_slo.name(), ov::PropertyMutability::RW}};
         } else if (name == ov::auto_batch_timeout) {
             uint32_t time_out = m_time_out;
             return time_out;
+        } else if (name == ov::auto_batch_latency_slo) {
+            uint32_t latency_slo = m_latency_slo;
+            return latency_slo;
         } else if (name == ov::device::properties) {
             ov::AnyMap all_devices = {};
             ov::AnyMap device_properties = {};
@@ -8,6 +8,7 @@
 #include <condition_variable>
 #include <thread>
 
+#include "batch_scheduler.hpp"
 #include "openvino/runtime/iasync_infer_request.hpp"
 #include "openvino/runtime/icompiled_model.hpp"
 #include "openvino/runtime/threading/thread_safe_containers.hpp"
@@ -31,6 +32,8 @@ public:
         std::mutex _mutex;
         std::exception_ptr _exception_ptr;
         bool _is_wakeup;
+        BatchScheduler _scheduler;
+        BatchScheduler::Clock::time_point _start_time;
     };
 
     CompiledModel(const std::shared_ptr<ov::Model>& model,
@@ -73,6 +76,7 @@ protected:
 
     mutable std::atomic_size_t m_num_requests_created = {0};
     std::atomic<std::uint32_t> m_time_out = {0};  // in ms
+    std::atomic<std::uint32_t> m_latency_slo = {0};  // in ms, zero disables the adaptive batch collection
 
     const std::set<std::size_t> m_batched_inputs;
     const std::set<std::size_t> m_batched_outputs;
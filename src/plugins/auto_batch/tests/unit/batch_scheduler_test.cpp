@@ -0,0 +1,93 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "batch_scheduler.hpp"
+
+#include <gtest/gtest.h>
+
+using ov::mock_autobatch_plugin::BatchScheduler;
+using ov::mock_autobatch_plugin::LatencyEstimator;
+using std::chrono::milliseconds;
+
+TEST(LatencyEstimatorTest, TracksMeanAndDeviation) {
+    LatencyEstimator estimator;
+    EXPECT_TRUE(estimator.empty());
+    EXPECT_DOUBLE_EQ(estimator.upper_bound().count(), 0);
+
+    for (int i = 0; i < 100; i++)
+        estimator.update(milliseconds(10));
+    EXPECT_FALSE(estimator.empty());
+    EXPECT_NEAR(estimator.mean().count(), 10, 1e-3);
+    EXPECT_NEAR(estimator.upper_bound().count(), 10, 1e-3);
+
+    // jitter widens the tail estimate, not only the mean
+    for (int i = 0; i < 100; i++)
+        estimator.update(milliseconds(i % 2 ? 5 : 15));
+    EXPECT_NEAR(estimator.mean().count(), 10, 1.0);
+    EXPECT_GT(estimator.upper_bound().count(), 20);
+}
+
+TEST(BatchSchedulerTest, DisabledByDefault) {
+    BatchScheduler scheduler;
+    EXPECT_FALSE(scheduler.is_adaptive());
+    scheduler.set_latency_slo(100);
+    EXPECT_TRUE(scheduler.is_adaptive());
+    EXPECT_EQ(scheduler.get_latency_slo(), 100u);
+}
+
+TEST(BatchSchedulerTest, DeadlineLeavesTimeForExecution) {
+    BatchScheduler scheduler;
+    scheduler.set_latency_slo(100);
+    scheduler.on_batch_executed(milliseconds(20));
+    scheduler.on_single_executed(milliseconds(10));
+
+    const auto start = BatchScheduler::Clock::now();
+    scheduler.on_arrival(start);
+    // the first sample sets the deviation to the half of the value: 100 - (20 + 4 * 10)
+    EXPECT_EQ(scheduler.get_deadline(start, 1, 4), start + milliseconds(40));
+    // the deadline is bound to the oldest collected request
+    EXPECT_EQ(scheduler.get_deadline(start + milliseconds(5), 1, 4), start + milliseconds(40));
+}
+
+TEST(BatchSchedulerTest, DeadlineKeepsArrivalsAfterFlush) {
+    BatchScheduler scheduler;
+    scheduler.set_latency_slo(100);
+    const auto start = BatchScheduler::Clock::now();
+    scheduler.on_arrival(start);
+    // the second request arrives after the worker has taken the size of the queue
+    scheduler.on_arrival(start + milliseconds(10));
+    scheduler.on_flush(1);
+    // the deadline stays bound to the request left in the queue instead of sliding with the current time
+    EXPECT_EQ(scheduler.get_deadline(start + milliseconds(50), 1, 2), start + milliseconds(110));
+    scheduler.on_flush(1);
+    EXPECT_EQ(scheduler.get_deadline(start + milliseconds(50), 1, 2), start + milliseconds(150));
+}
+
+TEST(BatchSchedulerTest, NoIdleWaitForSlowArrivals) {
+    BatchScheduler scheduler;
+    scheduler.set_latency_slo(100);
+    scheduler.on_batch_executed(milliseconds(20));
+    auto now = BatchScheduler::Clock::now();
+    // requests arrive every 30ms: the remaining three would take 90ms, which is beyond the 40ms budget
+    for (int i = 0; i < 8; i++) {
+        scheduler.on_flush(1);
+        now += milliseconds(30);
+        scheduler.on_arrival(now);
+    }
+    EXPECT_EQ(scheduler.get_deadline(now, 1, 4), now);
+    // while the single missing request is expected in time
+    EXPECT_EQ(scheduler.get_deadline(now, 3, 4), now + milliseconds(40));
+}
+
+TEST(BatchSchedulerTest, WaitForFastArrivals) {
+    BatchScheduler scheduler;
+    scheduler.set_latency_slo(100);
+    auto now = BatchScheduler::Clock::now();
+    for (int i = 0; i < 8; i++) {
+        scheduler.on_flush(1);
+        now += milliseconds(1);
+        scheduler.on_arrival(now);
+    }
+    EXPECT_EQ(scheduler.get_deadline(now, 1, 4), now + milliseconds(100));
+}
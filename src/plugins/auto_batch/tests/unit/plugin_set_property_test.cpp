@@ -58,6 +58,7 @@ TEST_P(SetPropertyTest, SetPropertyTestCase) {
 const std::vector<set_property_params> plugin_set_property_params_test = {
     set_property_params{{{ov::auto_batch_timeout(static_cast<uint32_t>(200))}}, false},
     set_property_params{{{ov::device::priorities("CPU(4)")}}, false},
+    set_property_params{{{ov::auto_batch_latency_slo(static_cast<uint32_t>(50))}}, false},
     set_property_params{{{ov::auto_batch_timeout(static_cast<uint32_t>(200))}, {ov::device::priorities("CPU(4)")}}, false},
     set_property_params{{{"XYZ", "200"}}, true},
     set_property_params{{{"XYZ", "200"}, {ov::device::priorities("CPU(4)")}}, true},
@@ -56,7 +56,8 @@ void ov::hetero::CompiledModel::compile_model(const std::shared_ptr<ov::Model>&
         // disable caching for subgraphs, because the whole HETERO model is cached
         auto device_config = meta_devices[compiled_model_desc.device];
         device_config[ov::cache_dir.name()] = "";
-        // set exclusive_async_requests in case when model is split
+        // set exclusive_async_requests in case when model is split, unless the submodels are pipelined: every stage
+        // keeps the own executor of its device then, so the stages of the different requests run concurrently
         if (add_exclusive) {
             auto supported_internal_properties =
                 get_hetero_plugin()->get_core()->get_property(compiled_model_desc.device,
@@ -80,7 +81,7 @@ void ov::hetero::CompiledModel::compile_model(const std::shared_ptr<ov::Model>&
             get_model_subgraphs(model, query_model_result, user_set_affinities, m_cfg.dump_dot_files());
 
         m_compiled_submodels.resize(ordered_subgraphs.size());
-        bool add_exclusive = ordered_subgraphs.size() > 1;
+        bool add_exclusive = ordered_subgraphs.size() > 1 && !m_cfg.pipeline_parallel();
         size_t id = 0;
         for (const auto& subgraph : ordered_subgraphs) {
             m_compiled_submodels[id].device = subgraph._affinity;
@@ -113,7 +114,7 @@ void ov::hetero::CompiledModel::compile_model(const std::shared_ptr<ov::Model>&
             }
         }
         m_compiled_submodels.resize(ordered_subgraphs.size());
-        bool add_exclusive = ordered_subgraphs.size() > 1;
+        bool add_exclusive = ordered_subgraphs.size() > 1 && !m_cfg.pipeline_parallel();
         size_t id = 0;
         for (const auto& subgraph : ordered_subgraphs) {
             m_compiled_submodels[id].device = subgraph->get_affinity();
@@ -309,6 +310,10 @@ ov::Any ov::hetero::CompiledModel::get_property(const std::string& name) const {
                              comp_model_desc.compiled_model->get_property(ov::optimal_number_of_infer_requests.name())
                                  .as<unsigned int>());
         }
+        if (m_cfg.pipeline_parallel()) {
+            // a request in flight per stage is needed to keep all the stages busy
+            value *= static_cast<unsigned int>(m_compiled_submodels.size());
+        }
         return decltype(ov::optimal_number_of_infer_requests)::value_type{value};
     } else if (ov::execution_devices == name) {
         std::vector<std::string> device_names;
@@ -67,6 +67,10 @@ ov::AnyMap Configuration::get_device_properties() const {
     return device_properties;
 }
 
+bool Configuration::pipeline_parallel() const {
+    return modelDistributionPolicy.count(ov::hint::ModelDistributionPolicy::PIPELINE_PARALLEL) != 0;
+}
+
 bool Configuration::dump_dot_files() const {
     return std::getenv("OPENVINO_HETERO_VISUALIZE") != NULL;
 }
\ No newline at end of file
@@ -34,6 +34,9 @@ struct Configuration {
 
     bool dump_dot_files() const;
 
+    // submodels are executed as the stages of a pipeline, the consecutive requests overlap across the stages
+    bool pipeline_parallel() const;
+
     std::string device_priorities;
 
     std::set<ov::hint::ModelDistributionPolicy> modelDistributionPolicy = {};
@@ -1,11 +1,17 @@
 // Copyright (C) 2018-2025 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 //
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+
 #include "common_test_utils/test_constants.hpp"
 #include "hetero_tests.hpp"
 #include "openvino/runtime/exec_model_info.hpp"
 #include "openvino/runtime/internal_properties.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "properties.hpp"
 
 using namespace ov::hetero::tests;
 
@@ -99,6 +105,62 @@ TEST_F(HeteroTests, compile_with_device_properties_no_exclusive) {
     EXPECT_EQ(6, mock1_properties.at(ov::num_streams.name()).as<ov::streams::Num>());
 }
 
+TEST_F(HeteroTests, compile_pipeline_parallel_no_exclusive) {
+    std::set<ov::hint::ModelDistributionPolicy> model_policy = {ov::hint::ModelDistributionPolicy::PIPELINE_PARALLEL};
+    ov::AnyMap config = {ov::device::priorities("MOCK0,MOCK1"),
+                         ov::hint::model_distribution_policy(model_policy),
+                         ov::device::properties("MOCK0", ov::num_streams(4)),
+                         ov::device::properties("MOCK1", ov::num_streams(6))};
+    auto model = create_model_with_subtract_reshape();
+    auto compiled_model = core.compile_model(model, ov::test::utils::DEVICE_HETERO, config);
+    // the stages keep their own streams
+    auto device_properties = compiled_model.get_property(ov::device::properties.name()).as<ov::AnyMap>();
+    ASSERT_TRUE(device_properties.count("MOCK0.0"));
+    auto mock0_properties = device_properties.at("MOCK0.0").as<ov::AnyMap>();
+    EXPECT_EQ(4, mock0_properties.at(ov::num_streams.name()).as<ov::streams::Num>());
+    ASSERT_TRUE(device_properties.count("MOCK1.0"));
+    auto mock1_properties = device_properties.at("MOCK1.0").as<ov::AnyMap>();
+    EXPECT_EQ(6, mock1_properties.at(ov::num_streams.name()).as<ov::streams::Num>());
+
+    // a request in flight per stage
+    auto number_of_stages = compiled_model.get_property(ov::hetero::number_of_submodels);
+    ASSERT_GT(number_of_stages, 1u);
+    EXPECT_EQ(6u * number_of_stages, compiled_model.get_property(ov::optimal_number_of_infer_requests));
+
+    // the second stage of the first request runs while the first stage of the second request is in flight
+    std::mutex mutex;
+    std::condition_variable first_stage_started;
+    std::string first_stage_device;
+    size_t first_stage_calls = 0;
+    bool second_stage_waited = false;
+    bool stages_overlapped = false;
+    infer_hook = [&](const std::string& device) {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (first_stage_device.empty())
+            first_stage_device = device;
+        if (device == first_stage_device) {
+            ++first_stage_calls;
+            first_stage_started.notify_all();
+        } else if (!second_stage_waited) {
+            second_stage_waited = true;
+            stages_overlapped = first_stage_started.wait_for(lock, std::chrono::seconds(10), [&] {
+                return first_stage_calls > 1;
+            });
+        }
+    };
+    auto request0 = compiled_model.create_infer_request();
+    auto request1 = compiled_model.create_infer_request();
+    for (const auto& input : compiled_model.inputs()) {
+        request0.set_tensor(input, create_and_fill_tensor(input.get_element_type(), input.get_shape()));
+        request1.set_tensor(input, create_and_fill_tensor(input.get_element_type(), input.get_shape()));
+    }
+    request0.start_async();
+    request1.start_async();
+    request0.wait();
+    request1.wait();
+    EXPECT_TRUE(stages_overlapped);
+}
+
 TEST_F(HeteroTests, get_runtime_model) {
     ov::AnyMap config = {ov::device::priorities("MOCK0,MOCK1")};
     auto model = create_model_with_subtract_reshape();
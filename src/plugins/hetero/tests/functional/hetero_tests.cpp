@@ -280,6 +280,9 @@ public:
             return m_config.count(ov::num_streams.name()) ? m_config.at(ov::num_streams.name()) : ov::streams::Num(1);
         } else if (name == ov::enable_profiling) {
             return m_config.count(ov::enable_profiling.name()) ? m_config.at(ov::enable_profiling.name()) : false;
+        } else if (name == ov::optimal_number_of_infer_requests) {
+            auto streams = get_property(ov::num_streams.name()).as<ov::streams::Num>();
+            return decltype(ov::optimal_number_of_infer_requests)::value_type{static_cast<unsigned int>(streams.num)};
         } else {
             OPENVINO_THROW("get property: " + name);
         }
@@ -345,6 +348,8 @@ public:
         for (const auto& output : get_outputs()) {
             output_tensors.emplace_back(ov::make_tensor(get_tensor(output)));
         }
+        if (ov::hetero::tests::HeteroTests::infer_hook)
+            ov::hetero::tests::HeteroTests::infer_hook(get_compiled_model()->get_plugin()->get_device_name());
         m_model->evaluate(output_tensors, input_tensors);
     }
     std::vector<ov::SoPtr<ov::IVariableState>> query_state() const override {
@@ -900,10 +905,16 @@ void ov::hetero::tests::HeteroTests::reg_plugin_type(const std::string& device_n
     reg_plugin(plugin);
 }
 
+std::function<void(const std::string&)> ov::hetero::tests::HeteroTests::infer_hook;
+
 void ov::hetero::tests::HeteroTests::SetUp() {
     if (m_mock_plugins.empty()) {
         reg_plugin_type<MockPluginReshape>("MOCK0");
         reg_plugin_type<MockPluginSubtract>("MOCK1");
         reg_plugin_type<MockPluginGPU>("MOCKGPU");
     }
-}
\ No newline at end of file
+}
+
+void ov::hetero::tests::HeteroTests::TearDown() {
+    infer_hook = nullptr;
+}
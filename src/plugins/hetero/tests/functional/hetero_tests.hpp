@@ -5,7 +5,9 @@
 
 #include <gtest/gtest.h>
 
+#include <functional>
 #include <memory>
+#include <string>
 
 #include "common_test_utils/test_assertions.hpp"
 #include "openvino/runtime/core.hpp"
@@ -19,7 +21,11 @@ class HeteroTests : public ::testing::Test {
 public:
     ov::Core core;
 
+    // called by the mock infer requests with the device name before the inference, lets a test order the stages
+    static std::function<void(const std::string&)> infer_hook;
+
     void SetUp() override;
+    void TearDown() override;
 
     std::shared_ptr<ov::Model> create_model_with_subtract(bool dynamic = false);
     std::shared_ptr<ov::Model> create_model_with_subtract_reshape(bool dynamic = false);
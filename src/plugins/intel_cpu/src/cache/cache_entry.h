@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
@@ -17,7 +18,24 @@ class CacheEntryBase {
 public:
     enum class LookUpStatus : int8_t { Hit, Miss };
 
+    struct Statistics {
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t evictions = 0;
+        size_t size = 0;
+
+        Statistics& operator+=(const Statistics& rhs) {
+            hits += rhs.hits;
+            misses += rhs.misses;
+            evictions += rhs.evictions;
+            size += rhs.size;
+            return *this;
+        }
+    };
+
     virtual ~CacheEntryBase() = default;
+
+    [[nodiscard]] virtual Statistics getStatistics() const = 0;
 };
 
 /**
@@ -26,7 +44,8 @@ public:
  * comparison operator.
  * @tparam ValType is a type that must meet all the requirements to the std::unordered_map mapped type
  * @tparam ImplType is a type for the internal storage. It must provide put(KeyType, ValueType) and ValueType get(const
- * KeyType&) interface and must have constructor of type ImplType(size_t).
+ * KeyType&) interface, getCapacity(), getSize() and getEvictionsCount() accessors and must have constructor of type
+ * ImplType(size_t).
  *
  * @note In this implementation default constructed value objects are treated as empty objects.
  */
@@ -50,6 +69,7 @@ public:
     ResultType getOrCreate(const KeyType& key, std::function<ValType(const KeyType&)> builder) {
         if (0 == _impl.getCapacity()) {
             // fast track
+            _misses.fetch_add(1, std::memory_order_relaxed);
             return {builder(key), CacheEntryBase::LookUpStatus::Miss};
         }
         auto retStatus = LookUpStatus::Hit;
@@ -57,15 +77,31 @@ public:
         auto retEmpty = ValType();
         if (retVal == retEmpty) {
             retStatus = LookUpStatus::Miss;
+            _misses.fetch_add(1, std::memory_order_relaxed);
             retVal = builder(key);
             if (retVal != retEmpty) {
                 _impl.put(key, retVal);
             }
+        } else {
+            _hits.fetch_add(1, std::memory_order_relaxed);
         }
         return {retVal, retStatus};
     }
 
+    [[nodiscard]] Statistics getStatistics() const override {
+        Statistics stats;
+        stats.hits = _hits.load(std::memory_order_relaxed);
+        stats.misses = _misses.load(std::memory_order_relaxed);
+        stats.evictions = _impl.getEvictionsCount();
+        stats.size = _impl.getSize();
+        return stats;
+    }
+
     ImplType _impl;
+
+private:
+    std::atomic_size_t _hits{0};
+    std::atomic_size_t _misses{0};
 };
 
 }  // namespace ov::intel_cpu
@@ -0,0 +1,232 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Thread safe preemptive cache with an approximate LRU (CLOCK) eviction policy.
+ * The key space is split into independent shards, each guarded by its own reader-writer lock. Cache hits only take
+ * the shared lock and set the slot "referenced" bit, so concurrent lookups from different streams do not serialize on
+ * a single mutex and do not reorder any list.
+ * @tparam Key is a key type that must define hash() const method with return type convertible to size_t and define
+ * comparison operator.
+ * @tparam Value is a type that must be default constructible and copyable. Default constructed value is treated as
+ * an empty object.
+ */
+
+namespace ov::intel_cpu {
+
+template <typename Key, typename Value>
+class ClockCache {
+public:
+    using value_type = std::pair<Key, Value>;
+
+    explicit ClockCache(size_t capacity) : _capacity(capacity) {
+        // small caches are kept in one shard to preserve the exact CLOCK order
+        size_t numShards = 1;
+        while (numShards < maxShards && _capacity / (numShards * 2) >= minShardCapacity) {
+            numShards *= 2;
+        }
+        _shardMask = numShards - 1;
+        _shards = std::make_unique<Shard[]>(numShards);
+        for (size_t i = 0; i < numShards; ++i) {
+            _shards[i].init(_capacity / numShards + (i < _capacity % numShards ? 1 : 0));
+        }
+    }
+
+    /**
+     * @brief Puts the value associated with the key into the cache.
+     * @param key
+     * @param value
+     */
+
+    void put(const Key& key, const Value& val) {
+        if (0 == _capacity) {
+            return;
+        }
+        const size_t hash = key.hash();
+        auto& shard = getShard(hash);
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        const auto idx = shard.find(hash, key);
+        if (idx != Shard::npos) {
+            shard.slots[idx]->second = val;
+            shard.referenced[idx].store(1, std::memory_order_relaxed);
+            return;
+        }
+        if (shard.capacity == 0) {
+            return;
+        }
+        if (shard.size == shard.capacity) {
+            shard.release(shard.nextVictim());
+            _evictions.fetch_add(1, std::memory_order_relaxed);
+        }
+        shard.emplace(shard.nextFree(), hash, key, val);
+    }
+
+    /**
+     * @brief Searches a value associated with the key.
+     * @param key
+     * @return Value associated with the key or default constructed instance of the Value type.
+     */
+
+    Value get(const Key& key) {
+        if (0 == _capacity) {
+            return Value();
+        }
+        const size_t hash = key.hash();
+        auto& shard = getShard(hash);
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        const auto idx = shard.find(hash, key);
+        if (idx == Shard::npos) {
+            return Value();
+        }
+        shard.referenced[idx].store(1, std::memory_order_relaxed);
+        return shard.slots[idx]->second;
+    }
+
+    /**
+     * @brief Evicts n cache records chosen by the CLOCK policy
+     * @param n number of records to be evicted, can be greater than capacity
+     */
+
+    void evict(size_t n) {
+        for (size_t i = 0; i <= _shardMask && n > 0; ++i) {
+            auto& shard = _shards[i];
+            std::unique_lock<std::shared_mutex> lock(shard.mutex);
+            for (; n > 0 && shard.size > 0; --n) {
+                shard.release(shard.nextVictim());
+                _evictions.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Returns the current capacity value
+     * @return the current capacity value
+     */
+    [[nodiscard]] size_t getCapacity() const noexcept {
+        return _capacity;
+    }
+
+    /**
+     * @brief Returns the number of records stored in the cache
+     */
+    [[nodiscard]] size_t getSize() const {
+        size_t size = 0;
+        for (size_t i = 0; i <= _shardMask; ++i) {
+            std::shared_lock<std::shared_mutex> lock(_shards[i].mutex);
+            size += _shards[i].size;
+        }
+        return size;
+    }
+
+    /**
+     * @brief Returns the total number of records evicted from the cache since its creation
+     */
+    [[nodiscard]] size_t getEvictionsCount() const noexcept {
+        return _evictions.load(std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr size_t maxShards = 16;
+    static constexpr size_t minShardCapacity = 64;
+
+    struct alignas(64) Shard {
+        static constexpr size_t npos = static_cast<size_t>(-1);
+
+        void init(size_t shardCapacity) {
+            capacity = shardCapacity;
+            slots.resize(capacity);
+            hashes.resize(capacity);
+            referenced = std::make_unique<std::atomic<uint8_t>[]>(capacity);
+            index.reserve(capacity);
+        }
+
+        size_t find(size_t hash, const Key& key) const {
+            auto range = index.equal_range(hash);
+            for (auto itr = range.first; itr != range.second; ++itr) {
+                if (slots[itr->second]->first == key) {
+                    return itr->second;
+                }
+            }
+            return npos;
+        }
+
+        size_t nextFree() {
+            while (slots[hand]) {
+                advance();
+            }
+            const auto idx = hand;
+            advance();
+            return idx;
+        }
+
+        size_t nextVictim() {
+            // the loop is bounded: every pass clears the referenced bits, so the second pass always finds a victim
+            while (!slots[hand] || referenced[hand].exchange(0, std::memory_order_relaxed) != 0) {
+                advance();
+            }
+            const auto idx = hand;
+            advance();
+            return idx;
+        }
+
+        void emplace(size_t idx, size_t hash, const Key& key, const Value& val) {
+            slots[idx].emplace(key, val);
+            hashes[idx] = hash;
+            referenced[idx].store(0, std::memory_order_relaxed);
+            index.emplace(hash, idx);
+            ++size;
+        }
+
+        void release(size_t idx) {
+            auto range = index.equal_range(hashes[idx]);
+            for (auto itr = range.first; itr != range.second; ++itr) {
+                if (itr->second == idx) {
+                    index.erase(itr);
+                    break;
+                }
+            }
+            slots[idx].reset();
+            --size;
+        }
+
+        void advance() {
+            hand = (hand + 1 == capacity) ? 0 : hand + 1;
+        }
+
+        mutable std::shared_mutex mutex;
+        std::vector<std::optional<value_type>> slots;
+        std::vector<size_t> hashes;
+        std::unique_ptr<std::atomic<uint8_t>[]> referenced;
+        // the key hash is computed once per lookup and reused as the index key
+        std::unordered_multimap<size_t, size_t> index;
+        size_t capacity = 0;
+        size_t size = 0;
+        size_t hand = 0;
+    };
+
+    Shard& getShard(size_t hash) {
+        // Fibonacci hashing decorrelates the shard choice from the bucket choice of the shard index
+        return _shards[(static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ULL >> 32) & _shardMask];
+    }
+
+    size_t _capacity;
+    size_t _shardMask = 0;
+    std::unique_ptr<Shard[]> _shards;
+    std::atomic_size_t _evictions{0};
+};
+
+}  // namespace ov::intel_cpu
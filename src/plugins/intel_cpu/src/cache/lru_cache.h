@@ -75,6 +75,7 @@ public:
         for (size_t i = 0; i < n && !_lruList.empty(); ++i) {
             _cacheMapper.erase(_lruList.back().first);
             _lruList.pop_back();
+            ++_evictions;
         }
     }
 
@@ -86,6 +87,20 @@ public:
         return _capacity;
     }
 
+    /**
+     * @brief Returns the number of records stored in the cache
+     */
+    [[nodiscard]] size_t getSize() const noexcept {
+        return _cacheMapper.size();
+    }
+
+    /**
+     * @brief Returns the total number of records evicted from the cache since its creation
+     */
+    [[nodiscard]] size_t getEvictionsCount() const noexcept {
+        return _evictions;
+    }
+
 private:
     struct key_hasher {
         std::size_t operator()(const Key& k) const {
@@ -103,6 +118,7 @@ private:
     lru_list_type _lruList;
     std::unordered_map<Key, cache_map_value_type, key_hasher> _cacheMapper;
     size_t _capacity;
+    size_t _evictions = 0;
 };
 
 }  // namespace ov::intel_cpu
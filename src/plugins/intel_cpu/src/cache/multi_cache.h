@@ -7,23 +7,26 @@
 #include <atomic>
 #include <cstddef>
 #include <memory>
+#include <mutex>
 #include <type_traits>
 #include <unordered_map>
 
 #include "cache_entry.h"
+#include "clock_cache.h"
 
 namespace ov::intel_cpu {
 
 /**
  * @brief Class that represent a preemptive cache for different key/value pair types.
  *
- * @attention This implementation IS NOT THREAD SAFE!
+ * @note The cache is thread safe, so a single instance can be shared between the streams of a compiled model. It is
+ * up to the caller to put there only the values that can be used concurrently (e.g. oneDNN primitives).
  */
 
 class MultiCache {
 public:
     template <typename KeyType, typename ValueType>
-    using EntryTypeT = CacheEntry<KeyType, ValueType>;
+    using EntryTypeT = CacheEntry<KeyType, ValueType, ClockCache<KeyType, ValueType>>;
     using EntryBasePtr = std::shared_ptr<CacheEntryBase>;
     template <typename KeyType, typename ValueType>
     using EntryPtr = std::shared_ptr<EntryTypeT<KeyType, ValueType>>;
@@ -34,6 +37,9 @@ public:
      */
     explicit MultiCache(size_t capacity) : _capacity(capacity) {}
 
+    MultiCache(const MultiCache&) = delete;
+    MultiCache& operator=(const MultiCache&) = delete;
+
     /**
      * @brief Searches a value of ValueType in the cache using the provided key or creates a new ValueType instance (if
      * nothing was found) using the key and the builder functor and adds the new record to the cache
@@ -46,11 +52,23 @@ public:
     template <typename KeyType,
               typename BuilderType,
               typename ValueType = std::invoke_result_t<BuilderType&, const KeyType&>>
-    typename CacheEntry<KeyType, ValueType>::ResultType getOrCreate(const KeyType& key, BuilderType builder) {
+    typename EntryTypeT<KeyType, ValueType>::ResultType getOrCreate(const KeyType& key, BuilderType builder) {
         auto entry = getEntry<KeyType, ValueType>();
         return entry->getOrCreate(key, std::move(builder));
     }
 
+    /**
+     * @brief Accumulates hit/miss/eviction counters and the number of stored records over all the entries
+     */
+    [[nodiscard]] CacheEntryBase::Statistics getStatistics() const {
+        CacheEntryBase::Statistics stats;
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (const auto& item : _storage) {
+            stats += item.second->getStatistics();
+        }
+        return stats;
+    }
+
 private:
     template <typename T>
     size_t getTypeId();
@@ -59,6 +77,7 @@ private:
 
     static std::atomic_size_t _typeIdCounter;
     size_t _capacity;
+    mutable std::mutex _mutex;
     std::unordered_map<size_t, EntryBasePtr> _storage;
 };
 
@@ -72,6 +91,7 @@ template <typename KeyType, typename ValueType>
 MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getEntry() {
     using EntryType = EntryTypeT<KeyType, ValueType>;
     size_t id = getTypeId<EntryType>();
+    std::lock_guard<std::mutex> lock(_mutex);
     auto itr = _storage.find(id);
     if (itr == _storage.end()) {
         auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity)});
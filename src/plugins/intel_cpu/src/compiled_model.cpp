@@ -5,6 +5,7 @@
 #include "compiled_model.h"
 
 #include <algorithm>
+#include <cstdint>
 #include <cstring>
 #include <exception>
 #include <memory>
@@ -18,7 +19,10 @@
 #include "graph.h"
 #include "graph_context.h"
 #include "infer_request.h"
+#include "internal_properties.hpp"
 #include "low_precision/low_precision.hpp"
+#include "memory_plan.hpp"
+#include "nodes/reference.h"
 #include "openvino/core/any.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/model.hpp"
@@ -32,8 +36,10 @@
 #include "openvino/runtime/threading/cpu_streams_info.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
 #include "openvino/runtime/threading/itask_executor.hpp"
+#include "registered_buffers.hpp"
 #include "sub_memory_manager.hpp"
 #include "utils/debug_capabilities.h"
+#include "utils/kernel_warmup_cache.hpp"
 #include "utils/memory_stats_dump.hpp"
 #include "utils/serialize.hpp"
 
@@ -69,19 +75,28 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                              const std::shared_ptr<const ov::IPlugin>& plugin,
                              Config cfg,
                              const bool loaded_from_cache,
-                             std::shared_ptr<SubMemoryManager> sub_memory_manager)
+                             std::shared_ptr<SubMemoryManager> sub_memory_manager,
+                             MemoryPlans memory_plans)
     : ov::ICompiledModel::ICompiledModel(model, plugin),
       m_model(model),
       m_plugin(plugin),
       m_cfg{std::move(cfg)},
       m_name{model->get_name()},
       m_loaded_from_cache(loaded_from_cache),
-      m_sub_memory_manager(std::move(sub_memory_manager)) {
+      m_socketWeights(m_cfg.shareWeightsAcrossModels, m_cfg.repackedWeightsDir),
+      m_sharedParamsCache(std::make_shared<MultiCache>(m_cfg.rtCacheCapacity)),
+      m_registeredBuffers(std::make_shared<RegisteredBuffers>()),
+      m_sub_memory_manager(std::move(sub_memory_manager)),
+      m_memory_plans(std::move(memory_plans)) {
     m_mutex = std::make_shared<std::mutex>();
     const auto& core = m_plugin->get_core();
     if (!core) {
         OPENVINO_THROW("Unable to get API version. Core is unavailable");
     }
+    if (m_cfg.enableKernelWarmup && !m_cfg.kernelWarmupCacheDir.empty() && !m_sub_memory_manager &&
+        model->is_dynamic()) {
+        m_kernelWarmupCache = std::make_shared<KernelWarmupCache>(m_cfg.kernelWarmupCacheDir, *model, m_cfg);
+    }
 
     IStreamsExecutor::Config executor_config;
     if (m_cfg.exclusiveAsyncRequests) {
@@ -169,6 +184,50 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
     }
 }
 
+void CompiledModel::warm_up_kernels() const {
+    if (!m_kernelWarmupCache) {
+        return;
+    }
+    const auto records = m_kernelWarmupCache->load();
+    if (records.empty()) {
+        return;
+    }
+
+    auto streamsExecutor = std::dynamic_pointer_cast<IStreamsExecutor>(m_task_executor);
+    if (m_graphs.size() == 1 || !streamsExecutor || m_has_sub_compiled_models) {
+        auto request = create_infer_request();
+        m_kernelWarmupCache->replay(records, inputs(), *request);
+        return;
+    }
+
+    // the runtime caches of a graph are only filled by the inference on it, so the shapes are replayed by each stream
+    // on its own graph. The tasks are distributed over the streams by the executor, as on the graphs creation. The
+    // number of rounds is bounded: a stream which has not got a task by then warms up on its first requests instead
+    constexpr int maxRounds = 4;
+    std::mutex mutex;
+    std::vector<bool> warmedUp(m_graphs.size(), false);
+    std::vector<Task> tasks(m_graphs.size());
+    for (int round = 0; round < maxRounds && std::find(warmedUp.begin(), warmedUp.end(), false) != warmedUp.end();
+         ++round) {
+        for (auto&& task : tasks) {
+            task = [&] {
+                const auto graphIdx = streamsExecutor->get_stream_id() % m_graphs.size();
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (warmedUp[graphIdx]) {
+                        return;
+                    }
+                    warmedUp[graphIdx] = true;
+                }
+                // the internal request is executed by the calling stream, i.e. on the graph of the stream
+                auto request = std::static_pointer_cast<AsyncInferRequest>(create_infer_request());
+                m_kernelWarmupCache->replay(records, inputs(), *request->m_internal_request);
+            };
+        }
+        m_task_executor->run_and_wait(tasks);
+    }
+}
+
 CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
     int streamId = 0;
     int socketId = 0;
@@ -199,7 +258,9 @@ CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
                                                          m_socketWeights[socketId],
                                                          isQuantizedFlag,
                                                          streamsExecutor,
-                                                         m_sub_memory_manager);
+                                                         m_sub_memory_manager,
+                                                         m_sharedParamsCache,
+                                                         m_memory_plans);
                 }
 
                 const std::shared_ptr<const ov::Model> model = m_model;
@@ -261,6 +322,38 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
         return m_loaded_from_cache;
     }
 
+    if (name == ov::intel_cpu::cpu_runtime_cache_statistics) {
+        auto stats = m_sharedParamsCache->getStatistics();
+        for (auto& graph : m_graphs) {
+            // the streams may be inferring on the graph, its cache is read under the graph lock as in get_graph()
+            GraphGuard::Lock graphLock(graph);
+            if (!graphLock._graph.IsReady()) {
+                continue;
+            }
+            stats += graphLock._graph.getGraphContext()->getParamsCache()->getStatistics();
+        }
+        return decltype(ov::intel_cpu::cpu_runtime_cache_statistics)::value_type{
+            {"HITS", static_cast<uint64_t>(stats.hits)},
+            {"MISSES", static_cast<uint64_t>(stats.misses)},
+            {"EVICTIONS", static_cast<uint64_t>(stats.evictions)},
+            {"SIZE", static_cast<uint64_t>(stats.size)}};
+    }
+
+    if (name == ov::intel_cpu::cpu_zero_copy_fallbacks) {
+        return m_registeredBuffers->fallbacks();
+    }
+
+    if (name == ov::intel_cpu::cpu_reference_fallbacks) {
+        std::vector<std::vector<NodePtr>> graphsNodes;
+        for (const auto& graph : m_graphs) {
+            if (!graph.IsReady()) {
+                continue;
+            }
+            graphsNodes.push_back(graph.GetNodes());
+        }
+        return node::Reference::fallbackReport(graphsNodes);
+    }
+
     Config engConfig = get_graph()._graph.getConfig();
     auto option = engConfig._config.find(name);
     if (option != engConfig._config.end()) {
@@ -401,9 +494,31 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
 
 void CompiledModel::export_model(std::ostream& modelStream) const {
     ModelSerializer serializer(modelStream, m_cfg.cacheEncrypt);
+    if (!m_has_sub_compiled_models) {
+        const auto graphLock = get_graph();
+        const auto& memoryControl = graphLock._graph.getGraphContext()->getAuxiliaryNetworkMemoryControl();
+        serializer.set_memory_plans(memoryControl->getMemoryPlans());
+    }
     serializer << m_model;
 }
 
+void CompiledModel::set_property(const ov::AnyMap& properties) {
+    for (const auto& property : properties) {
+        if (property.first != ov::intel_cpu::cpu_registered_buffers.name() &&
+            property.first != ov::intel_cpu::cpu_unregister_buffers.name()) {
+            OPENVINO_THROW_NOT_IMPLEMENTED("It's not possible to set property of an already compiled model. "
+                                           "Set property to Core::compile_model during compilation");
+        }
+    }
+    for (const auto& property : properties) {
+        if (property.first == ov::intel_cpu::cpu_registered_buffers.name()) {
+            m_registeredBuffers->add(property.second.as<ov::AnyMap>(), inputs(), outputs());
+        } else {
+            m_registeredBuffers->remove(property.second.as<ov::AnyMap>(), inputs(), outputs());
+        }
+    }
+}
+
 void CompiledModel::release_memory() {
     for (auto&& graph : m_graphs) {
         // try to lock mutex, since it may be already locked (e.g by an infer request)
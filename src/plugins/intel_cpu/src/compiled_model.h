@@ -13,8 +13,10 @@
 #include <utility>
 #include <vector>
 
+#include "cache/multi_cache.h"
 #include "config.h"
 #include "graph.h"
+#include "memory_plan.hpp"
 #include "openvino/core/any.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/model.hpp"
@@ -23,7 +25,9 @@
 #include "openvino/runtime/iplugin.hpp"
 #include "openvino/runtime/isync_infer_request.hpp"
 #include "openvino/runtime/threading/itask_executor.hpp"
+#include "registered_buffers.hpp"
 #include "sub_memory_manager.hpp"
+#include "utils/kernel_warmup_cache.hpp"
 #include "weights_cache.hpp"
 
 namespace ov::intel_cpu {
@@ -44,7 +48,8 @@ public:
                   const std::shared_ptr<const ov::IPlugin>& plugin,
                   Config cfg,
                   bool loaded_from_cache,
-                  std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr);
+                  std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr,
+                  MemoryPlans memory_plans = {});
 
     ~CompiledModel() override;
 
@@ -56,13 +61,19 @@ public:
 
     ov::Any get_property(const std::string& name) const override;
 
-    void set_property([[maybe_unused]] const ov::AnyMap& properties) override {
-        OPENVINO_THROW_NOT_IMPLEMENTED("It's not possible to set property of an already compiled model. "
-                                       "Set property to Core::compile_model during compilation");
-    };
+    // only ov::intel_cpu::cpu_registered_buffers and ov::intel_cpu::cpu_unregister_buffers can be set to an already
+    // compiled model
+    void set_property(const ov::AnyMap& properties) override;
 
     void release_memory() override;
 
+    /**
+     * @brief Replays the input shapes recorded by the previous runs of the model to create the JIT kernels and
+     * primitives in advance. Does nothing unless ov::intel_cpu::cpu_kernel_warmup is enabled.
+     * Blocks the caller for up to KernelWarmupCache::maxReplays inferences per stream.
+     */
+    void warm_up_kernels() const;
+
     std::string name() const {
         return m_name;
     }
@@ -87,6 +98,12 @@ private:
     // WARNING: Do not use m_graphs directly.
     mutable std::deque<GraphGuard> m_graphs;
     mutable SocketsWeights m_socketWeights;
+    // primitive cache shared by the graphs of all the streams
+    MultiCachePtr m_sharedParamsCache;
+    // input shapes storage used to warm up the runtime caches of the dynamic models, empty if disabled
+    KernelWarmupCache::Ptr m_kernelWarmupCache;
+    // the buffers bound to the infer requests without a copy, shared by all the streams
+    std::shared_ptr<RegisteredBuffers> m_registeredBuffers;
 
     /* WARNING: Use get_graph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -100,6 +117,8 @@ private:
 
     std::vector<std::shared_ptr<CompiledModel>> m_sub_compiled_models;
     std::shared_ptr<SubMemoryManager> m_sub_memory_manager = nullptr;
+    // the static memory plans imported with the model, reused by the graphs to skip the memory solver
+    MemoryPlans m_memory_plans;
     bool m_has_sub_compiled_models = false;
     bool m_optimized_single_stream = false;
 };
@@ -152,6 +171,14 @@ public:
         return m_id;
     }
 
+    [[nodiscard]] const KernelWarmupCache::Ptr& kernel_warmup_cache() const {
+        return m_compiled_model->m_kernelWarmupCache;
+    }
+
+    [[nodiscard]] RegisteredBuffers& registered_buffers() const {
+        return *m_compiled_model->m_registeredBuffers;
+    }
+
 private:
     std::shared_ptr<const CompiledModel> m_compiled_model;
     const Graph* m_graph;
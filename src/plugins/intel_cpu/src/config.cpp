@@ -275,6 +275,70 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
             // any negative value will be treated
             // as zero that means disabling the cache
             rtCacheCapacity = std::max(val_i, 0);
+        } else if (ov::intel_cpu::cpu_weights_sharing_across_models.name() == key) {
+            try {
+                shareWeightsAcrossModels = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_weights_sharing_across_models.name(),
+                               ". Expected only true/false");
+            }
+        } else if (ov::intel_cpu::cpu_repacked_weights_dir.name() == key) {
+            repackedWeightsDir = val.as<std::string>();
+        } else if (ov::intel_cpu::cpu_hw_perf_counters.name() == key) {
+            try {
+                collectHwPerfCounters = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_hw_perf_counters.name(),
+                               ". Expected only true/false");
+            }
+        } else if (ov::intel_cpu::cpu_huge_pages_arena.name() == key) {
+            try {
+                hugePagesArena = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_huge_pages_arena.name(),
+                               ". Expected only true/false");
+            }
+        } else if (ov::intel_cpu::cpu_kernel_warmup.name() == key) {
+            try {
+                enableKernelWarmup = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_kernel_warmup.name(),
+                               ". Expected only true/false");
+            }
+        } else if (ov::intel_cpu::cpu_kernel_warmup_dir.name() == key) {
+            kernelWarmupCacheDir = val.as<std::string>();
+        } else if (ov::intel_cpu::cpu_strict_zero_copy.name() == key) {
+            try {
+                strictZeroCopy = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_strict_zero_copy.name(),
+                               ". Expected only true/false");
+            }
+        } else if (ov::intel_cpu::cpu_shape_infer_cache.name() == key) {
+            try {
+                shapeInferCache = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_shape_infer_cache.name(),
+                               ". Expected only true/false");
+            }
         } else if (ov::intel_cpu::denormals_optimization.name() == key) {
             try {
                 denormalsOptMode = val.as<bool>() ? DenormalsOptMode::DO_On : DenormalsOptMode::DO_Off;
@@ -319,7 +383,12 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
             try {
                 kvCachePrecisionSetExplicitly = true;
                 const auto prec = val.as<ov::element::Type>();
-                if (one_of(prec, ov::element::f32, ov::element::f16, ov::element::bf16, ov::element::u8)) {
+                if (one_of(prec,
+                           ov::element::f32,
+                           ov::element::f16,
+                           ov::element::bf16,
+                           ov::element::u8,
+                           ov::element::u4)) {
                     kvCachePrecision = prec;
                 } else {
                     OPENVINO_THROW("invalid value");
@@ -329,7 +398,7 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
                                val.as<std::string>(),
                                " for property key ",
                                ov::hint::kv_cache_precision.name(),
-                               ". Supported values: u8, bf16, f16, f32");
+                               ". Supported values: u4, u8, bf16, f16, f32");
             }
         } else if (key == ov::key_cache_precision.name()) {
             try {
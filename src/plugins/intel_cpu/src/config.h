@@ -50,6 +50,7 @@ struct Config {
     enum class ModelType : uint8_t { CNN, LLM, Unknown };
 
     bool collectPerfCounters = false;
+    bool collectHwPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     SnippetsMode snippetsMode = SnippetsMode::Enable;
     std::string dumpToDot;
@@ -77,6 +78,15 @@ struct Config {
     // TODO: Executor cache may leads to incorrect behavior on oneDNN ACL primitives
     size_t rtCacheCapacity = 0ul;
 #endif
+    bool shareWeightsAcrossModels = false;
+    std::string repackedWeightsDir;
+    bool hugePagesArena = false;
+    bool enableKernelWarmup = false;
+    bool shapeInferCache = false;
+    bool strictZeroCopy = false;
+    // ov::intel_cpu::cpu_kernel_warmup_dir or, if it is not set, ov::cache_dir of the device;
+    // kernel warm-up is disabled when it is empty
+    std::string kernelWarmupCacheDir;
     size_t keyCacheGroupSize = 0ul;
     size_t valueCacheGroupSize = 0ul;
     CacheQuantMode keyCacheQuantMode = CacheQuantMode::AUTO;
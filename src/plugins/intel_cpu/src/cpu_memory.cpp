@@ -38,10 +38,18 @@
 #include "utils/debug_capabilities.h"
 #include "utils/general_utils.h"
 #if defined(__linux__)
+#    include <sys/mman.h>
 #    include <unistd.h>
 
+#    include <cstdio>
 #    include <cstring> /* strerror(errno) */
+#    include <fstream>
+#    include <string>
 #    include <utility>
+
+#    if !defined(MAP_HUGE_2MB)
+#        define MAP_HUGE_2MB (21 << 26)  // log2(2 MB) << MAP_HUGE_SHIFT
+#    endif
 #endif
 
 namespace ov::intel_cpu {
@@ -257,27 +265,130 @@ void* MemoryBlockWithReuse::getRawPtr() const noexcept {
 void MemoryBlockWithReuse::setExtBuff(void* ptr, size_t size) {
     m_useExternalStorage = true;
     m_memUpperBound = size;
+    m_pageSize = 0UL;
+    m_transparentHugePages = false;
     m_data = decltype(m_data)(ptr, release);
 }
 
+namespace {
+
+size_t systemPageSize() {
+#if defined(__linux__)
+    static const auto pageSize = static_cast<size_t>(getpagesize());
+    return pageSize;
+#else
+    return 4096;
+#endif
+}
+
+/**
+ * Allocates the memory rounded up to the huge pages, returns nullptr if neither explicit nor transparent huge pages
+ * are supported by the system.
+ * The transparent huge pages are only advised, so the kernel may still back some of them with the regular pages.
+ */
+std::unique_ptr<void, std::function<void(void*)>> allocateHugePages(size_t size,
+                                                                    size_t& allocatedSize,
+                                                                    bool& transparent) {
+    transparent = false;
+#if defined(__linux__)
+    constexpr size_t hugePageSize = MemoryBlockWithReuse::hugePageSize;
+    allocatedSize = rnd_up(size, hugePageSize);
+    void* ptr = mmap(nullptr,
+                     allocatedSize,
+                     PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | MAP_HUGE_2MB,
+                     -1,
+                     0);
+    if (ptr != MAP_FAILED) {
+        return {ptr, [allocatedSize](void* p) {
+                    munmap(p, allocatedSize);
+                }};
+    }
+    DEBUG_LOG("Explicit huge pages allocation of ", allocatedSize, " bytes failed: ", strerror(errno));
+
+    ptr = dnnl::impl::malloc(allocatedSize, hugePageSize);
+    if (!ptr) {
+        return {nullptr, [](void*) {}};
+    }
+    std::unique_ptr<void, std::function<void(void*)>> data(ptr, [](void* p) {
+        dnnl::impl::free(p);
+    });
+    if (madvise(ptr, allocatedSize, MADV_HUGEPAGE) != 0) {
+        DEBUG_LOG("Transparent huge pages are not available: ", strerror(errno));
+        return {nullptr, [](void*) {}};
+    }
+    transparent = true;
+    return data;
+#else
+    allocatedSize = size;
+    return {nullptr, [](void*) {}};
+#endif
+}
+
+/**
+ * The page size the advised transparent huge pages are actually backed with: the huge page size if the kernel has
+ * mapped any of them (AnonHugePages of the mapping in /proc/self/smaps), the regular page size otherwise. The pages
+ * are populated on the first touch, so the value may change after the memory is used.
+ */
+size_t transparentHugePagesPageSize([[maybe_unused]] const void* ptr) {
+#if defined(__linux__)
+    const auto address = reinterpret_cast<uintptr_t>(ptr);
+    std::ifstream smaps("/proc/self/smaps");
+    bool inMapping = false;
+    for (std::string line; std::getline(smaps, line);) {
+        unsigned long long begin = 0;
+        unsigned long long end = 0;
+        // the mapping header is "begin-end perms ...", the attribute lines are "Name: value kB"
+        if (std::sscanf(line.c_str(), "%llx-%llx ", &begin, &end) == 2) {
+            inMapping = address >= begin && address < end;
+        } else if (inMapping && line.rfind("AnonHugePages:", 0) == 0) {
+            size_t anonHugePagesKb = 0;
+            std::sscanf(line.c_str(), "AnonHugePages: %zu", &anonHugePagesKb);
+            return anonHugePagesKb > 0 ? MemoryBlockWithReuse::hugePageSize : systemPageSize();
+        }
+    }
+#endif
+    return systemPageSize();
+}
+
+}  // namespace
+
 bool MemoryBlockWithReuse::resize(size_t size) {
     constexpr int cacheLineSize = 64;
     bool sizeChanged = false;
     if (size > m_memUpperBound) {
-        void* ptr = dnnl::impl::malloc(size, cacheLineSize);
-        if (!ptr) {
-            OPENVINO_THROW("Failed to allocate ", size, " bytes of memory");
+        decltype(m_data) data(nullptr, release);
+        size_t allocatedSize = size;
+        size_t pageSize = systemPageSize();
+        bool transparentHugePages = false;
+        // the huge pages are not worth it for the small blocks, since they are rounded up to the huge page size
+        if (m_hugePages && size >= hugePageSize) {
+            data = allocateHugePages(size, allocatedSize, transparentHugePages);
+            pageSize = hugePageSize;
+        }
+        if (!data) {
+            void* ptr = dnnl::impl::malloc(size, cacheLineSize);
+            if (!ptr) {
+                OPENVINO_THROW("Failed to allocate ", size, " bytes of memory");
+            }
+            data = decltype(m_data)(ptr, destroy);
+            allocatedSize = size;
+            pageSize = systemPageSize();
+            transparentHugePages = false;
         }
-        m_memUpperBound = size;
-        m_useExternalStorage = false;
-        m_data = decltype(m_data)(ptr, destroy);
-        sizeChanged = true;
 
         if (numa_node >= 0) {
-            if (!mbind_move(ptr, size, numa_node)) {
+            if (!mbind_move(data.get(), allocatedSize, numa_node)) {
                 DEBUG_LOG("MemoryBlockWithReuse move_memory to node ", numa_node, " failed\n");
             }
         }
+
+        m_memUpperBound = size;
+        m_pageSize = pageSize;
+        m_transparentHugePages = transparentHugePages;
+        m_useExternalStorage = false;
+        m_data = std::move(data);
+        sizeChanged = true;
     }
     return sizeChanged;
 }
@@ -289,6 +400,8 @@ bool MemoryBlockWithReuse::hasExtBuffer() const noexcept {
 void MemoryBlockWithReuse::free() {
     m_data = decltype(m_data)(nullptr, release);
     m_memUpperBound = 0UL;
+    m_pageSize = 0UL;
+    m_transparentHugePages = false;
     m_useExternalStorage = false;
 }
 
@@ -296,6 +409,13 @@ size_t MemoryBlockWithReuse::size() const {
     return m_memUpperBound;
 }
 
+size_t MemoryBlockWithReuse::pageSize() const {
+    if (m_transparentHugePages && m_data) {
+        return transparentHugePagesPageSize(m_data.get());
+    }
+    return m_pageSize;
+}
+
 void MemoryBlockWithReuse::release(void* ptr) {}
 
 void MemoryBlockWithReuse::destroy(void* ptr) {
@@ -7,6 +7,7 @@
 #include <cpu_shape.h>
 
 #include <cstddef>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <oneapi/dnnl/dnnl.hpp>
@@ -74,23 +75,40 @@ public:
 };
 
 /**
- * @brief An implementation of the mem block where memory reallocation occurs only if a bigger buffer is requested.
+ * @brief The memory block which reallocates the memory only if the requested size exceeds the already allocated one.
+ * @param numa_node the NUMA node the allocated memory is bound to, -1 means no binding
+ * @param huge_pages back the allocations which are not smaller than a huge page with the 2 MB pages: the explicit ones
+ * from the reserved pool (vm.nr_hugepages) if available, the transparent ones otherwise
  */
 class MemoryBlockWithReuse : public IMemoryBlock {
 public:
-    MemoryBlockWithReuse(int numa_node = -1) : m_data(nullptr, release), numa_node(numa_node) {}
+    MemoryBlockWithReuse(int numa_node = -1, bool huge_pages = false)
+        : m_data(nullptr, release),
+          numa_node(numa_node),
+          m_hugePages(huge_pages) {}
     [[nodiscard]] void* getRawPtr() const noexcept override;
     void setExtBuff(void* ptr, size_t size) override;
     bool resize(size_t size) override;
     [[nodiscard]] bool hasExtBuffer() const noexcept override;
     void free();
-    [[nodiscard]] size_t size() const;  // in bytes
+    [[nodiscard]] size_t size() const;      // in bytes
+    // in bytes, of the allocated memory, 0 if nothing is allocated; for the transparent huge pages the size the kernel
+    // has actually backed the memory with
+    [[nodiscard]] size_t pageSize() const;
+    [[nodiscard]] int numaNode() const {
+        return numa_node;
+    }
+
+    static constexpr size_t hugePageSize = 2 * 1024 * 1024;
 
 private:
     bool m_useExternalStorage = false;
     size_t m_memUpperBound = 0ul;
-    std::unique_ptr<void, void (*)(void*)> m_data;
+    size_t m_pageSize = 0ul;
+    bool m_transparentHugePages = false;
+    std::unique_ptr<void, std::function<void(void*)>> m_data;
     int numa_node;
+    bool m_hugePages;
 
     static void release(void* ptr);
     static void destroy(void* ptr);
@@ -309,4 +309,11 @@ std::string DnnlExtensionUtils::computeWeightsStringHash(const std::shared_ptr<c
     return std::to_string(desc_hash) + "_" + std::to_string(reinterpret_cast<uint64_t>(memory->getData()));
 }
 
+std::string DnnlExtensionUtils::computeWeightsLayoutHash(const std::shared_ptr<DnnlMemoryDesc>& srcDesc,
+                                                         const std::shared_ptr<DnnlMemoryDesc>& dstDesc) {
+    const auto src_hash = dnnl::impl::primitive_hashing::get_md_hash(*srcDesc->getDnnlDesc().get());
+    const auto dst_hash = dnnl::impl::primitive_hashing::get_md_hash(*dstDesc->getDnnlDesc().get());
+    return std::to_string(src_hash) + "_" + std::to_string(dst_hash);
+}
+
 }  // namespace ov::intel_cpu
@@ -130,6 +130,15 @@ public:
      */
     static std::string computeWeightsStringHash(const std::shared_ptr<const IMemory>& memory,
                                                 const std::shared_ptr<DnnlMemoryDesc>& dstDesc);
+
+    /**
+     * @brief Computes string hash of the weights repacking, which does not depend on the weights location
+     * @param srcDesc descriptor defining weights representation before repacking
+     * @param dstDesc descriptor defining weights representation after repacking
+     * @return string hash
+     */
+    static std::string computeWeightsLayoutHash(const std::shared_ptr<DnnlMemoryDesc>& srcDesc,
+                                                const std::shared_ptr<DnnlMemoryDesc>& dstDesc);
 };
 
 }  // namespace ov::intel_cpu
@@ -21,8 +21,8 @@ class DnnlScratchPad {
     dnnl::engine eng;
 
 public:
-    DnnlScratchPad(dnnl::engine eng, int numa_node = -1) : eng(std::move(eng)) {
-        auto baseMemoryBlock = make_unique<MemoryBlockWithReuse>(numa_node);
+    DnnlScratchPad(dnnl::engine eng, int numa_node = -1, bool huge_pages = false) : eng(std::move(eng)) {
+        auto baseMemoryBlock = make_unique<MemoryBlockWithReuse>(numa_node, huge_pages);
         baseBlockPtr = baseMemoryBlock.get();
         blockPtr = std::make_shared<DnnlMemoryBlock>(std::move(baseMemoryBlock));
     }
@@ -37,6 +37,13 @@ public:
         }
         return 0;
     }
+
+    [[nodiscard]] size_t pageSize() const {
+        if (baseBlockPtr) {
+            return baseBlockPtr->pageSize();
+        }
+        return 0;
+    }
 };
 
 using DnnlScratchPadPtr = std::shared_ptr<DnnlScratchPad>;
@@ -11,7 +11,9 @@
 #include "cache/multi_cache.h"
 #include "config.h"
 #include "dnnl_scratch_pad.h"
+#include "hw_perf_counters.hpp"
 #include "memory_control.hpp"
+#include "memory_plan.hpp"
 #include "nodes/memory.hpp"
 #include "openvino/runtime/system_conf.hpp"
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
@@ -25,17 +27,18 @@ GraphContext::GraphContext(Config config,
                            WeightsSharing::Ptr w_cache,
                            bool isGraphQuantized,
                            ov::threading::IStreamsExecutor::Ptr streamExecutor,
-                           std::shared_ptr<SubMemoryManager> sub_memory_manager)
+                           std::shared_ptr<SubMemoryManager> sub_memory_manager,
+                           MultiCachePtr sharedParamsCache,
+                           MemoryPlans memoryPlans)
     : m_config(std::move(config)),
       m_weightsCache(std::move(w_cache)),
       m_rtParamsCache(std::make_shared<MultiCache>(m_config.rtCacheCapacity)),
+      m_sharedParamsCache(sharedParamsCache ? std::move(sharedParamsCache) : m_rtParamsCache),
       m_isGraphQuantizedFlag(isGraphQuantized),
       m_streamExecutor(std::move(streamExecutor)),
       m_subMemoryManager(std::move(sub_memory_manager)),
 
-      m_memoryStatesRegister(std::make_shared<node::MemoryStatesRegister>()),
-      m_auxiliaryNetworkMemoryControl(std::make_shared<NetworkMemoryControl>()),
-      m_memoryControl(m_auxiliaryNetworkMemoryControl->createMemoryControlUnit("main")) {
+      m_memoryStatesRegister(std::make_shared<node::MemoryStatesRegister>()) {
     if (m_streamExecutor) {
         m_cpuStreamExecutor = std::dynamic_pointer_cast<ov::threading::CPUStreamsExecutor>(m_streamExecutor);
         m_numaNodeId = m_cpuStreamExecutor ? std::max(0, m_cpuStreamExecutor->get_numa_node_id()) : 0;
@@ -44,11 +47,25 @@ GraphContext::GraphContext(Config config,
             m_numNumaNodes = nNumaNodes;
         }
     }
+
+    MemoryArenaOptions arenaOptions;
+    if (m_config.hugePagesArena) {
+        arenaOptions.hugePages = true;
+        // the stream arena is bound to the node of the stream
+        arenaOptions.numaNode = (m_cpuStreamExecutor && m_numNumaNodes > 1) ? m_numaNodeId : -1;
+    }
+    m_auxiliaryNetworkMemoryControl = std::make_shared<NetworkMemoryControl>(std::move(memoryPlans), arenaOptions);
+    m_memoryControl = m_auxiliaryNetworkMemoryControl->createMemoryControlUnit("main");
+
+    if (m_config.collectPerfCounters && m_config.collectHwPerfCounters && HwPerfCounters::instance().available()) {
+        m_hwPerfCounters = &HwPerfCounters::instance();
+    }
+
     // primitive/executors can be shared across sub-stream
     // but scratch pad cannot be shared.
     int numaNum = std::max(m_numaNodeId + 1, m_numNumaNodes);
     for (int i = 0; i < numaNum; i++) {
-        m_rtScratchPads.push_back(std::make_shared<DnnlScratchPad>(getEngine(), i));
+        m_rtScratchPads.push_back(std::make_shared<DnnlScratchPad>(getEngine(), i, m_config.hugePagesArena));
     }
 }
 
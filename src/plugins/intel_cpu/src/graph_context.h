@@ -11,7 +11,9 @@
 #include "cache/multi_cache.h"
 #include "config.h"
 #include "dnnl_scratch_pad.h"
+#include "hw_perf_counters.hpp"
 #include "memory_control.hpp"
+#include "memory_plan.hpp"
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
 #include "sub_memory_manager.hpp"
@@ -35,7 +37,9 @@ public:
                  WeightsSharing::Ptr w_cache,
                  bool isGraphQuantized,
                  ov::threading::IStreamsExecutor::Ptr streamExecutor = nullptr,
-                 std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr);
+                 std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr,
+                 MultiCachePtr sharedParamsCache = nullptr,
+                 MemoryPlans memoryPlans = {});
 
     [[nodiscard]] const Config& getConfig() const {
         return m_config;
@@ -49,6 +53,15 @@ public:
         return m_rtParamsCache;
     }
 
+    /**
+     * @brief Returns the primitive cache shared between all the streams of the compiled model.
+     * Only the immutable objects which can be executed concurrently (i.e. oneDNN primitives with the user managed
+     * scratchpad) are allowed to be stored there. Falls back to the stream local cache if no shared one is provided.
+     */
+    [[nodiscard]] MultiCachePtr getSharedParamsCache() const {
+        return m_sharedParamsCache;
+    }
+
     [[nodiscard]] DnnlScratchPadPtr getScratchPad() const {
         return m_rtScratchPads[m_numaNodeId];
     }
@@ -79,6 +92,11 @@ public:
         return m_memoryStatesRegister;
     }
 
+    // nullptr if the hardware counters are not collected
+    [[nodiscard]] HwPerfCounters* getHwPerfCounters() const {
+        return m_hwPerfCounters;
+    }
+
     [[nodiscard]] const std::shared_ptr<MemoryControl>& getMemoryControl() const {
         return m_memoryControl;
     }
@@ -106,6 +124,8 @@ private:
     WeightsSharing::Ptr m_weightsCache;
     // primitive cache
     MultiCachePtr m_rtParamsCache;
+    // primitive cache shared across the streams
+    MultiCachePtr m_sharedParamsCache;
     // global scratch pad
     DnnlScratchPadPtr m_rtScratchPad;
 
@@ -122,6 +142,8 @@ private:
     int m_numNumaNodes = 1;
     int m_numaNodeId = 0;
 
+    HwPerfCounters* m_hwPerfCounters = nullptr;
+
     std::shared_ptr<node::MemoryStatesRegister> m_memoryStatesRegister;
     // auxiliary object to allow creating additional memory control objects if the main one cannot be used
     // i.e. fallback graph for dynamic in-place
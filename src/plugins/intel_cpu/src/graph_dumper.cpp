@@ -21,6 +21,7 @@
 #include <vector>
 
 #include "cpu_types.h"
+#include "hw_perf_counters.hpp"
 #include "node.h"
 #include "onednn/dnnl.h"
 #include "openvino/core/except.hpp"
@@ -119,6 +120,19 @@ std::map<std::string, std::string> extract_node_metadata(const NodePtr& node) {
         serialization_info[ov::exec_model_info::PERF_COUNTER] = "not_executed";  // it means it was not calculated yet
     }
 
+    if (node->PerfCounter().hasHwCounters()) {
+        // the average per execution, see ov::intel_cpu::cpu_hw_perf_counters
+        static const std::map<HwPerfCounters::Event, const char*> hwCounterKeys = {
+            {HwPerfCounters::CYCLES, "hwCycles"},
+            {HwPerfCounters::INSTRUCTIONS, "hwInstructions"},
+            {HwPerfCounters::LLC_REFERENCES, "hwLlcReferences"},
+            {HwPerfCounters::LLC_MISSES, "hwLlcMisses"},
+        };
+        for (const auto& [event, key] : hwCounterKeys) {
+            serialization_info[key] = std::to_string(node->PerfCounter().hwAvg(event));
+        }
+    }
+
     serialization_info[ov::exec_model_info::EXECUTION_ORDER] = std::to_string(node->getExecIndex());
 
     serialization_info[ov::exec_model_info::RUNTIME_PRECISION] = node->getRuntimePrecision().get_type_name();
@@ -0,0 +1,208 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "hw_perf_counters.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "utils/debug_capabilities.h"
+
+#if defined(__linux__)
+#    include <dirent.h>
+#    include <linux/perf_event.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+
+#    include <cerrno>
+#    include <cstdlib>
+#    include <cstring>
+#    include <unordered_set>
+#endif
+
+namespace ov::intel_cpu {
+
+#if defined(__linux__)
+namespace {
+
+int perfEventOpen(perf_event_attr& attr, int tid, int groupFd) {
+    return static_cast<int>(syscall(__NR_perf_event_open, &attr, tid, -1, groupFd, 0));
+}
+
+perf_event_attr makeAttr(HwPerfCounters::Event event, bool isLeader) {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    switch (event) {
+    case HwPerfCounters::CYCLES:
+        attr.config = PERF_COUNT_HW_CPU_CYCLES;
+        break;
+    case HwPerfCounters::INSTRUCTIONS:
+        attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+        break;
+    case HwPerfCounters::LLC_REFERENCES:
+        attr.config = PERF_COUNT_HW_CACHE_REFERENCES;
+        break;
+    case HwPerfCounters::LLC_MISSES:
+    default:
+        attr.config = PERF_COUNT_HW_CACHE_MISSES;
+        break;
+    }
+    // the user space only, to be allowed with the default kernel.perf_event_paranoid
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    if (isLeader) {
+        attr.read_format = PERF_FORMAT_GROUP;
+    }
+    return attr;
+}
+
+void closeAll(const std::vector<int>& fds) {
+    for (auto fd : fds) {
+        close(fd);
+    }
+}
+
+std::vector<int> openGroup(const std::vector<HwPerfCounters::Event>& events, int tid) {
+    std::vector<int> fds;
+    for (size_t i = 0; i < events.size(); i++) {
+        auto attr = makeAttr(events[i], i == 0);
+        const int fd = perfEventOpen(attr, tid, i == 0 ? -1 : fds.front());
+        if (fd < 0) {
+            DEBUG_LOG("Cannot open the perf events of the thread ", tid, ": ", strerror(errno));
+            closeAll(fds);
+            return {};
+        }
+        fds.push_back(fd);
+    }
+    return fds;
+}
+
+// adds the values of the group to the sample
+void readGroup(const std::vector<HwPerfCounters::Event>& events,
+               const std::vector<int>& fds,
+               HwPerfCounters::Sample& sample) {
+    if (fds.empty()) {
+        return;
+    }
+    // PERF_FORMAT_GROUP layout: the number of events followed by the values
+    std::array<uint64_t, 1 + HwPerfCounters::EVENTS_NUM> values{};
+    const auto bytes = static_cast<ssize_t>((1 + events.size()) * sizeof(uint64_t));
+    if (::read(fds.front(), values.data(), bytes) != bytes || values[0] != events.size()) {
+        return;
+    }
+    for (size_t i = 0; i < events.size(); i++) {
+        sample[events[i]] += values[i + 1];
+    }
+}
+
+std::unordered_set<int> processThreads() {
+    std::unordered_set<int> tids;
+    DIR* dir = opendir("/proc/self/task");
+    if (dir == nullptr) {
+        return tids;
+    }
+    while (const auto* entry = readdir(dir)) {
+        if (entry->d_name[0] != '.') {
+            tids.insert(std::atoi(entry->d_name));
+        }
+    }
+    closedir(dir);
+    return tids;
+}
+
+}  // namespace
+
+HwPerfCounters::HwPerfCounters() {
+    for (uint8_t i = 0; i < EVENTS_NUM; i++) {
+        const auto event = static_cast<Event>(i);
+        auto attr = makeAttr(event, true);
+        const int fd = perfEventOpen(attr, 0, -1);
+        if (fd < 0) {
+            DEBUG_LOG("perf event ", name(event), " is not available: ", strerror(errno));
+            continue;
+        }
+        close(fd);
+        m_events.push_back(event);
+    }
+}
+
+HwPerfCounters::~HwPerfCounters() {
+    for (const auto& thread : m_threads) {
+        closeAll(thread.second);
+    }
+}
+
+HwPerfCounters::Sample HwPerfCounters::read() const {
+    Sample sample{};
+    if (m_events.empty()) {
+        return sample;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto tids = processThreads();
+    for (auto it = m_threads.begin(); it != m_threads.end();) {
+        if (tids.count(it->first)) {
+            ++it;
+            continue;
+        }
+        // the final values of a finished thread stay readable, they are kept so the sum does not decrease
+        readGroup(m_events, it->second, m_retired);
+        closeAll(it->second);
+        it = m_threads.erase(it);
+    }
+    for (auto tid : tids) {
+        if (!m_threads.count(tid)) {
+            // an empty group is kept as well, not to retry the failed open on every read
+            m_threads.emplace(tid, openGroup(m_events, tid));
+        }
+    }
+    sample = m_retired;
+    for (const auto& thread : m_threads) {
+        readGroup(m_events, thread.second, sample);
+    }
+    return sample;
+}
+
+bool HwPerfCounters::available() const {
+    return !m_events.empty();
+}
+#else
+HwPerfCounters::HwPerfCounters() = default;
+
+HwPerfCounters::~HwPerfCounters() = default;
+
+HwPerfCounters::Sample HwPerfCounters::read() const {
+    return {};
+}
+
+bool HwPerfCounters::available() const {
+    return false;
+}
+#endif
+
+HwPerfCounters& HwPerfCounters::instance() {
+    static HwPerfCounters counters;
+    return counters;
+}
+
+const char* HwPerfCounters::name(Event event) {
+    switch (event) {
+    case CYCLES:
+        return "cycles";
+    case INSTRUCTIONS:
+        return "instructions";
+    case LLC_REFERENCES:
+        return "llc_references";
+    case LLC_MISSES:
+        return "llc_misses";
+    default:
+        return "unknown";
+    }
+}
+
+}  // namespace ov::intel_cpu
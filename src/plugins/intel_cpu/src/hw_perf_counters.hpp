@@ -0,0 +1,57 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Hardware performance counters of the process sampled with Linux perf_event_open.
+ * A counter group is opened per thread of the process, a sample is the sum over all the groups, so the difference of
+ * two samples also covers the parts of the node executed by the worker threads of the parallel runtime. The groups of
+ * the new threads are opened and the ones of the finished threads are retired on every read, so a thread is counted
+ * from the first read it is seen by (the worker pools are persistent). With several streams executed at the same time
+ * the work of the other streams is counted as well.
+ * The counters are not available on the other OSes and if perf events are forbidden (kernel.perf_event_paranoid).
+ */
+class HwPerfCounters {
+public:
+    enum Event : uint8_t { CYCLES, INSTRUCTIONS, LLC_REFERENCES, LLC_MISSES, EVENTS_NUM };
+
+    using Sample = std::array<uint64_t, EVENTS_NUM>;
+
+    // the last level cache line size the memory traffic is estimated with
+    static constexpr uint64_t cacheLineSize = 64;
+
+    static HwPerfCounters& instance();
+
+    HwPerfCounters(const HwPerfCounters&) = delete;
+    HwPerfCounters& operator=(const HwPerfCounters&) = delete;
+
+    [[nodiscard]] bool available() const;
+
+    // the counters of all the threads of the process, the unsupported events are always 0
+    [[nodiscard]] Sample read() const;
+
+    static const char* name(Event event);
+
+private:
+    HwPerfCounters();
+    ~HwPerfCounters();
+
+    std::vector<Event> m_events;  // the supported events, in the order of the group
+
+    mutable std::mutex m_mutex;
+    // the counter groups by the thread id, the first fd is the group leader, empty if the group cannot be opened
+    mutable std::unordered_map<int, std::vector<int>> m_threads;
+    mutable Sample m_retired{};  // the final values of the finished threads
+};
+
+}  // namespace ov::intel_cpu
@@ -44,8 +44,10 @@
 #include "openvino/runtime/tensor.hpp"
 #include "openvino/runtime/threading/cpu_message.hpp"
 #include "proxy_mem_blk.h"
+#include "registered_buffers.hpp"
 #include "utils/debug_capabilities.h"
 #include "utils/general_utils.h"
+#include "utils/kernel_warmup_cache.hpp"
 
 using OvString = ov::element_type_traits<ov::element::string>::value_type;
 
@@ -92,6 +94,25 @@ void SyncInferRequest::redefine_memory_for_input_nodes(Graph& graph) {
     }
 }
 
+void SyncInferRequest::record_input_shapes() {
+    const auto& warmupCache = m_compiled_model.kernel_warmup_cache();
+    if (!warmupCache || warmupCache->isFull()) {
+        return;
+    }
+    bool changed = m_last_input_shapes.size() != m_input_ports_map.size();
+    m_last_input_shapes.resize(m_input_ports_map.size());
+    for (const auto& input_port : m_input_ports_map) {
+        const auto& shape = get_tensor_ptr(input_port.second)->get_shape();
+        if (m_last_input_shapes[input_port.first] != shape) {
+            m_last_input_shapes[input_port.first] = shape;
+            changed = true;
+        }
+    }
+    if (changed) {
+        warmupCache->record(m_last_input_shapes);
+    }
+}
+
 void SyncInferRequest::update_external_tensor_ptrs() {
     // Update it due to batched_tensors case will update input tensor
     for (const auto& input : m_input_ports_map) {
@@ -124,6 +145,7 @@ void SyncInferRequest::infer() {
 
     if (graph.hasDynamicInput()) {
         redefine_memory_for_input_nodes(graph);
+        record_input_shapes();
     }
 
     change_default_ptr(graph);
@@ -197,39 +219,7 @@ void SyncInferRequest::change_default_ptr(Graph& graph) {
             continue;
         }
         const auto& childEdges = inputNodePtr->getChildEdges();
-        // Perform checks that the user's memory will not be modified
-        bool canBeInPlace = true;
-        for (const auto& childEdge : childEdges) {
-            auto ce = childEdge.lock();
-            if (!ce) {
-                OPENVINO_THROW("Node ", inputNodePtr->getName(), " contains empty child edge");
-            }
-
-            const auto& child = ce->getChild();
-
-            if (child->isConstant()) {
-                canBeInPlace = false;
-                break;
-            }
-
-            // the input memory should be referenced by the children, otherwise it should be written to a
-            // specific location
-            if (ce->inPlace(Edge::LOOK_DOWN)) {
-                canBeInPlace = false;
-                break;
-            }
-
-            if (auto result = ce->modifiedInPlace()) {
-                canBeInPlace = false;
-                break;
-            }
-
-            if (child->getType() == Type::Concatenation && child->isInPlace()) {
-                canBeInPlace = false;
-                break;
-            }
-        }
-        if (canBeInPlace) {
+        if (can_share_input_memory(graph, it.first)) {
             for (const auto& edge : childEdges) {
                 auto e = edge.lock();
                 if (!e) {
@@ -249,37 +239,7 @@ void SyncInferRequest::change_default_ptr(Graph& graph) {
             continue;
         }
 
-        bool canBeInPlace = true;
-        // Cannot be in-place after concat because concat is using different ptrs without offsets
-        auto parent = parentEdge->getParent();
-        NodePtr previousParent;
-        auto parent_port = parentEdge->getInputNum();
-        do {
-            previousParent = parent;
-            if (parent->getChildEdgesAtPort(parent_port).size() != 1 || parent->isConstant()) {
-                canBeInPlace = false;
-                break;
-            }
-            if (parent->getChildEdgeAt(parent_port)->inPlace(Edge::LOOK_UP)) {
-                canBeInPlace = false;
-                break;
-            }
-
-            const auto& parentEdges = parent->getParentEdges();
-            for (const auto& edge : parentEdges) {
-                auto e = edge.lock();
-                if (!e) {
-                    OPENVINO_THROW("Node ", parent->getName(), " contains empty parent edge");
-                }
-
-                if (parent_port == parent->inPlaceInputPort(e->getOutputNum())) {
-                    parent = e->getParent();
-                    parent_port = e->getInputNum();
-                    break;
-                }
-            }
-        } while (previousParent != parent);
-        if (canBeInPlace) {
+        if (can_share_output_memory(graph, it.first)) {
             change_edge_ptr(parentEdge, it.second);
         }
     }
@@ -383,7 +343,7 @@ void SyncInferRequest::set_tensor(const ov::Output<const ov::Node>& in_port, con
         tensor = ov::make_tensor(in_tensor->get_element_type(), in_port.get_shape(), in_tensor->data());
     }
     auto port_found = find_port(in_port);
-    auto mem_desc_ptr = MemoryDescUtils::generateCpuBlockedMemoryDesc(tensor);
+    const auto& registeredBuffers = m_compiled_model.registered_buffers();
     if (port_found.is_input()) {
         auto input_index = port_found.idx;
         const auto netInPrc = port.get_element_type();
@@ -418,22 +378,37 @@ void SyncInferRequest::set_tensor(const ov::Output<const ov::Node>& in_port, con
 
         auto&& graph = m_compiled_model.graph();
 
-        auto inputNode = graph.getInputNodeByIndex(input_index);
-        OPENVINO_ASSERT(inputNode, "CPU execution graph doesn't contain input node with index: ", input_index);
+        if (registeredBuffers.contains(*tensor, true, input_index)) {
+            // the layout of the buffer has been validated at the registration, whether the memory can be shared
+            // depends on the graph
+            if (!can_share_input_memory(graph, input_index)) {
+                on_zero_copy_fallback(true, input_index, true);
+            }
+            m_input_external_ptr[input_index] = tensor;
+        } else {
+            auto inputNode = graph.getInputNodeByIndex(input_index);
+            OPENVINO_ASSERT(inputNode, "CPU execution graph doesn't contain input node with index: ", input_index);
+
+            MemoryDescPtr actualDesc = inputNode->getBaseMemDescAtOutputPort(0);
+            if (!actualDesc->isDefined()) {
+                // we must define desc for dynamic case
+                // otherwise we got incorrect check on shape compatibility inside isCompatible
+                // because lower and upper bound will be compared
+                actualDesc = actualDesc->cloneWithNewDims(
+                    ov::is_scalar(tensor->get_shape()) ? VectorDims{1} : VectorDims{tensor->get_shape()});
+            }
 
-        MemoryDescPtr actualDesc = inputNode->getBaseMemDescAtOutputPort(0);
-        if (!actualDesc->isDefined()) {
-            // we must define desc for dynamic case
-            // otherwise we got incorrect check on shape compatibility inside isCompatible
-            // because lower and upper bound will be compared
-            actualDesc = actualDesc->cloneWithNewDims(
-                ov::is_scalar(tensor->get_shape()) ? VectorDims{1} : VectorDims{tensor->get_shape()});
-        }
+            auto mem_desc_ptr = MemoryDescUtils::generateCpuBlockedMemoryDesc(tensor);
+            const bool isCompatible = actualDesc->isCompatible(*mem_desc_ptr);
+            if (!isCompatible || !can_share_input_memory(graph, input_index)) {
+                on_zero_copy_fallback(true, input_index, isCompatible);
+            }
 
-        if (actualDesc->isCompatible(*mem_desc_ptr)) {
-            m_input_external_ptr[input_index] = tensor;
-        } else if (m_input_external_ptr.find(input_index) != m_input_external_ptr.end()) {
-            m_input_external_ptr.erase(input_index);
+            if (isCompatible) {
+                m_input_external_ptr[input_index] = tensor;
+            } else if (m_input_external_ptr.find(input_index) != m_input_external_ptr.end()) {
+                m_input_external_ptr.erase(input_index);
+            }
         }
     } else {
         auto output_index = port_found.idx;
@@ -470,13 +445,30 @@ void SyncInferRequest::set_tensor(const ov::Output<const ov::Node>& in_port, con
 
         auto&& graph = m_compiled_model.graph();
 
-        auto outputNode = graph.getOutputNodeByIndex(output_index);
-        OPENVINO_ASSERT(outputNode, "CPU execution graph doesn't contain output node with index: ", output_index);
-        const auto& desc = outputNode->getParentEdgeAt(0)->getMemory().getDesc();
-        if (!isDynamic && mem_desc_ptr->isCompatible(desc)) {
+        if (registeredBuffers.contains(*tensor, false, output_index)) {
+            // the layout of the buffer has been validated at the registration, whether the memory can be shared
+            // depends on the graph
+            if (!can_share_output_memory(graph, output_index)) {
+                on_zero_copy_fallback(false, output_index, true);
+            }
             m_output_external_ptr[output_index] = tensor;
-        } else if (m_output_external_ptr.find(output_index) != m_output_external_ptr.end()) {
-            m_output_external_ptr.erase(output_index);
+        } else {
+            auto outputNode = graph.getOutputNodeByIndex(output_index);
+            OPENVINO_ASSERT(outputNode, "CPU execution graph doesn't contain output node with index: ", output_index);
+            const auto& desc = outputNode->getParentEdgeAt(0)->getMemory().getDesc();
+            auto mem_desc_ptr = MemoryDescUtils::generateCpuBlockedMemoryDesc(tensor);
+            const bool isCompatible = !isDynamic && mem_desc_ptr->isCompatible(desc);
+            // a dynamic output is not a fallback: the graph writes it through the proxy memory block, which is
+            // rebound to the user tensor on each inference, so it is neither counted nor rejected in the strict mode
+            if (!isDynamic && (!isCompatible || !can_share_output_memory(graph, output_index))) {
+                on_zero_copy_fallback(false, output_index, isCompatible);
+            }
+
+            if (isCompatible) {
+                m_output_external_ptr[output_index] = tensor;
+            } else if (m_output_external_ptr.find(output_index) != m_output_external_ptr.end()) {
+                m_output_external_ptr.erase(output_index);
+            }
         }
 
         m_outputs[output_index] = tensor;
@@ -485,6 +477,36 @@ void SyncInferRequest::set_tensor(const ov::Output<const ov::Node>& in_port, con
     ov::ISyncInferRequest::set_tensor(port, tensor);
 }
 
+bool SyncInferRequest::can_share_input_memory(const Graph& graph, std::size_t index) const {
+    auto it = m_input_shareable.find(index);
+    if (it == m_input_shareable.end()) {
+        it = m_input_shareable.emplace(index, canShareInputMemory(graph, index)).first;
+    }
+    return it->second;
+}
+
+bool SyncInferRequest::can_share_output_memory(const Graph& graph, std::size_t index) const {
+    auto it = m_output_shareable.find(index);
+    if (it == m_output_shareable.end()) {
+        it = m_output_shareable.emplace(index, canShareOutputMemory(graph, index)).first;
+    }
+    return it->second;
+}
+
+void SyncInferRequest::on_zero_copy_fallback(bool is_input, std::size_t index, bool is_compatible) const {
+    const auto* const kind = is_input ? "input" : "output";
+    OPENVINO_ASSERT(!m_compiled_model.graph().getConfig().strictZeroCopy,
+                    "The ",
+                    kind,
+                    " tensor with index ",
+                    index,
+                    " cannot be used without a copy, ",
+                    is_compatible ? "the graph does not allow to share the memory of this port"
+                                  : "the tensor precision, shape or layout does not match the graph");
+    DEBUG_LOG("The ", kind, " tensor with index ", index, " is copied on each inference");
+    m_compiled_model.registered_buffers().countFallback(is_input);
+}
+
 void SyncInferRequest::set_tensors_impl(const ov::Output<const ov::Node> port,
                                         const std::vector<ov::SoPtr<ITensor>>& tensors) {
     if (find_port(port).is_input()) {
@@ -26,6 +26,7 @@
 #include "openvino/runtime/profiling_info.hpp"
 #include "openvino/runtime/so_ptr.hpp"
 #include "proxy_mem_blk.h"
+#include "utils/kernel_warmup_cache.hpp"
 
 namespace ov::intel_cpu {
 
@@ -112,8 +113,14 @@ private:
 
     void push_input_data(Graph& graph);
     void redefine_memory_for_input_nodes(Graph& graph);
+    void record_input_shapes();
     void update_external_tensor_ptrs();
     void change_default_ptr(Graph& graph);
+    // canShareInputMemory/canShareOutputMemory memoized by the port index, the graphs of all the streams are the same
+    bool can_share_input_memory(const Graph& graph, std::size_t index) const;
+    bool can_share_output_memory(const Graph& graph, std::size_t index) const;
+    // throws in the strict zero copy mode, counts the tensor otherwise
+    void on_zero_copy_fallback(bool is_input, std::size_t index, bool is_compatible) const;
 
     const ov::Output<const ov::Node>& get_internal_port(const ov::Output<const ov::Node>& port) const;
 
@@ -123,6 +130,8 @@ private:
 
     std::unordered_map<std::size_t, ov::SoPtr<ov::ITensor>> m_input_external_ptr;
     std::unordered_map<std::size_t, ov::SoPtr<ov::ITensor>> m_output_external_ptr;
+    mutable std::unordered_map<std::size_t, bool> m_input_shareable;
+    mutable std::unordered_map<std::size_t, bool> m_output_shareable;
 
     openvino::itt::handle_t m_profiling_task = nullptr;
     std::vector<MemStatePtr> m_memory_states;
@@ -132,6 +141,8 @@ private:
     std::unordered_map<std::size_t, ov::Output<const ov::Node>> m_input_ports_map;
     std::unordered_map<std::size_t, ov::Output<const ov::Node>> m_output_ports_map;
     std::unordered_map<std::size_t, ov::SoPtr<ov::ITensor>> m_outputs;
+    // the input shapes of the last inference, the kernel warm-up cache is only updated when they change
+    KernelWarmupCache::InputShapes m_last_input_shapes;
 };
 
 }  // namespace ov::intel_cpu
@@ -20,6 +20,98 @@ namespace ov::intel_cpu {
  */
 static constexpr Property<int32_t, PropertyMutability::RW> cpu_runtime_cache_capacity{"CPU_RUNTIME_CACHE_CAPACITY"};
 
+/**
+ * @brief Read-only statistics of the CPU runtime parameters cache of a compiled model accumulated over all the streams.
+ * The map contains the number of "HITS", "MISSES", "EVICTIONS" and the current number of stored records ("SIZE").
+ */
+static constexpr Property<ov::AnyMap, PropertyMutability::RO> cpu_runtime_cache_statistics{
+    "CPU_RUNTIME_CACHE_STATISTICS"};
+
+/**
+ * @brief Enables persistent kernel warm-up for dynamic models: the input shapes seen during the inference are stored
+ * under cpu_kernel_warmup_dir and replayed on the next compile/import, so the JIT kernels and primitives are created
+ * before the first user request.
+ * The replay is done by compile_model/import_model themselves: the load time grows by up to 16 inferences (one per
+ * recorded shape) on every stream, which is the price of the fast first requests.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_kernel_warmup{"CPU_KERNEL_WARMUP"};
+
+/**
+ * @brief Directory to store the input shapes replayed by the kernel warm-up. The ov::cache_dir of the device is used
+ * when it is empty (default).
+ */
+static constexpr Property<std::string, PropertyMutability::RW> cpu_kernel_warmup_dir{"CPU_KERNEL_WARMUP_DIR"};
+
+/**
+ * @brief Enables sharing of the repacked weights between all the compiled models of the process. The repacked weights
+ * are looked up by the content of the source weights, so the variants of the same model (different streams number,
+ * shapes or adapters) keep one copy.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_weights_sharing_across_models{
+    "CPU_WEIGHTS_SHARING_ACROSS_MODELS"};
+
+/**
+ * @brief Directory to persist the repacked weights shared across the models. The stored weights are mapped from the
+ * files by the next processes instead of being repacked. Empty value (default) disables the persistence.
+ */
+static constexpr Property<std::string, PropertyMutability::RW> cpu_repacked_weights_dir{"CPU_REPACKED_WEIGHTS_DIR"};
+
+/**
+ * @brief Backs the intermediate tensors and the scratchpads with 2 MB huge pages (explicit if reserved in the system,
+ * transparent otherwise) and binds them to the NUMA node of the stream. Reduces the TLB misses and the remote memory
+ * accesses for the large activations at the cost of rounding the buffers up to the huge page size.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_huge_pages_arena{"CPU_HUGE_PAGES_ARENA"};
+
+/**
+ * @brief Samples the hardware performance counters (cycles, instructions, LLC references and misses) around each node
+ * execution on Linux. All the threads of the process are counted, so the values are only attributed to the node with
+ * a single stream executed at a time. Only takes effect together with ov::enable_profiling. The average counters per
+ * execution are reported in the runtime model and in the verbose output of the debug capabilities.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_hw_perf_counters{"CPU_HW_PERF_COUNTERS"};
+
+/**
+ * @brief Memoizes the output shapes of the dynamic nodes by their input shapes, so the shape inference is skipped for
+ * the recently seen shape sets. Pays off for the models switching between a few shape sets only. Disabled by default.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_shape_infer_cache{"CPU_SHAPE_INFER_CACHE"};
+
+/**
+ * @brief Forbids the silent copies of the user tensors: set_tensor throws if the tensor cannot be bound to the graph
+ * without a copy (precision, layout or alignment mismatch, or the graph modifies the input memory in place).
+ * The outputs with the dynamic shape are not checked, the graph writes them through the proxy memory blocks.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_strict_zero_copy{"CPU_STRICT_ZERO_COPY"};
+
+/**
+ * @brief Registers the host buffers which are going to be set as the input and output tensors of the compiled model.
+ * The map key is a tensor name of the port, the value is an ov::Tensor or a std::vector<ov::Tensor>. The buffers are
+ * validated once (the buffer data must be 64 bytes aligned), so the infer requests bind them without a copy and without
+ * the per call checks.
+ */
+static constexpr Property<ov::AnyMap, PropertyMutability::WO> cpu_registered_buffers{"CPU_REGISTERED_BUFFERS"};
+
+/**
+ * @brief Unregisters the host buffers registered with ov::intel_cpu::cpu_registered_buffers, the map has the same
+ * format. The buffers already set to the infer requests stay bound until they are replaced.
+ */
+static constexpr Property<ov::AnyMap, PropertyMutability::WO> cpu_unregister_buffers{"CPU_UNREGISTER_BUFFERS"};
+
+/**
+ * @brief Read-only number of the "INPUTS" and "OUTPUTS" tensors set to the infer requests of a compiled model which
+ * could not be bound without a copy. The outputs with the dynamic shape are not counted.
+ */
+static constexpr Property<ov::AnyMap, PropertyMutability::RO> cpu_zero_copy_fallbacks{"CPU_ZERO_COPY_FALLBACKS"};
+
+/**
+ * @brief Read-only report of the ops executed by the reference implementations of the OpenVINO core, by the op type:
+ * the number of "NODES", the number of the nodes split across the threads by the last inference in any stream
+ * ("PARALLEL_NODES") and their share of the inference time of all the streams in percents ("TIME_SHARE", measured only
+ * with ov::enable_profiling). Only the streams which have already created their graphs are accounted.
+ */
+static constexpr Property<ov::AnyMap, PropertyMutability::RO> cpu_reference_fallbacks{"CPU_REFERENCE_FALLBACKS"};
+
 /**
  * @brief Enum to define possible snippets mode hints.
  */
@@ -8,6 +8,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <numeric>
 #include <queue>
@@ -19,6 +20,8 @@
 #include <vector>
 
 #include "cpu_memory.h"
+#include "hash_builder.hpp"
+#include "memory_plan.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/runtime/memory_solver.hpp"
 #include "utils/debug_capabilities.h"
@@ -63,8 +66,8 @@ private:
 
 class MemoryBlockWithRelease : public IMemoryBlockObserver {
 public:
-    MemoryBlockWithRelease() {
-        auto pInternalMem = make_unique<MemoryBlockWithReuse>();
+    explicit MemoryBlockWithRelease(const MemoryArenaOptions& arenaOptions = {}) {
+        auto pInternalMem = make_unique<MemoryBlockWithReuse>(arenaOptions.numaNode, arenaOptions.hugePages);
         m_pInternalMem = pInternalMem.get();
         m_pBlock = std::make_shared<DnnlMemoryBlock>(std::move(pInternalMem));
     }
@@ -95,6 +98,10 @@ public:
         return m_pInternalMem->size();
     }
 
+    [[nodiscard]] size_t pageSize() const {
+        return m_pInternalMem->pageSize();
+    }
+
 private:
     MemoryBlockPtr m_pBlock;
     MemoryBlockWithReuse* m_pInternalMem;
@@ -200,6 +207,10 @@ private:
 
 class MemoryManagerStatic : public IMemoryManager {
 public:
+    MemoryManagerStatic(std::shared_ptr<StaticMemoryPlan> plan, const MemoryArenaOptions& arenaOptions)
+        : m_plan(std::move(plan)),
+          m_arenaOptions(arenaOptions) {}
+
     void insert(const MemoryRegion& reg, [[maybe_unused]] const std::vector<size_t>& syncInds) override {
         OPENVINO_ASSERT(reg.size >= 0, getClassName(), ": got undefined block size");
         m_boxes.emplace_back(MemorySolver::Box{reg.start, reg.finish, reg.size, reg.id});
@@ -222,16 +233,69 @@ private:
             box.size = div_up(box.size, alignment);
         });
 
-        ov::MemorySolver staticMemSolver(boxes_to_process);
-        m_totalSize = static_cast<size_t>(staticMemSolver.solve()) * alignment;
+        if (!isPlanApplicable(boxes_to_process, alignment)) {
+            ov::MemorySolver staticMemSolver(boxes_to_process);
+            m_plan->totalSize = staticMemSolver.solve() * static_cast<int64_t>(alignment);
+            m_plan->offsets.clear();
+            for (const auto& box : boxes_to_process) {
+                const auto offset = staticMemSolver.get_offset(box.id) * static_cast<int64_t>(alignment);
+                m_plan->offsets.emplace_back(box.id, offset);
+            }
+            m_plan->boxesHash = hashBoxes(boxes_to_process);
+        }
+        m_totalSize = static_cast<size_t>(m_plan->totalSize);
+
+        m_workspace = std::make_shared<MemoryBlockWithRelease>(m_arenaOptions);
+
+        for (const auto& [id, offset] : m_plan->offsets) {
+            auto memoryBlock = std::make_shared<StaticPartitionMemoryBlock>(m_workspace, offset);
+            m_blocks[id] = std::move(memoryBlock);
+        }
+    }
 
-        m_workspace = std::make_shared<MemoryBlockWithRelease>();
+    static size_t hashBoxes(const std::vector<MemorySolver::Box>& boxes) {
+        size_t seed = hash::combine(0, boxes.size());
+        for (const auto& box : boxes) {
+            seed = hash::combine(seed, box.start);
+            seed = hash::combine(seed, box.finish);
+            seed = hash::combine(seed, box.size);
+            seed = hash::combine(seed, box.id);
+        }
+        return seed;
+    }
 
-        for (const auto& box : boxes_to_process) {
-            int64_t offset = staticMemSolver.get_offset(box.id);
-            auto memoryBlock = std::make_shared<StaticPartitionMemoryBlock>(m_workspace, offset * alignment);
-            m_blocks[box.id] = std::move(memoryBlock);
+    // the plan may come from the imported model, so it is validated against the current regions
+    bool isPlanApplicable(const std::vector<MemorySolver::Box>& boxes, size_t alignment) const {
+        if (m_plan->offsets.size() != boxes.size() || m_plan->boxesHash != hashBoxes(boxes)) {
+            return false;
+        }
+        for (size_t i = 0; i < boxes.size(); ++i) {
+            const auto& [id, offset] = m_plan->offsets[i];
+            if (id != boxes[i].id || offset < 0 ||
+                offset + boxes[i].size * static_cast<int64_t>(alignment) > m_plan->totalSize) {
+                return false;
+            }
         }
+        // the regions alive at the same time must not share the memory
+        std::vector<size_t> byOffset(boxes.size());
+        std::iota(byOffset.begin(), byOffset.end(), 0);
+        std::sort(byOffset.begin(), byOffset.end(), [&](size_t l, size_t r) {
+            return m_plan->offsets[l].second < m_plan->offsets[r].second;
+        });
+        auto lastUse = [](const MemorySolver::Box& box) {
+            return box.finish == -1 ? std::numeric_limits<int>::max() : box.finish;
+        };
+        for (size_t i = 0; i < byOffset.size(); ++i) {
+            const auto& box = boxes[byOffset[i]];
+            const auto end = m_plan->offsets[byOffset[i]].second + box.size * static_cast<int64_t>(alignment);
+            for (size_t j = i + 1; j < byOffset.size() && m_plan->offsets[byOffset[j]].second < end; ++j) {
+                const auto& other = boxes[byOffset[j]];
+                if (other.size > 0 && box.start <= lastUse(other) && other.start <= lastUse(box)) {
+                    return false;
+                }
+            }
+        }
+        return true;
     }
 
     void allocate() override {
@@ -251,6 +315,8 @@ private:
 
     MemoryControl::MemorySolution m_blocks;
     std::vector<MemorySolver::Box> m_boxes;
+    std::shared_ptr<StaticMemoryPlan> m_plan;
+    MemoryArenaOptions m_arenaOptions;
     std::shared_ptr<MemoryBlockWithRelease> m_workspace;
     size_t m_totalSize = 0;
     bool reset_flag = true;
@@ -259,6 +325,8 @@ private:
 
 class MemoryManagerNonOverlappingSets : public IMemoryManager {
 public:
+    explicit MemoryManagerNonOverlappingSets(const MemoryArenaOptions& arenaOptions) : m_arenaOptions(arenaOptions) {}
+
     void insert(const MemoryRegion& reg, const std::vector<size_t>& syncInds) override {
         MemorySolver::Box box = {reg.start, reg.finish, reg.size, reg.id};
         if (-1 != reg.finish) {
@@ -324,7 +392,7 @@ private:
             }
         }
         for (auto& group : groups) {
-            auto unique_block = std::make_shared<MemoryBlockWithRelease>();
+            auto unique_block = std::make_shared<MemoryBlockWithRelease>(m_arenaOptions);
             for (auto& box : group) {
                 m_internalBlocks.insert({box.id, internalBlock(unique_block)});
             }
@@ -347,6 +415,7 @@ private:
     MemoryControl::MemorySolution m_blocks;
     std::vector<MemorySolver::Box> m_boxes;
     std::unordered_map<MemoryControl::MemorySolution::key_type, std::shared_ptr<InternalBlock>> m_internalBlocks;
+    MemoryArenaOptions m_arenaOptions;
     bool reset_flag = true;
     CPU_DEBUG_CAP_ENABLE(friend MemoryStatisticsRecord dumpStatisticsImpl(const MemoryManagerNonOverlappingSets& obj);)
 };
@@ -392,12 +461,20 @@ MemoryStatisticsRecord dumpStatisticsImpl(const MemoryManagerIO& obj) {
                                            [](size_t acc, const MemoryManagerIO::BlockType& item) {
                                                return std::max(acc, item.size());
                                            });
+    auto page_size = std::accumulate(obj.m_blocks.begin(),
+                                     obj.m_blocks.end(),
+                                     static_cast<size_t>(0),
+                                     [](size_t acc, const MemoryManagerIO::BlockType& item) {
+                                         return std::max(acc, item.pageSize());
+                                     });
     return {MemoryManagerIO::getClassName(),
             obj.m_blocks.size(),  // as the number of blocks ie equal to regions
             obj.m_blocks.size(),
             total_size,
             total_size,
-            max_region_size};
+            max_region_size,
+            page_size,
+            -1};
 }
 
 MemoryStatisticsRecord dumpStatisticsImpl(const MemoryManagerStatic& obj) {
@@ -410,7 +487,9 @@ MemoryStatisticsRecord dumpStatisticsImpl(const MemoryManagerStatic& obj) {
             1,  // in fact there is only one unique block
             obj.m_totalSize,
             static_cast<size_t>(optimal_total_size),
-            static_cast<size_t>(max_region_size)};
+            static_cast<size_t>(max_region_size),
+            obj.m_workspace ? obj.m_workspace->pageSize() : 0,
+            obj.m_arenaOptions.numaNode};
 }
 
 MemoryStatisticsRecord dumpStatisticsImpl(const MemoryManagerNonOverlappingSets& obj) {
@@ -428,6 +507,12 @@ MemoryStatisticsRecord dumpStatisticsImpl(const MemoryManagerNonOverlappingSets&
                                       [](size_t acc, const auto& item) {
                                           return acc + item->size();
                                       });
+    auto page_size = std::accumulate(uniqueBlocks.begin(),
+                                     uniqueBlocks.end(),
+                                     static_cast<size_t>(0),
+                                     [](size_t acc, const auto& item) {
+                                         return std::max(acc, item->pageSize());
+                                     });
 
     auto [optimal_total_size, max_region_size] = [&obj]() {
         auto tmp_boxes = obj.m_boxes;
@@ -443,7 +528,9 @@ MemoryStatisticsRecord dumpStatisticsImpl(const MemoryManagerNonOverlappingSets&
             uniqueBlocks.size(),
             total_size,
             static_cast<size_t>(optimal_total_size),
-            static_cast<size_t>(max_region_size)};
+            static_cast<size_t>(max_region_size),
+            page_size,
+            obj.m_arenaOptions.numaNode};
 }
 #endif
 
@@ -516,18 +603,25 @@ MemoryControl::RegionHandlerPtr buildHandler(F&& f, Args&&... args) {
 
 }  // namespace
 
-MemoryControl::MemoryControl(std::string id) : m_id(std::move(id)) {
+MemoryControl::MemoryControl(std::string id, StaticMemoryPlan staticMemoryPlan, MemoryArenaOptions arenaOptions)
+    : m_id(std::move(id)),
+      m_staticMemoryPlan(std::make_shared<StaticMemoryPlan>(std::move(staticMemoryPlan))) {
     // init handlers
-    m_handlers.emplace_back(buildHandler<MemoryManagerStatic>([](const MemoryRegion& reg) {
-        return reg.size >= 0 && MemoryRegion::RegionType::VARIABLE == reg.type &&
-               MemoryRegion::AllocType::POD == reg.alloc_type;
-    }));
+    m_handlers.emplace_back(buildHandler<MemoryManagerStatic>(
+        [](const MemoryRegion& reg) {
+            return reg.size >= 0 && MemoryRegion::RegionType::VARIABLE == reg.type &&
+                   MemoryRegion::AllocType::POD == reg.alloc_type;
+        },
+        m_staticMemoryPlan,
+        arenaOptions));
 
     // handler for static tensors
-    m_handlers.emplace_back(buildHandler<MemoryManagerNonOverlappingSets>([](const MemoryRegion& reg) {
-        return reg.size < 0 && MemoryRegion::RegionType::VARIABLE == reg.type &&
-               MemoryRegion::AllocType::POD == reg.alloc_type;
-    }));
+    m_handlers.emplace_back(buildHandler<MemoryManagerNonOverlappingSets>(
+        [](const MemoryRegion& reg) {
+            return reg.size < 0 && MemoryRegion::RegionType::VARIABLE == reg.type &&
+                   MemoryRegion::AllocType::POD == reg.alloc_type;
+        },
+        arenaOptions));
 
     // handler for I/O tensors, so far simply individual blocks
     m_handlers.emplace_back(buildHandler<MemoryManagerIO>([](const MemoryRegion& reg) {
@@ -589,7 +683,12 @@ MemoryStatistics MemoryControl::dumpStatistics() const {
 #endif  // CPU_DEBUG_CAPS
 
 MemoryControl::Ptr NetworkMemoryControl::createMemoryControlUnit(std::string id) {
-    m_controlUnits.emplace_back(std::shared_ptr<MemoryControl>(new MemoryControl(std::move(id))));
+    StaticMemoryPlan plan;
+    if (auto it = m_memoryPlans.find(id); it != m_memoryPlans.end()) {
+        plan = it->second;
+    }
+    m_controlUnits.emplace_back(
+        std::shared_ptr<MemoryControl>(new MemoryControl(std::move(id), std::move(plan), m_arenaOptions)));
     return m_controlUnits.back();
 }
 
@@ -605,6 +704,17 @@ void NetworkMemoryControl::releaseMemory() {
     }
 }
 
+MemoryPlans NetworkMemoryControl::getMemoryPlans() const {
+    MemoryPlans plans;
+    for (auto&& item : m_controlUnits) {
+        const auto& plan = item->getStaticMemoryPlan();
+        if (!plan.empty()) {
+            plans.emplace(item->getId(), plan);
+        }
+    }
+    return plans;
+}
+
 std::vector<std::pair<std::string, MemoryStatistics>> NetworkMemoryControl::dumpStatistics() const {
 #ifdef CPU_DEBUG_CAPS
     std::vector<std::pair<std::string, MemoryStatistics>> retVal;
@@ -14,6 +14,7 @@
 
 #include "cpu_memory.h"
 #include "edge.h"
+#include "memory_plan.hpp"
 
 namespace ov::intel_cpu {
 
@@ -38,6 +39,14 @@ struct MemoryStatisticsRecord {
     size_t total_size;           // bytes
     size_t optimal_total_size;   // bytes
     size_t max_region_size;      // bytes
+    size_t page_size;            // bytes, the largest page size the blocks are backed with
+    int numa_node;               // the node the blocks are bound to, -1 if not bound
+};
+
+// placement of the memory allocated by the memory control units for the intermediate tensors
+struct MemoryArenaOptions {
+    int numaNode = -1;       // -1 means no binding
+    bool hugePages = false;  // back the large blocks with 2 MB pages, see MemoryBlockWithReuse
 };
 
 using MemoryStatistics = std::vector<MemoryStatisticsRecord>;
@@ -66,14 +75,20 @@ public:
         return m_id;
     }
 
+    // the plan of the last solution of the static regions
+    [[nodiscard]] const StaticMemoryPlan& getStaticMemoryPlan() const {
+        return *m_staticMemoryPlan;
+    }
+
 private:
-    explicit MemoryControl(std::string id);
+    MemoryControl(std::string id, StaticMemoryPlan staticMemoryPlan, MemoryArenaOptions arenaOptions);
     void insert(const MemoryRegion& region, const std::vector<size_t>& syncInds);
     [[nodiscard]] MemoryStatistics dumpStatistics() const;
 
     friend class NetworkMemoryControl;
 
     std::string m_id;
+    std::shared_ptr<StaticMemoryPlan> m_staticMemoryPlan;
     std::vector<RegionHandlerPtr> m_handlers;
     bool m_allocated = false;
 };
@@ -81,6 +96,14 @@ private:
 class NetworkMemoryControl {
 public:
     NetworkMemoryControl() = default;
+    /**
+     * @param memoryPlans the static memory plans exported with the model, are reused by the control units with the
+     * matching ids if the graph produces the same memory regions
+     */
+    explicit NetworkMemoryControl(MemoryPlans memoryPlans, MemoryArenaOptions arenaOptions = {})
+        : m_memoryPlans(std::move(memoryPlans)),
+          m_arenaOptions(arenaOptions) {}
+
     MemoryControl::Ptr createMemoryControlUnit(std::string id);
 
     void allocateMemory();
@@ -88,11 +111,15 @@ public:
 
     [[nodiscard]] std::vector<std::pair<std::string, MemoryStatistics>> dumpStatistics() const;
 
+    [[nodiscard]] MemoryPlans getMemoryPlans() const;
+
     [[nodiscard]] const std::vector<MemoryControl::Ptr>& controlUnits() const {
         return m_controlUnits;
     }
 
 private:
+    MemoryPlans m_memoryPlans;
+    MemoryArenaOptions m_arenaOptions;
     std::vector<MemoryControl::Ptr> m_controlUnits;
 };
 
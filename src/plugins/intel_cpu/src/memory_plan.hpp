@@ -0,0 +1,34 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Solution of the memory solver for the static memory regions of a graph: the offsets of the regions inside the
+ * single workspace. It is exported together with the model, so the solver can be skipped when the same graph is
+ * compiled after the import.
+ */
+struct StaticMemoryPlan {
+    size_t boxesHash = 0;                              // fingerprint of the solver input the plan was computed for
+    int64_t totalSize = 0;                             // in bytes
+    std::vector<std::pair<int64_t, int64_t>> offsets;  // region id and its offset in bytes, in the insertion order
+
+    [[nodiscard]] bool empty() const {
+        return offsets.empty();
+    }
+};
+
+// by the memory control unit id
+using MemoryPlans = std::map<std::string, StaticMemoryPlan>;
+
+}  // namespace ov::intel_cpu
@@ -5,6 +5,7 @@
 #include "memory_state.h"
 
 #include <nodes/common/cpu_convert.h>
+#include <nodes/common/cpu_memcpy.h>
 
 #include <algorithm>
 #include <cstddef>
@@ -36,6 +37,49 @@ using namespace ov::Extensions::Cpu::XARCH;
 
 namespace ov::intel_cpu {
 
+namespace {
+
+// the same memory layout with the sequence length changed, the strides keep the capacity of the buffer
+MemoryDescPtr with_length(const BlockedMemoryDesc& desc, size_t length_axis, size_t length) {
+    auto dims = desc.getShape().getStaticDims();
+    dims[length_axis] = length;
+    const auto& order = desc.getOrder();
+    VectorDims blocked_dims(order.size());
+    for (size_t i = 0; i < order.size(); i++) {
+        blocked_dims[i] = dims[order[i]];
+    }
+    return std::make_shared<CpuBlockedMemoryDesc>(desc.getPrecision(),
+                                                  Shape(dims),
+                                                  blocked_dims,
+                                                  order,
+                                                  desc.getOffsetPadding(),
+                                                  VectorDims{},
+                                                  desc.getStrides());
+}
+
+// private copy of the buffer, capacity is the size in bytes the buffer may grow to in place
+MemoryPtr copy_buffer(const MemoryPtr& mem, size_t capacity) {
+    auto copy = std::make_shared<Memory>(VariableStateBase::get_engine(), mem->getDescPtr());
+    const auto size = mem->getSize();
+    copy->getMemoryBlock()->resize(std::max(capacity, size));
+    cpu_memcpy(copy->getData(), mem->getData(), size);
+    return copy;
+}
+
+PlainTensor copy_scale_zp(const PlainTensor& scale_zp) {
+    PlainTensor copy;
+    copy = scale_zp;
+    if (scale_zp && scale_zp.m_capacity != 0) {
+        PlainTensor buffer;
+        buffer.resize<uint8_t>({scale_zp.m_capacity});
+        cpu_memcpy(buffer.m_ptr.get(), scale_zp.m_ptr.get(), scale_zp.m_capacity);
+        copy.m_ptr = buffer.m_ptr;
+    }
+    return copy;
+}
+
+}  // namespace
+
 VariableStateBase::VariableStateBase(const std::string& name, MemoryDescPtr external_desc)
     : IVariableState{name},
       m_external_desc{std::move(external_desc)} {}
@@ -228,6 +272,7 @@ VariableStateKVcache::VariableStateKVcache(const std::string& name,
                                            const bool quant_by_channel,
                                            const size_t group_size)
     : VariableStateBase(name, std::move(external_desc)),
+      m_shared_tail(std::make_shared<KVcacheSharedTail>()),
       m_dense_internal_desc(std::move(dense_internal_desc)),
       m_quant_by_channel(quant_by_channel),
       m_group_size(group_size) {
@@ -235,18 +280,21 @@ VariableStateKVcache::VariableStateKVcache(const std::string& name,
     OPENVINO_ASSERT(shape.isDynamic(), "VariableStateKVcache is unexpectedly initalized with a static tensor");
 }
 
-ov::SoPtr<ov::ITensor> VariableStateKVcache::get_state() const {
-    if (!m_internal_mem || !m_hidden_state || is_reset_state()) {
-        auto new_desc = to_static(get_external_desc());
-        auto external_mem = std::make_shared<Memory>(get_engine(), new_desc);
-        return std::make_shared<Tensor>(external_mem);
-    }
+size_t KVcacheSnapshot::length() const {
+    return internal_mem->getStaticDims().at(dense_internal_desc->getOrder().at(0));
+}
 
-    auto actual_internal_desc = m_internal_mem->getDescWithType<BlockedMemoryDesc>();
-    auto&& dims = actual_internal_desc->getShape().getStaticDims();
+MemoryPtr KVcacheSnapshot::internal_mem_view(size_t length) const {
+    auto desc = internal_mem->getDescWithType<BlockedMemoryDesc>();
+    return std::make_shared<Memory>(VariableStateBase::get_engine(),
+                                    with_length(*desc, dense_internal_desc->getOrder().at(0), length),
+                                    internal_mem->getMemoryBlock());
+}
 
-    auto actual_external_desc = get_external_desc()->cloneWithNewDims(dims);
-    auto external_mem = std::make_shared<Memory>(get_engine(), actual_external_desc);
+void KVcacheSnapshot::to_external(size_t length, const MemoryPtr& external_mem) const {
+    auto view = internal_mem_view(length);
+    auto actual_internal_desc = view->getDescWithType<BlockedMemoryDesc>();
+    auto actual_external_desc = external_mem->getDescWithType<BlockedMemoryDesc>();
 
     // let's assume 4th rank KV tensors. This may be extended later
     OPENVINO_ASSERT(actual_internal_desc->getShape().getRank() == 4);
@@ -254,14 +302,14 @@ ov::SoPtr<ov::ITensor> VariableStateKVcache::get_state() const {
 
     auto&& actual_internal_order = actual_internal_desc->getOrder();
     // sanity check
-    OPENVINO_ASSERT(actual_internal_order == m_dense_internal_desc->getOrder());
+    OPENVINO_ASSERT(actual_internal_order == dense_internal_desc->getOrder());
 
     PlainTensor output;
     PlainTensor pastkv;
     PlainTensor beam_table;
     output.reset(external_mem);
-    beam_table.reset(m_hidden_state);
-    pastkv.reset(m_internal_mem);
+    beam_table.reset(hidden_state);
+    pastkv.reset(view);
     output = output.permute(actual_internal_order);
     pastkv = pastkv.permute(actual_internal_order);
     // S should be always the last dimension
@@ -270,34 +318,50 @@ ov::SoPtr<ov::ITensor> VariableStateKVcache::get_state() const {
     auto B = pastkv.size(1);
     auto H = pastkv.size(2);
     auto S = pastkv.size(3);
-    if (pastkv.get_precision() == element::u8) {
+    if (one_of(pastkv.get_precision(), element::u8, element::u4)) {
+        const bool is_u4 = pastkv.get_precision() == element::u4;
         auto nthr = parallel_get_max_threads();
         std::vector<PlainTensor> buffers(nthr);
-        if (m_quant_by_channel) {
+        if (quant_by_channel) {
             parallel_for3d(L0, B, H, [&](size_t ithr, size_t m, size_t b, size_t h) {
                 auto b_kv = static_cast<size_t>(beam_table.at<int32_t>({b, m}));
-                size_t group_id = m / m_group_size;
+                size_t group_id = m / group_size;
                 buffers[ithr].resize<float>({S});
-                attn_dequant_by_channel_u8(pastkv.ptr<uint8_t>(m, b_kv, h),
-                                           buffers[ithr].ptr<float>(),
-                                           1,
-                                           S,
-                                           pastkv.m_strides[2],
-                                           S,
-                                           m_scale_zp.ptr<float>(group_id * 2, b_kv, h),
-                                           m_scale_zp.ptr<float>(group_id * 2 + 1, b_kv, h));
+                auto* src = reinterpret_cast<uint8_t*>(pastkv.ptr_v(m, b_kv, h));
+                if (is_u4) {
+                    attn_dequant_by_channel_u4(src,
+                                               buffers[ithr].ptr<float>(),
+                                               1,
+                                               S,
+                                               pastkv.stride_bytes(2),
+                                               S,
+                                               scale_zp.ptr<float>(group_id * 2, b_kv, h),
+                                               scale_zp.ptr<float>(group_id * 2 + 1, b_kv, h));
+                } else {
+                    attn_dequant_by_channel_u8(src,
+                                               buffers[ithr].ptr<float>(),
+                                               1,
+                                               S,
+                                               pastkv.m_strides[2],
+                                               S,
+                                               scale_zp.ptr<float>(group_id * 2, b_kv, h),
+                                               scale_zp.ptr<float>(group_id * 2 + 1, b_kv, h));
+                }
                 cpu_convert(buffers[ithr].ptr<float>(), output.ptr_v(m, b, h), element::f32, output.m_dt, S);
             });
         } else {
             parallel_for3d(L0, B, H, [&](size_t ithr, size_t m, size_t b, size_t h) {
                 auto b_kv = static_cast<size_t>(beam_table.at<int32_t>({b, m}));
                 buffers[ithr].resize<float>({S});
-                for (size_t group_id = 0; group_id < S / m_group_size; group_id++) {
-                    attn_dequant_u8(pastkv.ptr<uint8_t>(m, b_kv, h, group_id * m_group_size),
-                                    buffers[ithr].ptr<float>() + group_id * m_group_size,
-                                    m_group_size,
-                                    m_scale_zp.ptr<float>(m, b_kv, h, group_id * 2)[0],
-                                    m_scale_zp.ptr<float>(m, b_kv, h, group_id * 2)[1]);
+                for (size_t group_id = 0; group_id < S / group_size; group_id++) {
+                    auto* src = reinterpret_cast<uint8_t*>(pastkv.ptr_v(m, b_kv, h, group_id * group_size));
+                    auto* dst = buffers[ithr].ptr<float>() + group_id * group_size;
+                    const auto* group_scale_zp = scale_zp.ptr<float>(m, b_kv, h, group_id * 2);
+                    if (is_u4) {
+                        attn_dequant_u4(src, dst, group_size, group_scale_zp[0], group_scale_zp[1]);
+                    } else {
+                        attn_dequant_u8(src, dst, group_size, group_scale_zp[0], group_scale_zp[1]);
+                    }
                 }
                 cpu_convert(buffers[ithr].ptr<float>(), output.ptr_v(m, b, h), element::f32, output.m_dt, S);
             });
@@ -308,13 +372,190 @@ ov::SoPtr<ov::ITensor> VariableStateKVcache::get_state() const {
             cpu_convert(pastkv.ptr_v(m, b_kv, h), output.ptr_v(m, b, h), pastkv.m_dt, output.m_dt, S);
         });
     }
+}
+
+ov::SoPtr<ov::ITensor> VariableStateKVcache::get_state() const {
+    if (!m_internal_mem || !m_hidden_state || is_reset_state()) {
+        auto new_desc = to_static(get_external_desc());
+        auto external_mem = std::make_shared<Memory>(get_engine(), new_desc);
+        return std::make_shared<Tensor>(external_mem);
+    }
 
-    return std::make_shared<Tensor>(external_mem);
+    auto snapshot = std::make_shared<KVcacheSnapshot>();
+    snapshot->internal_mem =
+        std::make_shared<Memory>(get_engine(), m_internal_mem->getDescPtr(), m_internal_mem->getMemoryBlock());
+    // the source state keeps gathering the beam table and updating the quantization parameters in place
+    snapshot->hidden_state = copy_buffer(m_hidden_state, m_hidden_state_max_size * sizeof(int32_t));
+    snapshot->scale_zp = copy_scale_zp(m_scale_zp);
+    if (m_shared_tail.use_count() == 1) {
+        m_shared_tail->length = snapshot->length();
+    }
+    snapshot->tail = m_shared_tail;
+    snapshot->internal_mem_max_size = m_internal_mem_max_size;
+    snapshot->hidden_state_max_size = m_hidden_state_max_size;
+    snapshot->dense_internal_desc = m_dense_internal_desc;
+    snapshot->quant_by_channel = m_quant_by_channel;
+    snapshot->group_size = m_group_size;
+    return std::make_shared<KVcacheStateTensor>(std::move(snapshot), get_external_desc());
+}
+
+KVcacheStateTensor::KVcacheStateTensor(std::shared_ptr<const KVcacheSnapshot> snapshot,
+                                       const MemoryDescPtr& external_desc)
+    : m_snapshot(std::move(snapshot)),
+      m_length(m_snapshot->length()),
+      m_length_axis(m_snapshot->dense_internal_desc->getOrder().at(0)),
+      m_element_type(external_desc->getPrecision()) {
+    // the external memory is allocated on the first data access, the forked and truncated snapshots never need it
+    update_desc(external_desc->cloneWithNewDims(m_snapshot->internal_mem->getStaticDims()));
+}
+
+void KVcacheStateTensor::update_desc(MemoryDescPtr desc) {
+    m_desc = std::move(desc);
+    m_shape = ov::Shape{m_desc->getShape().getStaticDims()};
+    const auto& strides = m_desc->as<BlockedMemoryDesc>()->getStrides();
+    m_strides.resize(strides.size());
+    std::transform(strides.cbegin(), strides.cend(), m_strides.begin(), [this](const size_t stride) {
+        return stride * m_element_type.size();
+    });
+}
+
+void KVcacheStateTensor::set_shape(ov::Shape shape) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (shape == m_shape) {
+        return;
+    }
+    bool truncated = m_snapshot && shape.size() == m_shape.size() && shape[m_length_axis] < m_shape[m_length_axis];
+    for (size_t i = 0; truncated && i < shape.size(); i++) {
+        truncated = i == m_length_axis || shape[i] == m_shape[i];
+    }
+    if (truncated && m_snapshot->quant_by_channel && shape[m_length_axis] % m_snapshot->group_size != 0) {
+        // the channel quantization group at the end would be requantized in place on append
+        truncated = false;
+    }
+    update_desc(m_desc->cloneWithNewDims(shape, true));
+    if (m_tensor) {
+        m_tensor->set_shape(shape);
+    }
+    if (truncated) {
+        m_length = shape[m_length_axis];
+        m_materialized = false;
+    } else {
+        m_snapshot = nullptr;
+    }
+}
+
+const ov::element::Type& KVcacheStateTensor::get_element_type() const {
+    return m_element_type;
+}
+
+const ov::Shape& KVcacheStateTensor::get_shape() const {
+    return m_shape;
+}
+
+const ov::Strides& KVcacheStateTensor::get_strides() const {
+    return m_strides;
+}
+
+void* KVcacheStateTensor::data() {
+    // the data may be modified by the caller, so it is not the snapshot anymore
+    const auto& tensor = materialize();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_snapshot = nullptr;
+    return tensor->data();
+}
+
+void* KVcacheStateTensor::data(const element::Type& type) {
+    const auto& tensor = materialize();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_snapshot = nullptr;
+    return tensor->data(type);
+}
+
+const void* KVcacheStateTensor::data() const {
+    const ov::ITensor& tensor = *materialize();
+    return tensor.data();
+}
+
+const void* KVcacheStateTensor::data(const element::Type& type) const {
+    const ov::ITensor& tensor = *materialize();
+    return tensor.data(type);
+}
+
+std::shared_ptr<const KVcacheSnapshot> KVcacheStateTensor::get_snapshot() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_snapshot;
+}
+
+const std::shared_ptr<ov::ITensor>& KVcacheStateTensor::materialize() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_tensor) {
+        m_tensor = std::make_shared<Tensor>(std::make_shared<Memory>(VariableStateBase::get_engine(), m_desc));
+    }
+    if (!m_materialized && m_snapshot) {
+        m_snapshot->to_external(m_length, std::static_pointer_cast<Tensor>(m_tensor)->get_memory());
+        m_materialized = true;
+    }
+    return m_tensor;
+}
+
+bool VariableStateKVcache::fork(const KVcacheSnapshot& snapshot, size_t length) {
+    if (snapshot.dense_internal_desc->getPrecision() != m_dense_internal_desc->getPrecision() ||
+        snapshot.dense_internal_desc->getOrder() != m_dense_internal_desc->getOrder() ||
+        snapshot.quant_by_channel != m_quant_by_channel || snapshot.group_size != m_group_size) {
+        return false;
+    }
+    // O(1): the KV buffer is shared, the private copies of the small parts are made
+    m_internal_mem = snapshot.internal_mem_view(length);
+    m_hidden_state = copy_buffer(snapshot.hidden_state, snapshot.hidden_state_max_size * sizeof(int32_t));
+    auto beam_desc = m_hidden_state->getDescWithType<BlockedMemoryDesc>();
+    m_hidden_state->redefineDesc(with_length(*beam_desc, 1, length));
+    m_scale_zp = copy_scale_zp(snapshot.scale_zp);
+    m_shared_tail = snapshot.tail;
+    m_internal_mem_max_size = snapshot.internal_mem_max_size;
+    m_hidden_state_max_size = snapshot.hidden_state_max_size;
+    return true;
+}
+
+void VariableStateKVcache::prepare_append(size_t new_tokens) {
+    // the buffers are reallocated on the reset of a shared state
+    if (m_shared_tail.use_count() == 1 || is_reset_state()) {
+        return;
+    }
+    const auto& desc = m_internal_mem->getDesc();
+    const auto length = m_internal_mem->getStaticDims().at(m_dense_internal_desc->getOrder().at(0));
+    const auto elements = desc.getShape().getElementsCount();
+    if (length == 0) {
+        // nothing to keep, the node allocates a new buffer
+        m_internal_mem_max_size = 0;
+        return;
+    }
+    if (elements / length * (length + new_tokens) > m_internal_mem_max_size) {
+        // the node copies the cache into a larger buffer anyway
+        return;
+    }
+    // the quantization group at the end is requantized in place, so the data before length is modified
+    const bool keeps_prefix = !m_quant_by_channel || length % m_group_size == 0;
+    auto expected = length;
+    if (keeps_prefix && m_shared_tail->length.compare_exchange_strong(expected, length + new_tokens)) {
+        // no other state has appended to the shared buffer yet, so this one owns the positions after its sequence
+        return;
+    }
+    m_internal_mem = copy_buffer(m_internal_mem, m_internal_mem_max_size * desc.getPrecision().bitwidth() / 8);
+    m_shared_tail = std::make_shared<KVcacheSharedTail>();
 }
 
 void VariableStateKVcache::set_state_impl(const ov::SoPtr<ov::ITensor>& state) {
+    if (auto state_tensor = std::dynamic_pointer_cast<KVcacheStateTensor>(state._ptr)) {
+        auto snapshot = state_tensor->get_snapshot();
+        if (snapshot && fork(*snapshot, state_tensor->get_length())) {
+            m_state = state;
+            return;
+        }
+    }
+
     // 1. reset the memory object
     m_state = state;  // simply to extend the lifetime
+    m_shared_tail = std::make_shared<KVcacheSharedTail>();
     auto state_desc = MemoryDescUtils::generateCpuBlockedMemoryDesc(m_state);
 
     // May be optimized by reusing the state tensor underlining memory pointer, but corner cases should be considered
@@ -323,7 +564,8 @@ void VariableStateKVcache::set_state_impl(const ov::SoPtr<ov::ITensor>& state) {
     m_internal_mem = std::make_shared<Memory>(get_engine(), dense_internal_desc);
     Memory external_mem(get_engine(), state_desc, m_state->data());
 
-    if (dense_internal_desc->getPrecision() == element::u8) {
+    if (one_of(dense_internal_desc->getPrecision(), element::u8, element::u4)) {
+        const bool is_u4 = dense_internal_desc->getPrecision() == element::u4;
         PlainTensor external;
         PlainTensor internal;
         auto&& actual_internal_order = m_dense_internal_desc->getOrder();
@@ -351,14 +593,26 @@ void VariableStateKVcache::set_state_impl(const ov::SoPtr<ov::ITensor>& state) {
                             external.m_dt,
                             element::f32,
                             valid_seq * S);
-                attn_quant_by_channel_u8(buffers[ithr].ptr<float>(),
-                                         internal.ptr<uint8_t>(group_id * m_group_size, b, h),
-                                         valid_seq,
-                                         S,
-                                         S,
-                                         internal.m_strides[0],
-                                         m_scale_zp.ptr<float>(group_id * 2, b, h),
-                                         m_scale_zp.ptr<float>(group_id * 2 + 1, b, h));
+                auto* dst = reinterpret_cast<uint8_t*>(internal.ptr_v(group_id * m_group_size, b, h));
+                if (is_u4) {
+                    attn_quant_by_channel_u4(buffers[ithr].ptr<float>(),
+                                             dst,
+                                             valid_seq,
+                                             S,
+                                             S,
+                                             internal.stride_bytes(0),
+                                             m_scale_zp.ptr<float>(group_id * 2, b, h),
+                                             m_scale_zp.ptr<float>(group_id * 2 + 1, b, h));
+                } else {
+                    attn_quant_by_channel_u8(buffers[ithr].ptr<float>(),
+                                             dst,
+                                             valid_seq,
+                                             S,
+                                             S,
+                                             internal.m_strides[0],
+                                             m_scale_zp.ptr<float>(group_id * 2, b, h),
+                                             m_scale_zp.ptr<float>(group_id * 2 + 1, b, h));
+                }
             });
         } else {
             m_scale_zp.resize<float>({L0, B, H, 2 * S / m_group_size});
@@ -366,11 +620,15 @@ void VariableStateKVcache::set_state_impl(const ov::SoPtr<ov::ITensor>& state) {
                 buffers[ithr].resize<float>({S});
                 cpu_convert(external.ptr_v(m, b, h), buffers[ithr].ptr<float>(), external.m_dt, element::f32, S);
                 for (size_t group_id = 0; group_id < S / m_group_size; group_id++) {
-                    attn_quant_u8(buffers[ithr].ptr<float>() + group_id * m_group_size,
-                                  internal.ptr<uint8_t>(m, b, h, group_id * m_group_size),
-                                  m_group_size,
-                                  m_scale_zp.at<float>({m, b, h, group_id * 2}),
-                                  m_scale_zp.at<float>({m, b, h, group_id * 2 + 1}));
+                    const auto* src = buffers[ithr].ptr<float>() + group_id * m_group_size;
+                    auto* dst = reinterpret_cast<uint8_t*>(internal.ptr_v(m, b, h, group_id * m_group_size));
+                    auto& scale = m_scale_zp.at<float>({m, b, h, group_id * 2});
+                    auto& zp = m_scale_zp.at<float>({m, b, h, group_id * 2 + 1});
+                    if (is_u4) {
+                        attn_quant_u4(src, dst, m_group_size, scale, zp);
+                    } else {
+                        attn_quant_u8(src, dst, m_group_size, scale, zp);
+                    }
                 }
             });
         }
@@ -393,12 +651,16 @@ void VariableStateKVcache::set_state_impl(const ov::SoPtr<ov::ITensor>& state) {
             buff[i * size_L + j] = i;
         }
     }
-    m_internal_mem_max_size = dense_internal_desc->getCurrentMemSize() / dense_internal_desc->getPrecision().size();
+    m_internal_mem_max_size =
+        dense_internal_desc->getCurrentMemSize() * 8 / dense_internal_desc->getPrecision().bitwidth();
     m_hidden_state_max_size = mem_desc->getCurrentMemSize() / mem_desc->getPrecision().size();
 }
 
 void VariableStateKVcache::reset_impl() {
-    // nothing to do
+    if (m_shared_tail.use_count() != 1) {
+        // the sequence is written from the beginning, so the shared buffer is not reused
+        m_internal_mem_max_size = 0;
+    }
 }
 
 void VariableStateKVcache::commit_impl() {
@@ -423,6 +685,7 @@ MemoryPtr VariableStateKVcache::internal_state_mem() const {
 
 void VariableStateKVcache::assign_internal_state(const MemoryPtr& mem) {
     m_internal_mem = mem;
+    m_shared_tail = std::make_shared<KVcacheSharedTail>();
 }
 
 MemoryPtr VariableStateKVcache::hidden_state_mem() const {
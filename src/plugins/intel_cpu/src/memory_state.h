@@ -5,14 +5,17 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <memory>
+#include <mutex>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
 
 #include "cpu_memory.h"
 #include "memory_desc/blocked_memory_desc.h"
 #include "memory_desc/cpu_memory_desc.h"
+#include "openvino/runtime/itensor.hpp"
 #include "openvino/runtime/ivariable_state.hpp"
 #include "openvino/runtime/so_ptr.hpp"
 #include "openvino/runtime/tensor.hpp"
@@ -36,6 +39,8 @@ class VariableStateBase : public IVariableState {
 public:
     VariableStateBase(const std::string& name, MemoryDescPtr external_desc);
 
+    static const dnnl::engine& get_engine();
+
     // ov::IVariableState
     void set_state(const ov::SoPtr<ov::ITensor>& state) override final;
     ov::SoPtr<ov::ITensor> get_state() const override;
@@ -50,7 +55,6 @@ protected:
     virtual void set_state_impl(const ov::SoPtr<ov::ITensor>& state);
 
     static MemoryDescPtr to_static(const MemoryDescPtr& desc);
-    static const dnnl::engine& get_engine();
 
     MemoryDescPtr get_external_desc() const {
         return m_external_desc;
@@ -118,6 +122,77 @@ private:
     MemoryDescPtr m_internal_desc;  // mem desc required by the graph internal tensor
 };
 
+// The length of the sequence written to a KV cache buffer shared by several states. Only the state whose sequence ends
+// at this length may append to the buffer in place, the others take a private copy of the buffer on the first write.
+struct KVcacheSharedTail {
+    std::atomic<size_t> length{0};
+};
+
+/**
+ * @brief Copy-on-write view of a KV cache state taken by get_state(). The KV buffer is shared with the state the
+ * snapshot is taken from and with the states forked from the snapshot, so the states with a common prefix (e.g. the
+ * system prompt) do not recompute it. The beam table and the quantization parameters are small, they are copied.
+ */
+struct KVcacheSnapshot {
+    MemoryPtr internal_mem;  // view of the shared KV buffer, its dims give the cached sequence length
+    MemoryPtr hidden_state;  // beam table
+    PlainTensor scale_zp;
+    std::shared_ptr<KVcacheSharedTail> tail;
+    size_t internal_mem_max_size = 0;
+    size_t hidden_state_max_size = 0;
+    BlockedMemoryDescPtr dense_internal_desc;
+    bool quant_by_channel = false;
+    size_t group_size = 0;
+
+    [[nodiscard]] size_t length() const;
+    // the view of the KV buffer truncated to the first length positions
+    [[nodiscard]] MemoryPtr internal_mem_view(size_t length) const;
+    // converts the first length positions into the external layout and precision
+    void to_external(size_t length, const MemoryPtr& external_mem) const;
+};
+
+/**
+ * @brief The tensor returned by VariableStateKVcache::get_state(). The data is converted into the external layout on
+ * the first access only, while setting the untouched tensor to a KV cache state forks the snapshot in O(1). Reducing
+ * the sequence length dimension with set_shape() truncates the snapshot, any other change of the shape or the mutable
+ * data access detaches the tensor from the snapshot, so it is set as a regular tensor then.
+ */
+class KVcacheStateTensor : public ov::ITensor {
+public:
+    KVcacheStateTensor(std::shared_ptr<const KVcacheSnapshot> snapshot, const MemoryDescPtr& external_desc);
+
+    void set_shape(ov::Shape shape) override;
+    const ov::element::Type& get_element_type() const override;
+    const ov::Shape& get_shape() const override;
+    const ov::Strides& get_strides() const override;
+
+    void* data() override;
+    void* data(const element::Type& type) override;
+    const void* data() const override;
+    const void* data(const element::Type& type) const override;
+
+    // nullptr if the tensor was detached from the snapshot
+    [[nodiscard]] std::shared_ptr<const KVcacheSnapshot> get_snapshot() const;
+    [[nodiscard]] size_t get_length() const {
+        return m_length;
+    }
+
+private:
+    const std::shared_ptr<ov::ITensor>& materialize() const;
+    void update_desc(MemoryDescPtr desc);
+
+    std::shared_ptr<const KVcacheSnapshot> m_snapshot;
+    size_t m_length = 0;
+    size_t m_length_axis = 0;
+    ov::element::Type m_element_type;
+    MemoryDescPtr m_desc;  // the external layout
+    ov::Shape m_shape;
+    ov::Strides m_strides;
+    mutable std::shared_ptr<ov::ITensor> m_tensor;  // allocated on the first data access
+    mutable bool m_materialized = false;
+    mutable std::mutex m_mutex;
+};
+
 class VariableStateKVcache : public VariableStateBase {
 public:
     VariableStateKVcache(const std::string& name,
@@ -162,14 +237,21 @@ public:
         m_scale_zp = t;
     }
 
+    // must be called before new_tokens positions are appended to the cache, copies the KV buffer if it is shared with
+    // the other states and the new positions would overwrite their data
+    void prepare_append(size_t new_tokens);
+
 private:
     // ov::intel_cpu::VariableStateBase
     void set_state_impl(const ov::SoPtr<ov::ITensor>& state) override;
     void reset_impl() override;
     void commit_impl() override;
 
+    bool fork(const KVcacheSnapshot& snapshot, size_t length);
+
     MemoryPtr m_internal_mem;  // kv cache
     MemoryPtr m_hidden_state;  // beam access table
+    std::shared_ptr<KVcacheSharedTail> m_shared_tail;
     size_t m_internal_mem_max_size = 0;
     size_t m_hidden_state_max_size = 0;
 
@@ -122,7 +122,8 @@ Node::Node(const std::shared_ptr<ov::Node>& op, GraphContext::CPtr ctx, const Sh
                 });
 
     if (isDynamic) {
-        shapeInference = shapeInferFactory.makeShapeInfer();
+        shapeInference = context->getConfig().shapeInferCache ? shapeInferFactory.makeCachedShapeInfer()
+                                                               : shapeInferFactory.makeShapeInfer();
     }
 
     const auto& rtInfo = op->get_rt_info();
@@ -1134,7 +1135,10 @@ void Node::prepareMemory(const DnnlMemoryDescPtr& intDesc, size_t indx) {
     if (weightCache != nullptr && memory::format_kind::blocked == intDesc->getDnnlDesc().get_format_kind()) {
         const auto string_hash = name + "_" + std::to_string(indx) + "_" +
                                  DnnlExtensionUtils::computeWeightsStringHash(internalBlob, intDesc);
-        ptr = *weightCache->findOrCreate(string_hash, create);
+        const auto layout_hash = DnnlExtensionUtils::computeWeightsLayoutHash(
+            MemoryDescUtils::convertToDnnlMemoryDesc(internalBlob->getDescPtr()),
+            intDesc);
+        ptr = *weightCache->findOrCreateRepacked(string_hash, internalBlob, intDesc, layout_hash, create);
     } else {
         ptr = create();
     }
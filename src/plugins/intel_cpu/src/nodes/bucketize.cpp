@@ -15,6 +15,7 @@
 #include <string>
 #include <vector>
 
+#include "common/sorted_search.h"
 #include "cpu_types.h"
 #include "graph_context.h"
 #include "memory_desc/cpu_memory_desc.h"
@@ -255,16 +256,14 @@ void Bucketize::bucketize() {
     }
 
     // boundaries are assumed to be sorted and to have unique elements
-    parallel_for(num_values, [&](size_t ind) {
-        T value = input_data[ind];
-        if (with_right) {
-            const auto* low = std::lower_bound(boundaries_data, boundaries_data + num_bin_values, value);
-            output_data[ind] = static_cast<T_IND>(low - boundaries_data);
-        } else {
-            const auto* up = std::upper_bound(boundaries_data, boundaries_data + num_bin_values, value);
-            output_data[ind] = static_cast<T_IND>(up - boundaries_data);
-        }
-    });
+    const SortedSearch<T_BOUNDARIES> search(boundaries_data, num_bin_values, num_values);
+    if (with_right) {
+        // std::lower_bound
+        search.findAll(input_data, output_data, num_values, std::less<>());
+    } else {
+        // std::upper_bound
+        search.findAll(input_data, output_data, num_values, NotGreater());
+    }
 }
 
 bool Bucketize::created() const {
@@ -0,0 +1,98 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "openvino/core/parallel.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Conversions between the std::string elements of a string tensor and the packed form of the StringTensorUnpack
+ * outputs: the begins and the ends of the strings in a single buffer of the characters. The strings are split between
+ * the threads in the contiguous ranges, so the characters of each range are written to a contiguous part of the buffer
+ * at the offset known from the total length of the previous ranges.
+ */
+class PackedStrings {
+public:
+    static size_t length(const std::string* strings, size_t count) {
+        const size_t ranges = rangesCount(count);
+        std::vector<size_t> lengths(ranges, 0);
+        ov::parallel_for(ranges, [&](size_t range) {
+            lengths[range] = rangeLength(strings, count, ranges, range);
+        });
+        return std::accumulate(lengths.begin(), lengths.end(), size_t{0});
+    }
+
+    // the chars buffer must hold length(strings, count) characters
+    template <typename TIdx>
+    static void unpack(const std::string* strings, TIdx* begins, TIdx* ends, uint8_t* chars, size_t count) {
+        // the ranges do not depend on the number of the threads the runtime provides to each of the parallel loops
+        const size_t ranges = rangesCount(count);
+        std::vector<size_t> offsets(ranges + 1, 0);
+        ov::parallel_for(ranges, [&](size_t range) {
+            offsets[range + 1] = rangeLength(strings, count, ranges, range);
+        });
+        std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+        ov::parallel_for(ranges, [&](size_t range) {
+            size_t start = 0;
+            size_t end = 0;
+            ov::splitter(count, ranges, range, start, end);
+            size_t offset = offsets[range];
+            for (size_t i = start; i < end; i++) {
+                const auto& string = strings[i];
+                begins[i] = static_cast<TIdx>(offset);
+                if (!string.empty()) {
+                    std::memcpy(chars + offset, string.data(), string.length());
+                }
+                offset += string.length();
+                ends[i] = static_cast<TIdx>(offset);
+            }
+        });
+    }
+
+    template <typename TIdx>
+    static void pack(const TIdx* begins, const TIdx* ends, const uint8_t* chars, std::string* strings, size_t count) {
+        const auto* symbols = reinterpret_cast<const char*>(chars);
+        const size_t ranges = rangesCount(count);
+        ov::parallel_for(ranges, [&](size_t range) {
+            size_t start = 0;
+            size_t end = 0;
+            ov::splitter(count, ranges, range, start, end);
+            for (size_t i = start; i < end; i++) {
+                strings[i].assign(symbols + begins[i], symbols + ends[i]);
+            }
+        });
+    }
+
+private:
+    // the copies of a few short strings are cheaper than the wake up of the threads
+    static constexpr size_t minStringsPerThread = 1024;
+
+    static size_t rangesCount(size_t count) {
+        const auto maxThreads = static_cast<size_t>(parallel_get_max_threads());
+        return std::max<size_t>(1, std::min(maxThreads, count / minStringsPerThread));
+    }
+
+    static size_t rangeLength(const std::string* strings, size_t count, size_t ranges, size_t range) {
+        size_t start = 0;
+        size_t end = 0;
+        ov::splitter(count, ranges, range, start, end);
+        size_t length = 0;
+        for (size_t i = start; i < end; i++) {
+            length += strings[i].length();
+        }
+        return length;
+    }
+};
+
+}  // namespace ov::intel_cpu
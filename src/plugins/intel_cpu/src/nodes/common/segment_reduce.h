@@ -0,0 +1,99 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Helpers of the segmented reductions (the embedding bags and SegmentMax): the output rows are reduced from the
+ * variable number of the input rows. The segments are split between the threads by the number of the reduced rows, so
+ * a few long segments do not leave the other threads idle, and the loops over the rows are simple enough to be
+ * vectorized by the compiler.
+ */
+class SegmentReduce {
+public:
+    // the work of each segment is the number of its rows plus the write of the output row
+    explicit SegmentReduce(size_t segments) : m_workBegins(segments + 1, 0) {}
+
+    void setRows(size_t segment, size_t rows) {
+        m_workBegins[segment + 1] = rows + 1;
+    }
+
+    // must be called after the rows of all the segments are set
+    void computeWork() {
+        for (size_t i = 1; i < m_workBegins.size(); i++) {
+            m_workBegins[i] += m_workBegins[i - 1];
+        }
+    }
+
+    // the range of the segments of the thread, the amounts of work of the threads differ by a segment at most
+    void split(int nthr, int ithr, size_t& start, size_t& end) const {
+        const size_t segments = m_workBegins.size() - 1;
+        const size_t total = m_workBegins.back();
+        const size_t workStart = total * ithr / nthr;
+        const size_t workEnd = total * (ithr + 1) / nthr;
+        const auto* begins = m_workBegins.data();
+        start = std::lower_bound(begins, begins + segments, workStart) - begins;
+        end = std::lower_bound(begins, begins + segments, workEnd) - begins;
+    }
+
+private:
+    std::vector<size_t> m_workBegins;
+};
+
+// the loops over the row elements, the rows never overlap
+template <typename T>
+void copyRow(T* __restrict dst, const T* __restrict src, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        dst[i] = src[i];
+    }
+}
+
+template <typename T>
+void scaleRow(T* __restrict dst, const T* __restrict src, T weight, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        dst[i] = src[i] * weight;
+    }
+}
+
+template <typename T>
+void addRow(T* __restrict dst, const T* __restrict src, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        dst[i] += src[i];
+    }
+}
+
+template <typename T>
+void addScaledRow(T* __restrict dst, const T* __restrict src, T weight, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        dst[i] += src[i] * weight;
+    }
+}
+
+// keeps the destination if the source is not greater, so the NaN values are skipped
+template <typename T>
+void maxRow(T* __restrict dst, const T* __restrict src, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        dst[i] = src[i] > dst[i] ? src[i] : dst[i];
+    }
+}
+
+// the gathered rows are not sequential in memory, so the hardware prefetcher does not load the next one in advance
+template <typename T>
+void prefetchRow([[maybe_unused]] const T* row, [[maybe_unused]] size_t size) {
+#if defined(__GNUC__)
+    constexpr size_t cacheLineSize = 64;
+    const auto* bytes = reinterpret_cast<const char*>(row);
+    for (size_t offset = 0; offset < size * sizeof(T); offset += cacheLineSize) {
+        __builtin_prefetch(bytes + offset);
+    }
+#endif
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,150 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+#include "openvino/core/parallel.hpp"
+
+namespace ov::intel_cpu {
+
+// the element precedes the value in std::upper_bound, unlike std::less_equal it is true for a NaN value
+struct NotGreater {
+    template <typename TSorted, typename TValue>
+    bool operator()(const TSorted& element, const TValue& value) const {
+        return !(value < element);
+    }
+};
+
+/**
+ * @brief The number of the leading elements of the sorted sequence which precede the value, i.e. the index returned by
+ * std::lower_bound(sorted, sorted + size, value, precedes). The loop has no data dependent branches, so the search
+ * does not pay for the mispredictions which dominate std::lower_bound on the random values.
+ */
+template <typename TSorted, typename TValue, typename Precedes>
+size_t branchlessLowerBound(const TSorted* sorted, size_t size, const TValue& value, const Precedes& precedes) {
+    if (size == 0) {
+        return 0;
+    }
+    const TSorted* base = sorted;
+    while (size > 1) {
+        const size_t half = size / 2;
+        base = precedes(base[half], value) ? base + half : base;
+        size -= half;
+    }
+    return static_cast<size_t>(base - sorted) + (precedes(*base, value) ? 1 : 0);
+}
+
+/**
+ * @brief Batched search of the values in a sorted sequence shared by SearchSorted and Bucketize. The values are split
+ * across the threads. A sequence which does not fit the L1 cache and is searched for at least as many values as it has
+ * elements is copied to the Eytzinger (breadth first) order first: the first levels of all the searches share a few
+ * cache lines and the next levels are prefetched 4 levels ahead.
+ */
+template <typename TSorted>
+class SortedSearch {
+public:
+    SortedSearch(const TSorted* sorted, size_t size, size_t values) : m_sorted(sorted), m_size(size) {
+        if (size * sizeof(TSorted) >= eytzingerMinBytes && values >= size) {
+            m_tree.resize(size + 1);
+            m_index.resize(size + 1);
+            buildTree(0, 1);
+        }
+    }
+
+    [[nodiscard]] bool isEytzinger() const {
+        return !m_tree.empty();
+    }
+
+    // the index std::lower_bound(sorted, sorted + size, value, precedes) would return
+    template <typename TValue, typename Precedes>
+    [[nodiscard]] size_t find(const TValue& value, const Precedes& precedes) const {
+        if (!isEytzinger()) {
+            return branchlessLowerBound(m_sorted, m_size, value, precedes);
+        }
+
+        const TSorted* tree = m_tree.data();
+        size_t k = 1;
+        while (k <= m_size) {
+#if defined(__GNUC__)
+            // the 16 descendants of the 4th level below are stored in the same cache line(s)
+            __builtin_prefetch(tree + std::min(k * prefetchDistance, m_size));
+#endif
+            k = 2 * k + (precedes(tree[k], value) ? 1 : 0);
+        }
+        // drop the trailing right turns and the last left turn, which leads to the first not preceding element
+        while ((k & 1) != 0) {
+            k >>= 1;
+        }
+        k >>= 1;
+        return k == 0 ? m_size : m_index[k];
+    }
+
+    template <typename TValue, typename TOut, typename Precedes>
+    void findAll(const TValue* values, TOut* out, size_t count, const Precedes& precedes) const {
+        ov::parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t start = 0;
+            size_t end = 0;
+            ov::splitter(count, nthr, ithr, start, end);
+            for (size_t i = start; i < end; i++) {
+                out[i] = static_cast<TOut>(find(values[i], precedes));
+            }
+        });
+    }
+
+private:
+    static constexpr size_t eytzingerMinBytes = 32 * 1024;
+    static constexpr size_t prefetchDistance = 16;
+
+    // in-order traversal of the implicit tree assigns the sorted elements to the nodes
+    size_t buildTree(size_t i, size_t k) {
+        if (k <= m_size) {
+            i = buildTree(i, 2 * k);
+            m_tree[k] = m_sorted[i];
+            m_index[k] = i++;
+            i = buildTree(i, 2 * k + 1);
+        }
+        return i;
+    }
+
+    const TSorted* m_sorted;
+    size_t m_size;
+    std::vector<TSorted> m_tree;  // 1-based, empty if the sequence is searched in place
+    std::vector<size_t> m_index;  // the index in the sorted sequence of the tree node
+};
+
+/**
+ * @brief Searches the rows of the values in the corresponding rows of the sorted sequences in parallel, i.e. the
+ * SearchSorted case of the N-D sorted sequence.
+ */
+template <typename TSorted, typename TValue, typename TOut, typename Precedes>
+void searchSortedRows(const TSorted* sorted,
+                      size_t sortedRowSize,
+                      const TValue* values,
+                      TOut* out,
+                      size_t valuesRowSize,
+                      size_t rows,
+                      const Precedes& precedes) {
+    ov::parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0;
+        size_t end = 0;
+        ov::splitter(rows * valuesRowSize, nthr, ithr, start, end);
+        size_t row = valuesRowSize == 0 ? 0 : start / valuesRowSize;
+        size_t column = start - row * valuesRowSize;
+        for (size_t i = start; i < end; i++) {
+            const TSorted* sortedRow = sorted + row * sortedRowSize;
+            out[i] = static_cast<TOut>(branchlessLowerBound(sortedRow, sortedRowSize, values[i], precedes));
+            if (++column == valuesRowSize) {
+                column = 0;
+                row++;
+            }
+        }
+    });
+}
+
+}  // namespace ov::intel_cpu
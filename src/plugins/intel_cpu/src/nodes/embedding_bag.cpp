@@ -4,12 +4,15 @@
 
 #include "embedding_bag.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
+#include "common/segment_reduce.h"
 #include "cpu_memory.h"
 #include "cpu_types.h"
 #include "openvino/core/except.hpp"
@@ -62,69 +65,67 @@ void EmbeddingBag::processData(const T* srcData,
     const size_t outputBagsNum = outMemory->getShape().getStaticDims()[0];
     auto* dstData = outMemory->getDataAs<T>();
 
-    auto threadBody = [&](const int ithr, const int nthr) {
-        size_t start(0LU);
-        size_t end(0LU);
-        splitter(outputBagsNum, nthr, ithr, start, end);
-        if (start >= end) {
-            return;
-        }
-
-        size_t indicesSize = 0LU;
+    // the indices of the bags are collected first, so the bags are split between the threads by their sizes
+    struct Bag {
         const int* indices = nullptr;
-        int weightsIdx = 0LU;
+        size_t size = 0LU;
+        int weightsIdx = 0;
+        bool withWeights = false;
+    };
+    std::vector<Bag> bags(outputBagsNum);
+    SegmentReduce segments(outputBagsNum);
+    int weightsIdx = 0;
+    for (size_t obi = 0; obi < outputBagsNum; obi++) {
+        auto& bag = bags[obi];
         bool withWeights = _withWeights;
+        getIndices(obi, bag.indices, bag.size, weightsIdx, withWeights);
+        bag.weightsIdx = weightsIdx;
+        bag.withWeights = withWeights && _withWeights;
+        segments.setRows(obi, bag.indices != nullptr ? bag.size : 0LU);
+    }
+    segments.computeWork();
 
-        for (size_t obi = start; obi < end; obi++) {
-            size_t dstIndex = obi * _embDepth;
-            getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+    auto getRow = [&](const int index) {
+        if (static_cast<size_t>(index) >= inDataDims[0]) {
+            OPENVINO_THROW(msgPrefix + "' has invalid embedding bag index: " + std::to_string(index));
+        }
+        return srcData + index * _embDepth;
+    };
 
-            if (indices != nullptr) {
-                withWeights = withWeights & _withWeights;
+    auto threadBody = [&](const int ithr, const int nthr) {
+        size_t start(0LU);
+        size_t end(0LU);
+        segments.split(nthr, ithr, start, end);
 
-                size_t inIdx = 0LU;
-                if (static_cast<size_t>(indices[inIdx]) >= inDataDims[0]) {
-                    OPENVINO_THROW(msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]));
-                }
-                size_t srcIndex = indices[inIdx] * _embDepth;
+        for (size_t obi = start; obi < end; obi++) {
+            const auto& bag = bags[obi];
+            T* dst = dstData + obi * _embDepth;
+            if (bag.indices == nullptr) {
+                std::fill(dst, dst + _embDepth, T(0));
+                continue;
+            }
 
-                if (withWeights) {
-                    for (size_t i = 0LU; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i] * weightsData[weightsIdx];
-                    }
-                    weightsIdx++;
-                } else {
-                    for (size_t i = 0LU; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i];
-                    }
+            for (size_t inIdx = 0LU; inIdx < bag.size; inIdx++) {
+                const T* src = getRow(bag.indices[inIdx]);
+                if (inIdx + 1 < bag.size && static_cast<size_t>(bag.indices[inIdx + 1]) < inDataDims[0]) {
+                    prefetchRow(srcData + bag.indices[inIdx + 1] * _embDepth, _embDepth);
                 }
-
-                for (inIdx = 1LU; inIdx < indicesSize; inIdx++) {
-                    if (static_cast<size_t>(indices[inIdx]) >= inDataDims[0]) {
-                        OPENVINO_THROW(msgPrefix +
-                                       "' has invalid embedding bag index: " + std::to_string(indices[inIdx]));
-                    }
-                    size_t srcIndex = indices[inIdx] * _embDepth;
-
-                    if (withWeights) {
-                        for (size_t i = 0LU; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i] * weightsData[weightsIdx];
-                        }
-                        weightsIdx++;
+                if (bag.withWeights) {
+                    const T weight = weightsData[bag.weightsIdx + inIdx];
+                    if (inIdx == 0) {
+                        scaleRow(dst, src, weight, _embDepth);
                     } else {
-                        for (size_t i = 0LU; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i];
-                        }
-                    }
-                }
-                if (_reduction == Reduction::MEAN) {
-                    for (size_t i = 0LU; i < _embDepth; i++) {
-                        dstData[dstIndex + i] /= indicesSize;
+                        addScaledRow(dst, src, weight, _embDepth);
                     }
+                } else if (inIdx == 0) {
+                    copyRow(dst, src, _embDepth);
+                } else {
+                    addRow(dst, src, _embDepth);
                 }
-            } else {
+            }
+            if (_reduction == Reduction::MEAN) {
                 for (size_t i = 0LU; i < _embDepth; i++) {
-                    dstData[dstIndex + i] = 0;
+                    dst[i] /= bag.size;
                 }
             }
         }
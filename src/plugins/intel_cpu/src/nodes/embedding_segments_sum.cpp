@@ -4,6 +4,7 @@
 
 #include "embedding_segments_sum.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
@@ -116,6 +117,20 @@ void EmbeddingSegmentsSum::initFromInputs() {
     if (getParentEdges().size() > DEFAULT_INDEX_IDX) {
         defaultIndices_ = getSrcDataAtPortAs<const int>(DEFAULT_INDEX_IDX);
     }
+
+    // the first index and the number of the indices of each segment, found with a single pass over the segment ids
+    segmentRanges_.assign(std::max(lastNumSegments_, 0), {0LU, 0LU});
+    for (size_t si = 0; si < indicesSize_; si++) {
+        const auto segment = static_cast<size_t>(segmentIds_[si]);
+        if (segment >= segmentRanges_.size()) {
+            continue;
+        }
+        auto& range = segmentRanges_[segment];
+        if (range.second == 0) {
+            range.first = si;
+        }
+        range.second++;
+    }
 }
 
 void EmbeddingSegmentsSum::getIndices(size_t embIndex,
@@ -128,17 +143,12 @@ void EmbeddingSegmentsSum::getIndices(size_t embIndex,
     }
 
     indices = nullptr;
-    size = 0;
+    size = segmentRanges_[embIndex].second;
     withWeight = true;
 
-    for (int si = 0; si < static_cast<int>(indicesSize_); si++) {
-        if (static_cast<size_t>(segmentIds_[si]) == embIndex) {
-            size++;
-            if (indices == nullptr) {
-                indices = indices_ + si;
-                weightsIdx = si;
-            }
-        }
+    if (size != 0) {
+        indices = indices_ + segmentRanges_[embIndex].first;
+        weightsIdx = static_cast<int>(segmentRanges_[embIndex].first);
     }
 
     // Empty bag
@@ -9,6 +9,8 @@
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "embedding_bag.h"
 #include "graph_context.h"
@@ -50,6 +52,7 @@ private:
     const int* defaultIndices_ = nullptr;
 
     size_t indicesSize_ = 0;
+    std::vector<std::pair<size_t, size_t>> segmentRanges_;  // the first index and the size by the segment
 };
 
 }  // namespace ov::intel_cpu::node
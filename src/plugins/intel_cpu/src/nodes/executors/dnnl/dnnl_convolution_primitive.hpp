@@ -68,7 +68,7 @@ public:
                              const std::vector<impl_desc_type>& implPriorities,
                              impl_desc_type defaultImplType);
 
-    void execute(dnnl_primitive_args& primArgs);
+    void execute(const dnnl::stream& stream, dnnl_primitive_args& primArgs) const;
 
     [[nodiscard]] const DnnlMemoryDescPtr srcDesc() const {
         return m_srcDesc;
@@ -119,7 +119,6 @@ public:
     static std::tuple<size_t, size_t, size_t, size_t> getChannelParams(const ConvConfig& config);
 
 private:
-    dnnl::stream m_stream;
     dnnl::primitive_desc m_primDesc;
     impl_desc_type m_implType;
     DnnlMemoryDescPtr m_srcDesc;
@@ -34,6 +34,7 @@ public:
                  const bool fc3Das2D = false)
         : m_attrs(std::move(attrs)),
           m_context(std::move(context)),
+          m_stream(m_context->getEngine()),
           m_shapeAgnosticData(Primitive::createShapeAgnosticData(m_attrs, memory, m_context, cacheWeights)),
           m_primArgs(m_shapeAgnosticData->m_primAttrs.dnnlArgs),
           m_fc3Das2D(fc3Das2D) {}
@@ -55,15 +56,15 @@ public:
             m_primArgs[DNNL_ARG_DST].set_data_handle(memory.at(ARG_DST)->getData());
         }
 
-        m_primitive->execute(m_primArgs);
+        m_primitive->execute(m_stream, m_primArgs);
     }
 
     void execute() override {
-        m_primitive->execute(m_primArgs);
+        m_primitive->execute(m_stream, m_primArgs);
     }
 
     void execute() const override {
-        m_primitive->execute(m_primArgs);
+        m_primitive->execute(m_stream, m_primArgs);
     }
 
     [[nodiscard]] impl_desc_type implType() const override {
@@ -204,6 +205,8 @@ private:
     // @todo there is no real reason to store attrs. Better to just pass as api argument
     Attrs m_attrs;
     const ExecutorContext::CPtr m_context;
+    // the primitive may be shared between the streams, so the dnnl stream is kept per executor
+    dnnl::stream m_stream;
     std::shared_ptr<ShapeAgnosticData> m_shapeAgnosticData;
     dnnl_primitive_args& m_primArgs;
     bool resetSrcMemoryDataHandle = false;
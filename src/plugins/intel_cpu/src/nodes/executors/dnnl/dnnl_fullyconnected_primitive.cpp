@@ -110,7 +110,7 @@ std::shared_ptr<DnnlFCPrimitive> DnnlFCPrimitive::create(const MemoryArgs& memor
         return std::make_shared<DnnlFCPrimitive>(dnnlKey, context->getEngine(), context->getImplPriorities());
     };
 
-    auto runtimeCache = context->getRuntimeCache();
+    auto runtimeCache = context->getSharedRuntimeCache();
     const auto result = runtimeCache->getOrCreate(dnnlFCKey, builder);
     const auto& primitive = result.first;
     assert(primitive);
@@ -473,8 +473,7 @@ static impl_desc_type implTypeFromPrimDesc(const dnnl::primitive_desc& primDesc)
 DnnlFCPrimitive::DnnlFCPrimitive(const Key& key,
                                  const dnnl::engine& engine,
                                  const std::vector<impl_desc_type>& implPriorities)
-    : m_stream(dnnl::stream(engine)),
-      m_primDesc(createPrimitiveDesc(
+    : m_primDesc(createPrimitiveDesc(
           key.src->getDnnlDesc(),
           key.wei->getDnnlDesc(),
           key.bias->getDnnlDesc(),
@@ -491,8 +490,8 @@ DnnlFCPrimitive::DnnlFCPrimitive(const Key& key,
       m_scratchPadDesc(DnnlExtensionUtils::makeDescriptor(m_primDesc.scratchpad_desc())),
       m_prim(primitive(m_primDesc)) {}
 
-void DnnlFCPrimitive::execute(const dnnl_primitive_args& primArgs) const {
-    m_prim.execute(m_stream, primArgs);
+void DnnlFCPrimitive::execute(const dnnl::stream& stream, const dnnl_primitive_args& primArgs) const {
+    m_prim.execute(stream, primArgs);
 }
 
 }  // namespace ov::intel_cpu
@@ -118,7 +118,7 @@ std::shared_ptr<DnnlMatMulPrimitive> DnnlMatMulPrimitive::create(const MemoryArg
         return std::make_shared<DnnlMatMulPrimitive>(dnnlKey, context->getEngine(), context->getImplPriorities());
     };
 
-    auto runtimeCache = context->getRuntimeCache();
+    auto runtimeCache = context->getSharedRuntimeCache();
     const auto result = runtimeCache->getOrCreate(dnnlMatMulKey, builder);
     const auto& primitive = result.first;
     assert(primitive);
@@ -351,8 +351,7 @@ static impl_desc_type implTypeFromPrimDesc(const dnnl::primitive_desc& primDesc)
 DnnlMatMulPrimitive::DnnlMatMulPrimitive(const Key& key,
                                          const dnnl::engine& engine,
                                          const std::vector<impl_desc_type>& implPriorities)
-    : m_stream(dnnl::stream(engine)),
-      m_primDesc(createPrimitiveDesc(key.src->getDnnlDesc(),
+    : m_primDesc(createPrimitiveDesc(key.src->getDnnlDesc(),
                                      key.wei->getDnnlDesc(),
                                      key.bias->getDnnlDesc(),
                                      key.dst->getDnnlDesc(),
@@ -368,8 +367,8 @@ DnnlMatMulPrimitive::DnnlMatMulPrimitive(const Key& key,
       m_scratchPadDesc(DnnlExtensionUtils::makeDescriptor(m_primDesc.scratchpad_desc())),
       m_prim(primitive(m_primDesc)) {}
 
-void DnnlMatMulPrimitive::execute(const dnnl_primitive_args& primArgs) const {
-    m_prim.execute(m_stream, primArgs);
+void DnnlMatMulPrimitive::execute(const dnnl::stream& stream, const dnnl_primitive_args& primArgs) const {
+    m_prim.execute(stream, primArgs);
 }
 
 }  // namespace ov::intel_cpu
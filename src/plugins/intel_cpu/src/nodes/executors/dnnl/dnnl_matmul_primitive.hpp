@@ -37,7 +37,7 @@ class DnnlMatMulPrimitive {
 public:
     DnnlMatMulPrimitive(const Key& key, const dnnl::engine& engine, const std::vector<impl_desc_type>& implPriorities);
 
-    void execute(const dnnl_primitive_args& primArgs) const;
+    void execute(const dnnl::stream& stream, const dnnl_primitive_args& primArgs) const;
 
     [[nodiscard]] const DnnlMemoryDescPtr srcDesc() const {
         return m_srcDesc;
@@ -76,7 +76,6 @@ public:
                                                        const DnnlShapeAgnosticDataPtr& shapeAgnosticData);
 
 private:
-    dnnl::stream m_stream;
     dnnl::primitive_desc m_primDesc;
     impl_desc_type m_implType;
     DnnlMemoryDescPtr m_srcDesc;
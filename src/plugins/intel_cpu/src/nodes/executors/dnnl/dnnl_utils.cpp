@@ -83,8 +83,15 @@ MemoryPtr prepareWeightsMemory(const DnnlMemoryDescPtr srcWeightDesc,
     auto globalWeightCache = context->getWeightsCache();
     MemoryPtr ptr;
     if (globalWeightCache && dnnl::memory::format_kind::blocked == dstWeightDesc->getDnnlDesc().get_format_kind()) {
-        ptr = *globalWeightCache->findOrCreate(DnnlExtensionUtils::computeWeightsStringHash(weightsMem, dstWeightDesc),
-                                               create);
+        // the shift changes the repacked values, while the descriptors stay the same
+        const auto layoutHash = DnnlExtensionUtils::computeWeightsLayoutHash(srcWeightDesc, dstWeightDesc) +
+                                (needShiftSignedToUnsigned ? "_shift" : "");
+        ptr = *globalWeightCache->findOrCreateRepacked(
+            DnnlExtensionUtils::computeWeightsStringHash(weightsMem, dstWeightDesc),
+            weightsMem,
+            dstWeightDesc,
+            layoutHash,
+            create);
     } else {
         ptr = create();
     }
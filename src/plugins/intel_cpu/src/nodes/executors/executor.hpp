@@ -44,6 +44,7 @@ public:
                     std::vector<impl_desc_type> implPriorities,
                     std::shared_ptr<std::unordered_map<std::string, MemoryPtr>> privateWeighCache = nullptr)
         : runtimeCache(graphContext->getParamsCache()),
+          sharedRuntimeCache(graphContext->getSharedParamsCache()),
           scratchPads(graphContext->getScratchPads()),
           weightsCache(graphContext->getWeightsCache()),
           engine(graphContext->getEngine()),
@@ -60,6 +61,13 @@ public:
         return runtimeCachePtr;
     }
 
+    // cache for the stateless primitives, which can be executed concurrently by all the streams
+    [[nodiscard]] MultiCachePtr getSharedRuntimeCache() const {
+        auto sharedRuntimeCachePtr = sharedRuntimeCache.lock();
+        assert(sharedRuntimeCachePtr);
+        return sharedRuntimeCachePtr;
+    }
+
     [[nodiscard]] DnnlScratchPadPtr getScratchPad() const {
         return scratchPads[curNumaNodeId];
     }
@@ -84,6 +92,7 @@ private:
     // weak_ptr is required to avoid cycle dependencies with MultiCache
     // since ExecutorContext is stored in Executor itself
     MultiCacheWeakPtr runtimeCache;
+    MultiCacheWeakPtr sharedRuntimeCache;
     std::vector<DnnlScratchPadPtr> scratchPads;
     WeightsSharing::Ptr weightsCache;
     const dnnl::engine& engine;
@@ -592,7 +592,7 @@ static void quantize_block_by_channel(const ov::intel_cpu::PlainTensor& src,
     }
 }
 
-template <typename T, typename T2>
+template <typename T, ov::element::Type_t DST_PREC>
 static void attn_quant_mt(const ov::intel_cpu::PlainTensor& k_src,
                           const ov::intel_cpu::PlainTensor& v_src,
                           const ov::intel_cpu::PlainTensor& k_dst,
@@ -613,13 +613,13 @@ static void attn_quant_mt(const ov::intel_cpu::PlainTensor& k_src,
     if (quant_key_by_channel) {
         if (L0 == 0) {
             parallel_for3d(ov::intel_cpu::div_up(L1, key_group_size), B, H, [&](size_t group_id, size_t b, size_t h) {
-                quantize_by_channel<T, intel_cpu::precision_of<T2>::value>(
+                quantize_by_channel<T, DST_PREC>(
                     k_src.ptr<T>(b, h, group_id * key_group_size),
-                    k_dst.ptr<T2>(b, h, group_id * key_group_size),
+                    k_dst.ptr<uint8_t, DST_PREC>(b, h, group_id * key_group_size),
                     std::min(key_group_size, L1 - group_id * key_group_size),
                     S,
                     k_src.m_strides[2],
-                    k_dst.m_strides[2],
+                    k_dst.stride_bytes(2),
                     k_scale_zp.ptr<float>(group_id * 2, b, h),
                     k_scale_zp.ptr<float>(group_id * 2 + 1, b, h));
             });
@@ -631,8 +631,8 @@ static void attn_quant_mt(const ov::intel_cpu::PlainTensor& k_src,
                 float* thread_temp_buffer = temp_buffer + thread_id * key_group_size * S;
                 size_t remaining_group_size = prev_nums ? (key_group_size - prev_nums) : 0;
                 if (prev_nums) {
-                    attn_dequant_by_channel_kernel<float, intel_cpu::precision_of<T2>::value>(
-                        k_dst.ptr<uint8_t>(b, h, group_id * key_group_size),
+                    attn_dequant_by_channel_kernel<float, DST_PREC>(
+                        k_dst.ptr<uint8_t, DST_PREC>(b, h, group_id * key_group_size),
                         thread_temp_buffer,
                         prev_nums,
                         S,
@@ -647,13 +647,13 @@ static void attn_quant_mt(const ov::intel_cpu::PlainTensor& k_src,
                              S,
                              k_src.m_strides[2],
                              S);
-                    quantize_by_channel<float, intel_cpu::precision_of<T2>::value>(
+                    quantize_by_channel<float, DST_PREC>(
                         thread_temp_buffer,
-                        k_dst.ptr<T2>(b, h, group_id * key_group_size),
+                        k_dst.ptr<uint8_t, DST_PREC>(b, h, group_id * key_group_size),
                         remaining_group_size + prev_nums,
                         S,
                         S,
-                        k_dst.m_strides[2],
+                        k_dst.stride_bytes(2),
                         k_scale_zp.ptr<float>(group_id * 2, b, h),
                         k_scale_zp.ptr<float>(group_id * 2 + 1, b, h));
                 }
@@ -663,13 +663,13 @@ static void attn_quant_mt(const ov::intel_cpu::PlainTensor& k_src,
                     for (size_t new_group_id = prev_nums ? group_id + 1 : group_id, src_offset = 0;
                          new_group_id < ov::intel_cpu::div_up(L0 + L1, key_group_size);
                          new_group_id++, src_offset += key_group_size) {
-                        quantize_by_channel<T, intel_cpu::precision_of<T2>::value>(
+                        quantize_by_channel<T, DST_PREC>(
                             k_src.ptr<T>(b, h, remaining_group_size + src_offset),
-                            k_dst.ptr<T2>(b, h, new_group_id * key_group_size),
+                            k_dst.ptr<uint8_t, DST_PREC>(b, h, new_group_id * key_group_size),
                             std::min(key_group_size, new_seq - src_offset),
                             S,
                             k_src.m_strides[2],
-                            k_dst.m_strides[2],
+                            k_dst.stride_bytes(2),
                             k_scale_zp.ptr<float>(new_group_id * 2, b, h),
                             k_scale_zp.ptr<float>(new_group_id * 2 + 1, b, h));
                     }
@@ -680,22 +680,20 @@ static void attn_quant_mt(const ov::intel_cpu::PlainTensor& k_src,
         parallel_for3d(L1, B, H, [&](size_t m, size_t b, size_t h) {
             auto* p_k = k_scale_zp.ptr<float>(L0 + m, b, h);
             for (size_t group_id = 0; group_id < S / key_group_size; group_id++) {
-                quant_u8(k_src.ptr<T>(b, h, m, group_id * key_group_size),
-                         k_dst.ptr<T2>(b, h, L0 + m, group_id * key_group_size),
-                         key_group_size,
-                         p_k[group_id * 2],
-                         p_k[group_id * 2 + 1]);
+                quantize<T, DST_PREC>(k_src.ptr<T>(b, h, m, group_id * key_group_size),
+                                      k_dst.ptr<uint8_t, DST_PREC>(b, h, L0 + m, group_id * key_group_size),
+                                      key_group_size,
+                                      p_k + group_id * 2);
             }
         });
     }
     parallel_for3d(L1, B, H, [&](size_t m, size_t b, size_t h) {
         auto* p_v = v_scale_zp.ptr<float>(L0 + m, b, h);
         for (size_t group_id = 0; group_id < SV / value_group_size; group_id++) {
-            quant_u8(v_src.ptr<T>(b, h, m, group_id * value_group_size),
-                     v_dst.ptr<T2>(b, h, L0 + m, group_id * value_group_size),
-                     value_group_size,
-                     p_v[group_id * 2],
-                     p_v[group_id * 2 + 1]);
+            quantize<T, DST_PREC>(v_src.ptr<T>(b, h, m, group_id * value_group_size),
+                                  v_dst.ptr<uint8_t, DST_PREC>(b, h, L0 + m, group_id * value_group_size),
+                                  value_group_size,
+                                  p_v + group_id * 2);
         }
     });
 }
@@ -782,42 +780,74 @@ void attn_quantkv(const ov::intel_cpu::PlainTensor& k_src,
                   const bool quant_k_by_channel,
                   const size_t k_group_size,
                   const size_t v_group_size) {
-    if (k_src.get_precision() == ov::element::f32 && k_dst.get_precision() == ov::element::u8) {
-        attn_quant_mt<float, uint8_t>(k_src,
-                                      v_src,
-                                      k_dst,
-                                      v_dst,
-                                      L0,
-                                      temp_buffer,
-                                      k_scale_zp,
-                                      v_scale_zp,
-                                      quant_k_by_channel,
-                                      k_group_size,
-                                      v_group_size);
-    } else if (k_src.get_precision() == ov::element::bf16 && k_dst.get_precision() == ov::element::u8) {
-        attn_quant_mt<ov::bfloat16, uint8_t>(k_src,
-                                             v_src,
-                                             k_dst,
-                                             v_dst,
-                                             L0,
-                                             temp_buffer,
-                                             k_scale_zp,
-                                             v_scale_zp,
-                                             quant_k_by_channel,
-                                             k_group_size,
-                                             v_group_size);
-    } else if (k_src.get_precision() == ov::element::f16 && k_dst.get_precision() == ov::element::u8) {
-        attn_quant_mt<ov::float16, uint8_t>(k_src,
-                                            v_src,
-                                            k_dst,
-                                            v_dst,
-                                            L0,
-                                            temp_buffer,
-                                            k_scale_zp,
-                                            v_scale_zp,
-                                            quant_k_by_channel,
-                                            k_group_size,
-                                            v_group_size);
+    using function_type = void (*)(const ov::intel_cpu::PlainTensor&,
+                                   const ov::intel_cpu::PlainTensor&,
+                                   const ov::intel_cpu::PlainTensor&,
+                                   const ov::intel_cpu::PlainTensor&,
+                                   const size_t,
+                                   float*,
+                                   const ov::intel_cpu::PlainTensor&,
+                                   const ov::intel_cpu::PlainTensor&,
+                                   const bool,
+                                   const size_t,
+                                   const size_t);
+    static constexpr function_type funcs_fp32[] = {
+        attn_quant_mt<float, ov::element::u8>,
+        attn_quant_mt<float, ov::element::u4>,
+    };
+    static constexpr function_type funcs_bf16[] = {
+        attn_quant_mt<ov::bfloat16, ov::element::u8>,
+        attn_quant_mt<ov::bfloat16, ov::element::u4>,
+    };
+    static constexpr function_type funcs_f16[] = {
+        attn_quant_mt<ov::float16, ov::element::u8>,
+        attn_quant_mt<ov::float16, ov::element::u4>,
+    };
+    if (!ov::intel_cpu::one_of(k_dst.get_precision(), ov::element::u8, ov::element::u4) ||
+        v_dst.get_precision() != k_dst.get_precision()) {
+        OPENVINO_THROW("unsupport src type: ",
+                       k_src.get_precision(),
+                       ", dst type: ",
+                       k_dst.get_precision(),
+                       " in attn_quantkv");
+    }
+    size_t dispatch = k_dst.get_precision() == ov::element::u4 ? 1 : 0;
+    if (k_src.get_precision() == ov::element::f32) {
+        funcs_fp32[dispatch](k_src,
+                             v_src,
+                             k_dst,
+                             v_dst,
+                             L0,
+                             temp_buffer,
+                             k_scale_zp,
+                             v_scale_zp,
+                             quant_k_by_channel,
+                             k_group_size,
+                             v_group_size);
+    } else if (k_src.get_precision() == ov::element::bf16) {
+        funcs_bf16[dispatch](k_src,
+                             v_src,
+                             k_dst,
+                             v_dst,
+                             L0,
+                             temp_buffer,
+                             k_scale_zp,
+                             v_scale_zp,
+                             quant_k_by_channel,
+                             k_group_size,
+                             v_group_size);
+    } else if (k_src.get_precision() == ov::element::f16) {
+        funcs_f16[dispatch](k_src,
+                            v_src,
+                            k_dst,
+                            v_dst,
+                            L0,
+                            temp_buffer,
+                            k_scale_zp,
+                            v_scale_zp,
+                            quant_k_by_channel,
+                            k_group_size,
+                            v_group_size);
     } else {
         OPENVINO_THROW("unsupport src type: ",
                        k_src.get_precision(),
@@ -936,6 +966,14 @@ void attn_dequant_u8(const uint8_t* src, float* dst, size_t n, float scale, floa
     attn_dequant_kernel<float, ov::element::u8>(src, dst, n, scale, zp);
 }
 
+void attn_quant_u4(const float* src, uint8_t* dst, size_t n, float& scale, float& zp) {
+    quant_u4(src, dst, n, scale, zp);
+}
+
+void attn_dequant_u4(const uint8_t* src, float* dst, size_t n, float scale, float zp) {
+    attn_dequant_kernel<float, ov::element::u4>(src, dst, n, scale, zp);
+}
+
 void attn_quant_by_channel_u8(const float* src,
                               uint8_t* dst,
                               size_t seq_dim,
@@ -959,4 +997,27 @@ void attn_dequant_by_channel_u8(const uint8_t* src,
                                    ov::element::u8>(src, dst, seq_dim, hidden_dims, src_stride, dst_stride, scale, zp);
 }
 
+void attn_quant_by_channel_u4(const float* src,
+                              uint8_t* dst,
+                              size_t seq_dim,
+                              size_t hidden_dims,
+                              size_t src_stride,
+                              size_t dst_stride,
+                              float* scale,
+                              float* zp) {
+    quantize_by_channel<float, ov::element::u4>(src, dst, seq_dim, hidden_dims, src_stride, dst_stride, scale, zp);
+}
+
+void attn_dequant_by_channel_u4(const uint8_t* src,
+                                float* dst,
+                                size_t seq_dim,
+                                size_t hidden_dims,
+                                size_t src_stride,
+                                size_t dst_stride,
+                                float* scale,
+                                float* zp) {
+    attn_dequant_by_channel_kernel<float,
+                                   ov::element::u4>(src, dst, seq_dim, hidden_dims, src_stride, dst_stride, scale, zp);
+}
+
 }  // namespace ov::Extensions::Cpu::XARCH
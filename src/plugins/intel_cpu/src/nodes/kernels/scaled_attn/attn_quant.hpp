@@ -41,6 +41,11 @@ void attn_quant_u8(const float* src, uint8_t* dst, size_t n, float& scale, float
 
 void attn_dequant_u8(const uint8_t* src, float* dst, size_t n, float scale, float zp);
 
+// u4 values are packed by two in a byte, n must be even
+void attn_quant_u4(const float* src, uint8_t* dst, size_t n, float& scale, float& zp);
+
+void attn_dequant_u4(const uint8_t* src, float* dst, size_t n, float scale, float zp);
+
 void attn_quant_by_channel_u8(const float* src,
                               uint8_t* dst,
                               size_t seq_dim,
@@ -59,4 +64,23 @@ void attn_dequant_by_channel_u8(const uint8_t* src,
                                 float* scale,
                                 float* zp);
 
+// the strides of the u4 data are in bytes
+void attn_quant_by_channel_u4(const float* src,
+                              uint8_t* dst,
+                              size_t seq_dim,
+                              size_t hidden_dims,
+                              size_t src_stride,
+                              size_t dst_stride,
+                              float* scale,
+                              float* zp);
+
+void attn_dequant_by_channel_u4(const uint8_t* src,
+                                float* dst,
+                                size_t seq_dim,
+                                size_t hidden_dims,
+                                size_t src_stride,
+                                size_t dst_stride,
+                                float* scale,
+                                float* zp);
+
 }  // namespace ov::Extensions::Cpu::XARCH
@@ -2742,7 +2742,8 @@ struct MHAHelper {
     }
 #    endif
 
-    // compute one token, loop along batch and head dimensions
+    // compute one token or several draft tokens (causal among themselves) of a sequence, loop along batch and head
+    // dimensions
     // all tensors such as query... have no batch dimension because batch dimension is varying
     //  query: [H, L, S]
     //  present_*: [block_number, H, 32, S]
@@ -2810,13 +2811,15 @@ struct MHAHelper {
 #    endif
 
         for (size_t pq = 0; pq < q_len; pq++) {
+            // the query tokens are the last q_len tokens of the sequence, each one attends to the preceding tokens only
+            const auto ncausal = cur_kv_len - (q_len - 1 - pq);
             for (size_t h = hq_beg; h < hq_end; h++) {
                 // apply attention mask & sofmax
                 float* alibi_lookup = nullptr;
                 float alibi_slope = 0.F;
                 if (alibi_slopes) {
                     alibi_slope = alibi_slopes.ptr<float>()[h];
-                    alibi_lookup = _alibi_lookup.ptr<float>() + _alibi_lookup.m_dims[0] - cur_kv_len;
+                    alibi_lookup = _alibi_lookup.ptr<float>() + _alibi_lookup.m_dims[0] - ncausal;
                 }
                 attn_softmax_kernel<float>(_weight.ptr<float>(ithr, h - hq_beg, pq),
                                            _weight.ptr<float>(ithr, h - hq_beg, pq),
@@ -2825,7 +2828,7 @@ struct MHAHelper {
                                            nullptr,
                                            nullptr,
                                            false,
-                                           cur_kv_len,
+                                           ncausal,
                                            cur_kv_len,
                                            ov::element::f32,
                                            ov::element::f32,
@@ -2840,7 +2843,9 @@ struct MHAHelper {
             }
         }
 
-        memset(_output.ptr<float>(ithr), 0, q_len * H * SV * sizeof(float));
+        for (size_t pq = 0; pq < q_len; pq++) {
+            memset(_output.ptr<float>(ithr, pq), 0, H * SV * sizeof(float));
+        }
         for (size_t pv = 0, i = 0; pv < cur_kv_len; pv += _block_size, i++) {
             auto block_number = block_table[i];
             for (size_t pq = 0; pq < q_len; pq++) {
@@ -2879,10 +2884,12 @@ struct MHAHelper {
     // compute one token, loop along batch, head dimensions and kv_len, it's special for very long kv_len with small
     // batch tokens. It will assume NO mixture execution of first and second token. all tensors such as query... have
     // batch dimension which is DIFFERENT from above
-    //  query: [B, H, L, S]
+    // A sequence may have several tokens (the draft tokens of speculative decoding), the token attends to the past
+    // and to the preceding tokens of the sequence
+    //  query: [B_token, H, 1, S]
     //  key_cache: [block_number, H, _block_size, S]
     //  value_cache: [block_number, H, _block_size, Sv]
-    //  output_emb: [B, L, H * S]
+    //  output_emb: [B_token, 1, H * S]
     // 3 loops along batch, head, kv cache length dimensions
     void exec_loop_bhl(const PlainTensor& query,
                        PlainTensor& key_cache,
@@ -2891,13 +2898,21 @@ struct MHAHelper {
                        const PlainTensor& output_score,
                        size_t max_context_len,
                        const PlainTensor& past_lens,
-                       [[maybe_unused]] const PlainTensor& subsequence_begins,
+                       const PlainTensor& subsequence_begins,
                        const PlainTensor& block_indices,
                        const PlainTensor& block_indices_begins,
                        const PlainTensor& alibi_slopes,
                        const PlainTensor& score_aggregation_window) {
         auto B = past_lens.size(0);
-        auto q_len = query.size(2);
+        const auto* q_begins = subsequence_begins.ptr<int32_t>();
+        auto get_q_len = [&](size_t b) {
+            return static_cast<size_t>(q_begins[b + 1] - q_begins[b]);
+        };
+        // max number of the tokens in a sequence
+        size_t q_len = 0;
+        for (size_t b = 0; b < B; b++) {
+            q_len = std::max(q_len, get_q_len(b));
+        }
         auto kv_len_in_blocks = div_up(max_context_len, _block_size);
         // aligned to cache line (64bytes=16*sizeof(float)) to avoid false sharing
         _weight_bhl.resize<float>({B, H, q_len, rnd_up(max_context_len, std::max(_block_size, size_t{16}))});
@@ -2932,7 +2947,9 @@ struct MHAHelper {
                 }
             };
         auto loop_qk = [&](size_t b, size_t pk_in_blocks, size_t hx) {
-            auto context_len = static_cast<size_t>(past_lens.ptr<int32_t>()[b]) + 1;
+            auto past_len = static_cast<size_t>(past_lens.ptr<int32_t>()[b]);
+            auto seq_q_len = get_q_len(b);
+            auto context_len = past_len + seq_q_len;
             size_t hk = 0;
             size_t hq_beg = 0;
             size_t hq_end = 0;
@@ -2945,10 +2962,10 @@ struct MHAHelper {
 #    if defined(OPENVINO_ARCH_X86_64)
                 if (one_of(_fastpath_valid_prec, ov::element::bf16, ov::element::f16)) {
                     _gemv->tile_config();
-                    for (size_t pq = 0; pq < q_len; pq++) {
+                    for (size_t pq = 0; pq < seq_q_len && pk < past_len + pq + 1; pq++) {
                         for (size_t h = hq_beg; h < hq_end; h++) {
                             (*_gemv)(
-                                query.ptr<DATA_TYPE>(b, h, pq),
+                                query.ptr<DATA_TYPE>(q_begins[b] + pq, h, 0),
                                 key_cache.ptr<typename ov::element_type_traits<KEY_PREC>::value_type>(block_number, hk),
                                 _weight_bhl.ptr<float>(b, h, pq) + pk);
                         }
@@ -2956,25 +2973,27 @@ struct MHAHelper {
                     _gemv->tile_release();
                 } else {
 #    endif
-                    for (size_t pq = 0; pq < q_len; pq++) {
+                    // the key block is reused by all tokens of the sequence
+                    for (size_t pq = 0; pq < seq_q_len && pk < past_len + pq + 1; pq++) {
+                        const auto token_context_len = past_len + pq + 1;
                         for (size_t h = hq_beg; h < hq_end; h++) {
                             if constexpr (one_of(KEY_PREC, ov::element::u8, ov::element::u4)) {
                                 dot_product_block_quantized<DATA_TYPE, KEY_PREC>(
-                                    query.ptr<DATA_TYPE>(b, h, pq),
+                                    query.ptr<DATA_TYPE>(q_begins[b] + pq, h, 0),
                                     key_cache.ptr<uint8_t, KEY_PREC>(block_number, hk),
                                     _weight_bhl.ptr<float>(b, h, pq) + pk,
                                     S,
                                     _quant_key_bychannel,
-                                    std::min(_block_size, context_len - pk),
+                                    std::min(_block_size, token_context_len - pk),
                                     _key_group_size);
                             } else {
                                 dot_product_block<DATA_TYPE, KEY_PREC>(
-                                    query.ptr<DATA_TYPE>(b, h, pq),
+                                    query.ptr<DATA_TYPE>(q_begins[b] + pq, h, 0),
                                     key_cache.ptr<typename ov::element_type_traits<KEY_PREC>::value_type>(block_number,
                                                                                                           hk),
                                     _weight_bhl.ptr<float>(b, h, pq) + pk,
                                     S,
-                                    std::min(_block_size, context_len - pk),
+                                    std::min(_block_size, token_context_len - pk),
                                     _key_group_size);
                             }
                         }
@@ -2986,7 +3005,10 @@ struct MHAHelper {
         };
 
         auto loop_softmax = [&](size_t b, size_t h, size_t pq) {
-            auto cur_kv_len = static_cast<size_t>(past_lens.ptr<int32_t>()[b]) + 1;
+            if (pq >= get_q_len(b)) {
+                return;
+            }
+            auto cur_kv_len = static_cast<size_t>(past_lens.ptr<int32_t>()[b]) + pq + 1;
             auto ncausal = cur_kv_len;
             // apply attention mask & sofmax
             float* alibi_lookup = nullptr;
@@ -3040,7 +3062,9 @@ struct MHAHelper {
         });
 
         auto loop_wk = [&](size_t b, size_t pv_in_blocks, size_t hx) {
-            auto context_len = static_cast<size_t>(past_lens.ptr<int32_t>()[b]) + 1;
+            auto past_len = static_cast<size_t>(past_lens.ptr<int32_t>()[b]);
+            auto seq_q_len = get_q_len(b);
+            auto context_len = past_len + seq_q_len;
             auto pv = pv_in_blocks * _block_size;
             size_t hk = 0;
             size_t hq_beg = 0;
@@ -3050,7 +3074,8 @@ struct MHAHelper {
             // kv_len must be valid
             if (pv < context_len) {
                 auto block_number = block_indices.ptr<int32_t>()[block_indices_begins.ptr<int32_t>()[b] + pv_in_blocks];
-                for (size_t pq = 0; pq < q_len; pq++) {
+                for (size_t pq = 0; pq < seq_q_len && pv < past_len + pq + 1; pq++) {
+                    const auto token_context_len = past_len + pq + 1;
                     for (size_t h = hq_beg; h < hq_end; h++) {
                         if constexpr (one_of(VALUE_PREC, ov::element::u8, ov::element::u4)) {
                             attn_acc_value_block_quantized<uint8_t, VALUE_PREC>(
@@ -3059,7 +3084,7 @@ struct MHAHelper {
                                 value_cache.ptr<uint8_t, VALUE_PREC>(block_number, hk),
                                 SV,
                                 _quant_value_bychannel,
-                                std::min(_block_size, context_len - pv),
+                                std::min(_block_size, token_context_len - pv),
                                 _value_group_size);
                         } else {
                             auto* v_ptr =
@@ -3069,7 +3094,7 @@ struct MHAHelper {
                                 _weight_bhl.ptr<float>(b, h, pq) + pv,
                                 v_ptr,
                                 SV,
-                                std::min(_block_size, context_len - pv),
+                                std::min(_block_size, token_context_len - pv),
                                 _value_group_size);
                         }
                     }
@@ -3084,9 +3109,12 @@ struct MHAHelper {
         }
 
         parallel_for3d(B, H, q_len, [&](size_t b, size_t h, size_t pq) {
+            if (pq >= get_q_len(b)) {
+                return;
+            }
             auto* temp = _output_bhl.ptr<float>(b, 0, h, pq);
             size_t temp_stride = _output_bhl.stride(1);  // split with pv_in_blocks steps
-            auto* dst = output_emb.ptr<DATA_TYPE>(b, pq, h * SV);
+            auto* dst = output_emb.ptr<DATA_TYPE>(q_begins[b] + pq, 0, h * SV);
             attn_reduce(dst, temp, kv_len_in_blocks, SV, temp_stride);
         });
     }
@@ -3096,9 +3124,9 @@ template <typename DATA_TYPE, ov::element::Type_t KEY_PREC, ov::element::Type_t
 struct MHA {
     MHAHelper<DATA_TYPE, KEY_PREC, VALUE_PREC>& _helper;
     struct AttnWorkItem {
-        int32_t batch_in_reorder;  // which batch in reorder buffer will be used
+        int32_t batch_in_reorder;  // which batch in reorder buffer will be used, -1 for the decoded tokens
         int32_t batch_in_seq;      // batch idx in sequence
-        int32_t q_len;             // current sequence length, 1 for second token, 2+ for first token
+        int32_t q_len;             // current sequence length, 1 for second token, 2+ for first token or draft tokens
         int32_t q_block_id;        // block id in this seq, valid at first token
     };
     struct ReorderWorkItem {
@@ -3114,29 +3142,34 @@ struct MHA {
         int32_t max_kv_len_in_reorder = 0;  // max kv len between first tokens
         int32_t max_batch_in_reorder = 0;
         int32_t total_kv_len = 0;
+        int32_t max_q_len_in_decode = 0;  // max number of the decoded tokens in a sequence
 
     public:
+        // max_decode_q_len: the sequences with up to this number of tokens are computed directly from the cache
         void reset([[maybe_unused]] const PlainTensor& query,
                    const PlainTensor& past_lens,
                    const PlainTensor& subsequence_begins,
-                   size_t block_size) {
+                   size_t block_size,
+                   int32_t max_decode_q_len) {
             attn_items.clear();
             reorder_items.clear();
             max_kv_len_in_reorder = 0;
             max_batch_in_reorder = 0;
             total_kv_len = 0;
+            max_q_len_in_decode = 0;
 
             auto seq_cout = static_cast<int32_t>(past_lens.m_dims[0]);
             for (int32_t i = 0; i < seq_cout; i++) {
                 auto q_len = subsequence_begins.ptr<int32_t>()[i + 1] - subsequence_begins.ptr<int32_t>()[i];
                 auto kv_len = past_lens.ptr<int32_t>()[i] + q_len;
                 auto kv_len_in_block = static_cast<int32_t>(div_up(kv_len, block_size));
-                if (q_len == 1) {
-                    attn_items.emplace_back(AttnWorkItem{0,     // batch_in_reorder
-                                                         i,     // batch_in_seq
-                                                         1ULL,  // q_len
+                if (q_len <= max_decode_q_len) {
+                    attn_items.emplace_back(AttnWorkItem{-1,     // batch_in_reorder
+                                                         i,      // batch_in_seq
+                                                         q_len,  // q_len
                                                          // kv_len in blocks, used in the sort function
                                                          kv_len_in_block - 1});
+                    max_q_len_in_decode = std::max(max_q_len_in_decode, q_len);
                 } else {
                     auto reorder_sub_work_count = kv_len_in_block;
                     max_kv_len_in_reorder = std::max(max_kv_len_in_reorder, kv_len);
@@ -3192,8 +3225,16 @@ struct MHA {
         [[nodiscard]] size_t get_total_kv_len() const {
             return static_cast<size_t>(total_kv_len);
         }
+        [[nodiscard]] size_t get_decode_max_q_len() const {
+            return static_cast<size_t>(max_q_len_in_decode);
+        }
     };
 
+    // The sequences with up to this number of new tokens, i.e. the draft tokens validated by speculative decoding, are
+    // computed like the second token: directly from the cache with the causal mask among the new tokens. It is
+    // cheaper than the repacking of the whole cache of the sequence for the first token kernels.
+    static constexpr int32_t max_decode_q_len = 8;
+
     WorkItems _workitems;
 
     MHA(MHAHelper<DATA_TYPE, KEY_PREC, VALUE_PREC>& helper) : _helper(helper) {}
@@ -3335,8 +3376,8 @@ struct MHA {
             const auto q_len = static_cast<size_t>(item.q_len);
             size_t ithr = parallel_get_thread_num();
 
-            if (q_len == 1) {
-                const auto cur_kv_len = static_cast<size_t>(past_lens.ptr<int32_t>()[batch_in_seq]) + 1;
+            if (item.batch_in_reorder < 0) {
+                const auto cur_kv_len = static_cast<size_t>(past_lens.ptr<int32_t>()[batch_in_seq]) + q_len;
                 float* score_output = nullptr;
                 if (output_score) {
                     const auto score_win_len =
@@ -3347,17 +3388,21 @@ struct MHA {
                     }
                 }
 
+                PlainTensor sub_query;
+                sub_query.resize({q_len, _helper.H, _helper.S}, q.ptr<DATA_TYPE>(batch_in_token));
+                sub_query = sub_query.permute({1, 0, 2});
                 _helper.exec_kernel_one_bh(
-                    q.slice(0, batch_in_token, batch_in_token),
+                    sub_query,
                     k_cache,
                     v_cache,
-                    output_emb.slice(0, batch_in_token, batch_in_token),
+                    output_emb.slice(0, batch_in_token, batch_in_token + q_len)
+                        .reshape({q_len, _helper.H * _helper.SV}),
                     block_indices.ptr<int32_t>() + block_indices_begins.ptr<int32_t>()[batch_in_seq],
                     ithr,
                     hq_beg,
                     hq_end,
                     hk,
-                    1UL,
+                    q_len,
                     cur_kv_len,
                     alibi_slopes,
                     score_output);
@@ -3489,7 +3534,14 @@ struct MHA {
                     const PlainTensor& block_indices_begins,
                     const PlainTensor& alibi_slopes,
                     const PlainTensor& score_aggregation_window) {
-        _workitems.reset(query, past_lens, subsequence_begins, _helper._block_size);
+        // the scores are aggregated and the sliding window is applied by the first token kernels only,
+        // so the sequences with more than one new token are sent to the decode kernels without them
+        const bool multi_token_decode = !output_score && _helper._sliding_window == 0;
+        _workitems.reset(query,
+                         past_lens,
+                         subsequence_begins,
+                         _helper._block_size,
+                         multi_token_decode ? max_decode_q_len : 1);
         if (output_score) {
             _helper.init_score_buffers(past_lens, subsequence_begins, score_aggregation_window);
         }
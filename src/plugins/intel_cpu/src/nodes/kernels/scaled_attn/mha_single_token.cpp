@@ -17,6 +17,7 @@
 #endif
 
 #include "mha_single_token.hpp"
+#include "nodes/kernels/scaled_attn/common.hpp"
 #include "openvino/core/parallel.hpp"
 #include "openvino/core/type/bfloat16.hpp"
 #include "softmax_kernel.hpp"
@@ -387,6 +388,53 @@ static void attn_acc_value(float* out, float weight, uint8_t* v, size_t S, float
     }
 }
 
+// u4 cache: two values are packed in a byte, the even one is in the high half
+static void
+attn_acc_value_u4(float* out, float weight, uint8_t* v, size_t S, float* scale, float* zp, size_t group_size) {
+    for (size_t group_id = 0; group_id < S / group_size; group_id++) {
+        size_t i = 0;
+        float group_scale = *(scale + group_id * 2);
+        float group_zp = *(zp + group_id * 2);
+        size_t offset = group_id * group_size;
+#if defined(HAVE_AVX512F)
+        auto attn_w_vec_fp32 = _mm512_set1_ps(weight * group_scale);
+        auto v_zp = _mm512_set1_ps(group_zp);
+        for (; i + 2 * vec_len_f32_avx512 <= group_size; i += 2 * vec_len_f32_avx512) {
+            __m512 v0_value, v1_value;
+            mm512_loadu_u4_to_f32(v + (offset + i) / 2, v0_value, v1_value);
+            auto v0_out = mm512_uni_loadu_ps(out + offset + i);
+            auto v1_out = mm512_uni_loadu_ps(out + offset + i + vec_len_f32_avx512);
+            v0_value = _mm512_sub_ps(v0_value, v_zp);
+            v1_value = _mm512_sub_ps(v1_value, v_zp);
+            v0_out = _mm512_fmadd_ps(attn_w_vec_fp32, v0_value, v0_out);
+            v1_out = _mm512_fmadd_ps(attn_w_vec_fp32, v1_value, v1_out);
+            mm512_uni_storeu_ps(out + offset + i, v0_out);
+            mm512_uni_storeu_ps(out + offset + i + vec_len_f32_avx512, v1_out);
+        }
+#elif defined(HAVE_AVX2)
+        auto attn_w_vec_fp32 = _mm256_set1_ps(weight * group_scale);
+        auto v_zp = _mm256_set1_ps(group_zp);
+        for (; i + 2 * vec_len_f32_avx2 <= group_size; i += 2 * vec_len_f32_avx2) {
+            __m256 v0_value, v1_value;
+            mm256_loadu_u4_to_f32(v + (offset + i) / 2, v0_value, v1_value);
+            auto v0_out = mm256_uni_loadu_ps(out + offset + i);
+            auto v1_out = mm256_uni_loadu_ps(out + offset + i + vec_len_f32_avx2);
+            v0_value = _mm256_sub_ps(v0_value, v_zp);
+            v1_value = _mm256_sub_ps(v1_value, v_zp);
+            v0_out = _mm256_fmadd_ps(attn_w_vec_fp32, v0_value, v0_out);
+            v1_out = _mm256_fmadd_ps(attn_w_vec_fp32, v1_value, v1_out);
+            mm256_uni_storeu_ps(out + offset + i, v0_out);
+            mm256_uni_storeu_ps(out + offset + i + vec_len_f32_avx2, v1_out);
+        }
+#endif
+        for (; i < group_size; i += 2) {
+            uint8_t data = v[(offset + i) / 2];
+            out[offset + i] += weight * (extract_half_byte(data, false) - group_zp) * group_scale;
+            out[offset + i + 1] += weight * (extract_half_byte(data, true) - group_zp) * group_scale;
+        }
+    }
+}
+
 template <typename T>
 void sum_q_head(T* a, size_t n, size_t group_size, float* out) {
     size_t group_id = 0;
@@ -1273,6 +1321,137 @@ static float dot_product(TA* a, uint8_t* b, size_t n, float* scale, float* zp, f
 #endif
 }
 
+template <typename TA>
+static float dot_product_u4(TA* a, uint8_t* b, size_t n, float* scale, float* zp, size_t group_size) {
+    float sum = 0.0f;
+    for (size_t group_id = 0; group_id < n / group_size; group_id++) {
+        float group_scale = *(scale + group_id * 2);
+        float group_zp = *(zp + group_id * 2);
+        size_t offset = group_id * group_size;
+        size_t i = 0;
+        float group_sum = 0.0f;
+#if defined(HAVE_AVX512F)
+        auto v_zp = _mm512_set1_ps(group_zp);
+        auto vsum0 = _mm512_set1_ps(0.0f);
+        auto vsum1 = _mm512_set1_ps(0.0f);
+        for (; i + 2 * vec_len_f32_avx512 <= group_size; i += 2 * vec_len_f32_avx512) {
+            auto va0 = mm512_uni_loadu_ps(a + offset + i);
+            auto va1 = mm512_uni_loadu_ps(a + offset + i + vec_len_f32_avx512);
+            __m512 vb0, vb1;
+            mm512_loadu_u4_to_f32(b + (offset + i) / 2, vb0, vb1);
+            vb0 = _mm512_sub_ps(vb0, v_zp);
+            vb1 = _mm512_sub_ps(vb1, v_zp);
+            vsum0 = _mm512_fmadd_ps(va0, vb0, vsum0);
+            vsum1 = _mm512_fmadd_ps(va1, vb1, vsum1);
+        }
+        vsum0 = _mm512_add_ps(vsum0, vsum1);
+        group_sum = _mm512_reduce_add_ps(vsum0);
+#elif defined(HAVE_AVX2)
+        auto v_zp = _mm256_set1_ps(group_zp);
+        auto vsum0 = _mm256_set1_ps(0.0f);
+        auto vsum1 = _mm256_set1_ps(0.0f);
+        for (; i + 2 * vec_len_f32_avx2 <= group_size; i += 2 * vec_len_f32_avx2) {
+            auto va0 = mm256_uni_loadu_ps(a + offset + i);
+            auto va1 = mm256_uni_loadu_ps(a + offset + i + vec_len_f32_avx2);
+            __m256 vb0, vb1;
+            mm256_loadu_u4_to_f32(b + (offset + i) / 2, vb0, vb1);
+            vb0 = _mm256_sub_ps(vb0, v_zp);
+            vb1 = _mm256_sub_ps(vb1, v_zp);
+            vsum0 = _mm256_fmadd_ps(va0, vb0, vsum0);
+            vsum1 = _mm256_fmadd_ps(va1, vb1, vsum1);
+        }
+        vsum0 = _mm256_add_ps(vsum0, vsum1);
+        hsum(vsum0);
+        group_sum = _mm256_cvtss_f32(vsum0);
+#endif
+        for (; i < group_size; i += 2) {
+            uint8_t data = b[(offset + i) / 2];
+            group_sum += a[offset + i] * (extract_half_byte(data, false) - group_zp);
+            group_sum += a[offset + i + 1] * (extract_half_byte(data, true) - group_zp);
+        }
+        sum += group_scale * group_sum;
+    }
+    return sum;
+}
+
+template <typename TA>
+static float dot_product_by_channel_u4(TA* a, uint8_t* b, size_t n, const float* scale, const float* zp) {
+    float sum = 0.0f;
+    size_t i = 0;
+#if defined(HAVE_AVX512F)
+    auto vsum0 = _mm512_set1_ps(0.0f);
+    auto vsum1 = _mm512_set1_ps(0.0f);
+    for (; i + 2 * vec_len_f32_avx512 <= n; i += 2 * vec_len_f32_avx512) {
+        auto va0 = mm512_uni_loadu_ps(a + i);
+        auto va1 = mm512_uni_loadu_ps(a + i + vec_len_f32_avx512);
+        __m512 vb0, vb1;
+        mm512_loadu_u4_to_f32(b + i / 2, vb0, vb1);
+        vb0 = _mm512_sub_ps(vb0, _mm512_loadu_ps(zp + i));
+        vb1 = _mm512_sub_ps(vb1, _mm512_loadu_ps(zp + i + vec_len_f32_avx512));
+        vb0 = _mm512_mul_ps(vb0, _mm512_loadu_ps(scale + i));
+        vb1 = _mm512_mul_ps(vb1, _mm512_loadu_ps(scale + i + vec_len_f32_avx512));
+        vsum0 = _mm512_fmadd_ps(va0, vb0, vsum0);
+        vsum1 = _mm512_fmadd_ps(va1, vb1, vsum1);
+    }
+    vsum0 = _mm512_add_ps(vsum0, vsum1);
+    sum += _mm512_reduce_add_ps(vsum0);
+#elif defined(HAVE_AVX2)
+    auto vsum0 = _mm256_set1_ps(0.0f);
+    auto vsum1 = _mm256_set1_ps(0.0f);
+    for (; i + 2 * vec_len_f32_avx2 <= n; i += 2 * vec_len_f32_avx2) {
+        auto va0 = mm256_uni_loadu_ps(a + i);
+        auto va1 = mm256_uni_loadu_ps(a + i + vec_len_f32_avx2);
+        __m256 vb0, vb1;
+        mm256_loadu_u4_to_f32(b + i / 2, vb0, vb1);
+        vb0 = _mm256_sub_ps(vb0, _mm256_loadu_ps(zp + i));
+        vb1 = _mm256_sub_ps(vb1, _mm256_loadu_ps(zp + i + vec_len_f32_avx2));
+        vb0 = _mm256_mul_ps(vb0, _mm256_loadu_ps(scale + i));
+        vb1 = _mm256_mul_ps(vb1, _mm256_loadu_ps(scale + i + vec_len_f32_avx2));
+        vsum0 = _mm256_fmadd_ps(va0, vb0, vsum0);
+        vsum1 = _mm256_fmadd_ps(va1, vb1, vsum1);
+    }
+    vsum0 = _mm256_add_ps(vsum0, vsum1);
+    hsum(vsum0);
+    sum += _mm256_cvtss_f32(vsum0);
+#endif
+    for (; i < n; i += 2) {
+        uint8_t data = b[i / 2];
+        sum += a[i] * (extract_half_byte(data, false) - zp[i]) * scale[i];
+        sum += a[i + 1] * (extract_half_byte(data, true) - zp[i + 1]) * scale[i + 1];
+    }
+    return sum;
+}
+
+// dispatch of the dot product and of the value accumulation by the precision of the cache: the u4 cache is addressed
+// in bytes like u8 one
+template <ov::element::Type_t KV_PREC, typename TA, typename TB>
+static float
+dot_product_kv(TA* a, TB* b, size_t n, float* scale, float* zp, float* head_sum, size_t group_size) {
+    if constexpr (KV_PREC == ov::element::u4) {
+        return dot_product_u4(a, b, n, scale, zp, group_size);
+    } else {
+        return dot_product(a, b, n, scale, zp, head_sum, group_size);
+    }
+}
+
+template <ov::element::Type_t KV_PREC, typename TA>
+static float dot_product_by_channel_kv(TA* a, uint8_t* b, size_t n, float* scale, float* zp, size_t group_size) {
+    if constexpr (KV_PREC == ov::element::u4) {
+        return dot_product_by_channel_u4(a, b, n, scale, zp);
+    } else {
+        return dot_product_by_channel(a, b, n, scale, zp, group_size);
+    }
+}
+
+template <ov::element::Type_t KV_PREC, typename TO, typename TW, typename TV>
+static void attn_acc_value_kv(TO* out, TW weight, TV* v, size_t S, float* scale, float* zp, size_t group_size) {
+    if constexpr (KV_PREC == ov::element::u4) {
+        attn_acc_value_u4(out, weight, v, S, scale, zp, group_size);
+    } else {
+        attn_acc_value(out, weight, v, S, scale, zp, group_size);
+    }
+}
+
 template <typename T>
 static void attn_reduce(T* dst, float* temp, size_t M, size_t S, size_t temp_stride) {
     size_t i = 0;
@@ -1388,7 +1567,10 @@ static void attn_reduce(ov::float16* dst, ov::float16* temp, size_t M, size_t S,
 }
 #endif
 
-template <typename T, typename T2, typename T3>
+template <typename T,
+          typename T2,
+          typename T3,
+          ov::element::Type_t KV_PREC = ov::intel_cpu::precision_of<T2>::value>
 static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
                                     const ov::intel_cpu::PlainTensor& present_key,
                                     const ov::intel_cpu::PlainTensor& present_value,
@@ -1433,7 +1615,7 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
     // avx2 will pre-compute the zero point and try to save the sub instruction in the dot_product,
     //  but it seems not necessary for avx512. Possible reason may be that for avx2 the cost of dot_product
     //  is larger than the memory access time, but for avx512 is not and the cost of pre-compute is a pure increase.
-    if (pastkv_is_int8 && !quant_key_by_channel) {
+    if (pastkv_is_int8 && !quant_key_by_channel && KV_PREC != ov::element::u4) {
         // be sure no false sharing
         size_t group_num = S / key_group_size;
         head_sum.resize<float>({B, H, q_len, group_num + 16});
@@ -1477,20 +1659,21 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
                         if (quant_key_by_channel && pastkv_is_int8) {
                             auto* p_scale = past_k_scale_zp.ptr<float>(pk / key_group_size * 2, 0, h_group);
                             auto* p_zp = past_k_scale_zp.ptr<float>(pk / key_group_size * 2 + 1, 0, h_group);
-                            auto* p_k = present_key.ptr<uint8_t>(0, h_group, pk);
+                            auto* p_k = present_key.ptr<uint8_t, KV_PREC>(0, h_group, pk);
                             prefetch_bytes(S, _MM_HINT_T0, 4096, p_k);
-                            buf_attn_w.ptr<T3>(0, h_group, 0)[pk] =
-                                dot_product_by_channel(query.ptr<T>(0, h_group), p_k, S, p_scale, p_zp, key_group_size);
+                            buf_attn_w.ptr<T3>(0, h_group, 0)[pk] = dot_product_by_channel_kv<KV_PREC>(
+                                query.ptr<T>(0, h_group), p_k, S, p_scale, p_zp, key_group_size);
                         } else {
-                            auto p_k = present_key.ptr<T2>(0, h_group, pk);
+                            auto p_k = present_key.ptr<T2, KV_PREC>(0, h_group, pk);
                             prefetch_bytes(S, _MM_HINT_T0, 4096, p_k);
-                            buf_attn_w.ptr<T3>(0, h_group, 0)[pk] = dot_product(query.ptr<T>(0, h_group),
-                                                                                p_k,
-                                                                                S,
-                                                                                p,
-                                                                                p + 1,
-                                                                                head_sum.ptr<float>(0, h_group),
-                                                                                key_group_size);
+                            buf_attn_w.ptr<T3>(0, h_group, 0)[pk] =
+                                dot_product_kv<KV_PREC>(query.ptr<T>(0, h_group),
+                                                        p_k,
+                                                        S,
+                                                        p,
+                                                        p + 1,
+                                                        head_sum.ptr<float>(0, h_group),
+                                                        key_group_size);
                         }
                         parallel_it_step(pk, kv_len, b, B, h_group, h_group_num);
                     }
@@ -1516,18 +1699,19 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
                         if (quant_key_by_channel && pastkv_is_int8) {
                             auto* p_scale = past_k_scale_zp.ptr<float>(pk / key_group_size * 2, b_kv, h_group);
                             auto* p_zp = past_k_scale_zp.ptr<float>(pk / key_group_size * 2 + 1, b_kv, h_group);
-                            auto* p_k = present_key.ptr<uint8_t>(b_kv, h_group, pk);
-                            buf_attn_w.ptr<T3>(b, h_group, 0)[pk] =
-                                dot_product_by_channel(query.ptr<T>(b, h_group), p_k, S, p_scale, p_zp, key_group_size);
+                            auto* p_k = present_key.ptr<uint8_t, KV_PREC>(b_kv, h_group, pk);
+                            buf_attn_w.ptr<T3>(b, h_group, 0)[pk] = dot_product_by_channel_kv<KV_PREC>(
+                                query.ptr<T>(b, h_group), p_k, S, p_scale, p_zp, key_group_size);
                         } else {
-                            auto p_k = present_key.ptr<T2>(b_kv, h_group, pk);
-                            buf_attn_w.ptr<T3>(b, h_group, 0)[pk] = dot_product(query.ptr<T>(b, h_group),
-                                                                                p_k,
-                                                                                S,
-                                                                                p,
-                                                                                p + 1,
-                                                                                head_sum.ptr<float>(b, h_group),
-                                                                                key_group_size);
+                            auto p_k = present_key.ptr<T2, KV_PREC>(b_kv, h_group, pk);
+                            buf_attn_w.ptr<T3>(b, h_group, 0)[pk] =
+                                dot_product_kv<KV_PREC>(query.ptr<T>(b, h_group),
+                                                        p_k,
+                                                        S,
+                                                        p,
+                                                        p + 1,
+                                                        head_sum.ptr<float>(b, h_group),
+                                                        key_group_size);
                         }
                         parallel_it_step(pk, kv_len, b, B, h_group, h_group_num);
                     }
@@ -1555,21 +1739,23 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
                             if (quant_key_by_channel && pastkv_is_int8) {
                                 auto* p_scale = past_k_scale_zp.ptr<float>(pk / key_group_size * 2, b_kv, h_group);
                                 auto* p_zp = past_k_scale_zp.ptr<float>(pk / key_group_size * 2 + 1, b_kv, h_group);
-                                auto* p_k = present_key.ptr<uint8_t>(b_kv, h_group, pk);
-                                buf_attn_w.ptr<T3>(b, h, pq)[pk] = dot_product_by_channel(query.ptr<T>(b, h, pq),
-                                                                                          p_k,
-                                                                                          S,
-                                                                                          p_scale,
-                                                                                          p_zp,
-                                                                                          key_group_size);
+                                auto* p_k = present_key.ptr<uint8_t, KV_PREC>(b_kv, h_group, pk);
+                                buf_attn_w.ptr<T3>(b, h, pq)[pk] =
+                                    dot_product_by_channel_kv<KV_PREC>(query.ptr<T>(b, h, pq),
+                                                                       p_k,
+                                                                       S,
+                                                                       p_scale,
+                                                                       p_zp,
+                                                                       key_group_size);
                             } else {
-                                buf_attn_w.ptr<T3>(b, h, pq)[pk] = dot_product(query.ptr<T>(b, h, pq),
-                                                                               present_key.ptr<T2>(b_kv, h_group, pk),
-                                                                               S,
-                                                                               p,
-                                                                               p + 1,
-                                                                               head_sum.ptr<float>(b, h, pq),
-                                                                               key_group_size);
+                                buf_attn_w.ptr<T3>(b, h, pq)[pk] =
+                                    dot_product_kv<KV_PREC>(query.ptr<T>(b, h, pq),
+                                                            present_key.ptr<T2, KV_PREC>(b_kv, h_group, pk),
+                                                            S,
+                                                            p,
+                                                            p + 1,
+                                                            head_sum.ptr<float>(b, h, pq),
+                                                            key_group_size);
                             }
                         }
                     }
@@ -1612,18 +1798,18 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
             memset(buf_attn_score.ptr<T3>(ithr), 0, q_len * h_each_group_len * SV * sizeof(T3));
             for (size_t pv = 0; pv < kv_len; pv++) {
                 auto b_kv = beams ? beams.ptr<int32_t>(b)[pv] : b;
-                auto* v = present_value.ptr<T2>(b_kv, h_group, pv);
+                auto* v = present_value.ptr<T2, KV_PREC>(b_kv, h_group, pv);
                 auto* p = past_v_scale_zp.ptr<float>(pv, b_kv, h_group);
                 for (size_t pq = 0; pq < q_len; pq++) {
                     for (size_t h = h_group * h_each_group_len, group_idx = 0; h < (h_group + 1) * h_each_group_len;
                          h++, group_idx++) {
-                        attn_acc_value(buf_attn_score.ptr<T3>(ithr, pq, group_idx),
-                                       buf_attn_w.ptr<T3>(b, h, pq)[pv],
-                                       v,
-                                       SV,
-                                       p + 0,
-                                       p + 1,
-                                       value_group_size);
+                        attn_acc_value_kv<KV_PREC>(buf_attn_score.ptr<T3>(ithr, pq, group_idx),
+                                                   buf_attn_w.ptr<T3>(b, h, pq)[pv],
+                                                   v,
+                                                   SV,
+                                                   p + 0,
+                                                   p + 1,
+                                                   value_group_size);
                     }
                 }
             }
@@ -1656,31 +1842,31 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
             if (q_len == 1 && h_each_group_len == 1) {
                 for (size_t iwork = start; iwork < end; ++iwork) {
                     auto b_kv = beams ? beams.ptr<int32_t>(b)[pv] : b;
-                    auto* v = present_value.ptr<T2>(b_kv, h_group, pv);
+                    auto* v = present_value.ptr<T2, KV_PREC>(b_kv, h_group, pv);
                     auto* p = past_v_scale_zp.ptr<float>(pv, b_kv, h_group);
-                    attn_acc_value(buf_attn_score.ptr<T3>(ithr, b, 0, h_group),
-                                   buf_attn_w.ptr<T3>(b, h_group, 0, pv)[0],
-                                   v,
-                                   SV,
-                                   p + 0,
-                                   p + 1,
-                                   value_group_size);
+                    attn_acc_value_kv<KV_PREC>(buf_attn_score.ptr<T3>(ithr, b, 0, h_group),
+                                               buf_attn_w.ptr<T3>(b, h_group, 0, pv)[0],
+                                               v,
+                                               SV,
+                                               p + 0,
+                                               p + 1,
+                                               value_group_size);
                     parallel_it_step(pv, kv_len, b, B, h_group, h_group_num);
                 }
             } else {
                 for (size_t iwork = start; iwork < end; ++iwork) {
                     auto b_kv = beams ? beams.ptr<int32_t>(b)[pv] : b;
-                    auto* v = present_value.ptr<T2>(b_kv, h_group, pv);
+                    auto* v = present_value.ptr<T2, KV_PREC>(b_kv, h_group, pv);
                     auto* p = past_v_scale_zp.ptr<float>(pv, b_kv, h_group);
                     for (size_t pq = 0; pq < q_len; pq++) {
                         for (size_t h = h_group * h_each_group_len; h < (h_group + 1) * h_each_group_len; h++) {
-                            attn_acc_value(buf_attn_score.ptr<T3>(ithr, b, pq, h),
-                                           buf_attn_w.ptr<T3>(b, h, pq)[pv],
-                                           v,
-                                           SV,
-                                           p + 0,
-                                           p + 1,
-                                           value_group_size);
+                            attn_acc_value_kv<KV_PREC>(buf_attn_score.ptr<T3>(ithr, b, pq, h),
+                                                       buf_attn_w.ptr<T3>(b, h, pq)[pv],
+                                                       v,
+                                                       SV,
+                                                       p + 0,
+                                                       p + 1,
+                                                       value_group_size);
                         }
                     }
                     parallel_it_step(pv, kv_len, b, B, h_group, h_group_num);
@@ -1739,6 +1925,25 @@ void mha_single_token(const ov::intel_cpu::PlainTensor& query,
                                                                   key_group_size,
                                                                   value_group_size,
                                                                   quant_key_by_channel);
+        } else if (present_key.get_precision() == ov::element::u4) {
+            mha_single_token_kernel<ov::bfloat16, uint8_t, float, ov::element::u4>(query,
+                                                                                   present_key,
+                                                                                   present_value,
+                                                                                   alibi_mask,
+                                                                                   attention_mask,
+                                                                                   beams,
+                                                                                   output_emb,
+                                                                                   buf_attn_w,
+                                                                                   buf_attn_score,
+                                                                                   has_out_transpose,
+                                                                                   auto_causal,
+                                                                                   d_scale,
+                                                                                   past_k_scale_zp,
+                                                                                   past_v_scale_zp,
+                                                                                   head_sum,
+                                                                                   key_group_size,
+                                                                                   value_group_size,
+                                                                                   quant_key_by_channel);
         } else {
             mha_single_token_kernel<ov::bfloat16, ov::bfloat16, float>(query,
                                                                        present_key,
@@ -1803,6 +2008,25 @@ void mha_single_token(const ov::intel_cpu::PlainTensor& query,
                                                                  key_group_size,
                                                                  value_group_size,
                                                                  quant_key_by_channel);
+        } else if (present_key.get_precision() == ov::element::u4) {
+            mha_single_token_kernel<ov::float16, uint8_t, float, ov::element::u4>(query,
+                                                                                  present_key,
+                                                                                  present_value,
+                                                                                  alibi_mask,
+                                                                                  attention_mask,
+                                                                                  beams,
+                                                                                  output_emb,
+                                                                                  buf_attn_w,
+                                                                                  buf_attn_score,
+                                                                                  has_out_transpose,
+                                                                                  auto_causal,
+                                                                                  d_scale,
+                                                                                  past_k_scale_zp,
+                                                                                  past_v_scale_zp,
+                                                                                  head_sum,
+                                                                                  key_group_size,
+                                                                                  value_group_size,
+                                                                                  quant_key_by_channel);
         } else {
             mha_single_token_kernel<ov::float16, ov::float16, float>(query,
                                                                      present_key,
@@ -1844,6 +2068,25 @@ void mha_single_token(const ov::intel_cpu::PlainTensor& query,
                                                            key_group_size,
                                                            value_group_size,
                                                            quant_key_by_channel);
+        } else if (present_key.get_precision() == ov::element::u4) {
+            mha_single_token_kernel<float, uint8_t, float, ov::element::u4>(query,
+                                                                            present_key,
+                                                                            present_value,
+                                                                            alibi_mask,
+                                                                            attention_mask,
+                                                                            beams,
+                                                                            output_emb,
+                                                                            buf_attn_w,
+                                                                            buf_attn_score,
+                                                                            has_out_transpose,
+                                                                            auto_causal,
+                                                                            d_scale,
+                                                                            past_k_scale_zp,
+                                                                            past_v_scale_zp,
+                                                                            head_sum,
+                                                                            key_group_size,
+                                                                            value_group_size,
+                                                                            quant_key_by_channel);
         } else if (present_key.get_precision() == ov::element::f16) {
             mha_single_token_kernel<float, ov::float16, float>(query,
                                                                present_key,
@@ -6,8 +6,13 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <map>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
+#include <set>
 #include <string>
 #include <utility>
 #include <vector>
@@ -19,19 +24,125 @@
 #include "memory_desc/cpu_memory_desc.h"
 #include "node.h"
 #include "onednn/iml_type_mapper.h"
+#include "openvino/core/any.hpp"
+#include "openvino/core/axis_set.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/node.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/shape.hpp"
+#include "openvino/core/type.hpp"
 #include "openvino/core/type/element_type.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/cum_sum.hpp"
+#include "openvino/op/grn.hpp"
+#include "openvino/op/log_softmax.hpp"
+#include "openvino/op/logical_not.hpp"
+#include "openvino/op/mvn.hpp"
+#include "openvino/op/normalize_l2.hpp"
+#include "openvino/op/select.hpp"
+#include "openvino/op/softmax.hpp"
+#include "openvino/op/swish.hpp"
+#include "openvino/op/util/attr_types.hpp"
+#include "openvino/op/util/binary_elementwise_arithmetic.hpp"
+#include "openvino/op/util/binary_elementwise_comparison.hpp"
+#include "openvino/op/util/binary_elementwise_logical.hpp"
+#include "openvino/op/util/topk_base.hpp"
+#include "openvino/op/util/unary_elementwise_arithmetic.hpp"
 #include "openvino/runtime/tensor.hpp"
 #include "shape_inference/shape_inference_cpu.hpp"
 #include "shape_inference/shape_inference_status.hpp"
+#include "utils/general_utils.h"
 
 namespace ov::intel_cpu::node {
 
+namespace {
+
+// the reference kernels are too slow to benefit from the threads on the smaller amounts of elements
+constexpr size_t minElementsPerThread = 4096;
+// the elementwise chunks are multiples of 64 elements, so the threads never write to the same cache line and the
+// vectorized loops of the kernels do not get the remainders in the middle of the tensor
+constexpr size_t elementsPerBlock = 64;
+
+bool isSplittable(const ov::element::Type& type) {
+    return type.is_static() && type != ov::element::string && type.bitwidth() % 8 == 0;
+}
+
+// the view of the dense tensor starting with the element start
+ov::Tensor sliceTensor(ov::Tensor tensor, const ov::Shape& shape, size_t start) {
+    auto* data = static_cast<uint8_t*>(tensor.data()) + start * tensor.get_element_type().size();
+    return {tensor.get_element_type(), shape, data};
+}
+
+bool getConstantAxes(const ov::Node& op, size_t port, int64_t rank, ov::AxisSet& axes) {
+    auto constant = ov::as_type_ptr<ov::op::v0::Constant>(op.get_input_node_shared_ptr(port));
+    if (!constant) {
+        return false;
+    }
+    for (auto axis : constant->cast_vector<int64_t>()) {
+        axes.insert(axis < 0 ? axis + rank : axis);
+    }
+    return true;
+}
+
+}  // namespace
+
+Reference::ParallelTrait Reference::getParallelTrait(const ov::Node& op) {
+    ParallelTrait trait;
+    if ((ov::is_type<ov::op::util::UnaryElementwiseArithmetic>(&op) && !ov::is_type<ov::op::v0::GRN>(&op)) ||
+        ov::is_type<ov::op::util::BinaryElementwiseArithmetic>(&op) ||
+        ov::is_type<ov::op::util::BinaryElementwiseComparison>(&op) ||
+        ov::is_type<ov::op::util::BinaryElementwiseLogical>(&op) || ov::is_type<ov::op::v1::LogicalNot>(&op) ||
+        ov::is_type<ov::op::v0::Convert>(&op) || ov::is_type<ov::op::v1::Select>(&op) ||
+        ov::is_type<ov::op::v4::Swish>(&op)) {
+        trait.kind = ParallelTrait::Kind::Elementwise;
+        trait.numpyBroadcast = op.get_autob().m_type == ov::op::AutoBroadcastType::NUMPY;
+        return trait;
+    }
+
+    const auto& inputRank = op.get_input_partial_shape(0).rank();
+    if (inputRank.is_dynamic()) {
+        return trait;
+    }
+    const auto rank = inputRank.get_length();
+    auto normalize = [rank](int64_t axis) {
+        return static_cast<size_t>(axis < 0 ? axis + rank : axis);
+    };
+
+    ov::AxisSet dependentAxes;
+    if (const auto* softmax = ov::as_type<const ov::op::v1::Softmax>(&op)) {
+        dependentAxes.insert(softmax->get_axis());
+    } else if (const auto* softmax = ov::as_type<const ov::op::v8::Softmax>(&op)) {
+        dependentAxes.insert(normalize(softmax->get_axis()));
+    } else if (const auto* logSoftmax = ov::as_type<const ov::op::v5::LogSoftmax>(&op)) {
+        dependentAxes.insert(normalize(logSoftmax->get_axis()));
+    } else if (const auto* mvn = ov::as_type<const ov::op::v0::MVN>(&op)) {
+        dependentAxes = mvn->get_reduction_axes();
+    } else if (const auto* topK = ov::as_type<const ov::op::util::TopKBase>(&op)) {
+        dependentAxes.insert(topK->get_axis());
+    } else if (ov::is_type<ov::op::v6::MVN>(&op) || ov::is_type<ov::op::v0::NormalizeL2>(&op) ||
+               ov::is_type<ov::op::v0::CumSum>(&op)) {
+        // CumSum without the axis input computes along the axis 0
+        if (op.get_input_size() < 2) {
+            dependentAxes.insert(0);
+        } else if (!getConstantAxes(op, 1, rank, dependentAxes)) {
+            return trait;
+        }
+    } else {
+        return trait;
+    }
+
+    trait.kind = ParallelTrait::Kind::Outer;
+    trait.slicedInputs = {0};
+    trait.dependentAxes = std::move(dependentAxes);
+    return trait;
+}
+
 Reference::Reference(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context, std::string errorMessage)
     : Node(op, context, NgraphShapeInferFactory(op)),
       ovCoreNode(op),
-      additionalErrorMessage(std::move(errorMessage)) {
+      additionalErrorMessage(std::move(errorMessage)),
+      parallelTrait(getParallelTrait(*op)) {
     if (!op->has_evaluate()) {
         OPENVINO_THROW_NOT_IMPLEMENTED(
             "Cannot fallback on ngraph reference implementation. Ngraph::Node::evaluate() is not implemented for op: ",
@@ -71,11 +182,166 @@ void Reference::createPrimitive() {
 void Reference::execute([[maybe_unused]] const dnnl::stream& strm) {
     auto inputs = prepareInputs();
     auto outputs = prepareOutputs();
+    evaluate(outputs, inputs);
+}
+
+void Reference::evaluate(ov::TensorVector& outputs, const ov::TensorVector& inputs) {
+    switch (parallelTrait.kind) {
+    case ParallelTrait::Kind::Elementwise:
+        executedInParallel = evaluateElementwise(outputs, inputs);
+        break;
+    case ParallelTrait::Kind::Outer:
+        executedInParallel = evaluateOuter(outputs, inputs);
+        break;
+    default:
+        executedInParallel = false;
+        break;
+    }
+    if (executedInParallel) {
+        return;
+    }
     if (!ovCoreNode->evaluate(outputs, inputs)) {
         THROW_CPU_NODE_ERR("evaluation failed for core operation: ", std::string(ovCoreNode->get_type_name()));
     }
 }
 
+bool Reference::evaluateElementwise(const ov::TensorVector& outputs, const ov::TensorVector& inputs) const {
+    const auto& shape = outputs[0].get_shape();
+    const auto size = ov::shape_size(shape);
+    const auto nthr = static_cast<int>(std::min<size_t>(parallel_get_max_threads(), size / minElementsPerThread));
+    if (nthr < 2) {
+        return false;
+    }
+
+    std::vector<bool> sliced(inputs.size());
+    for (size_t i = 0; i < inputs.size(); i++) {
+        const auto& inputShape = inputs[i].get_shape();
+        if (inputShape == shape && isSplittable(inputs[i].get_element_type())) {
+            sliced[i] = true;
+        } else if (!ov::is_scalar(inputShape) && !(parallelTrait.numpyBroadcast && ov::shape_size(inputShape) == 1)) {
+            return false;
+        }
+    }
+    for (const auto& output : outputs) {
+        if (output.get_shape() != shape || !isSplittable(output.get_element_type())) {
+            return false;
+        }
+    }
+
+    const auto blocks = div_up(size, elementsPerBlock);
+    evaluateChunks(nthr, [&](int ithr, int nthr, ov::TensorVector& chunkInputs, ov::TensorVector& chunkOutputs) {
+        size_t start = 0;
+        size_t end = 0;
+        splitter(blocks, nthr, ithr, start, end);
+        start *= elementsPerBlock;
+        end = std::min(end * elementsPerBlock, size);
+        if (start >= end) {
+            return false;
+        }
+        const ov::Shape chunkShape{end - start};
+        for (size_t i = 0; i < inputs.size(); i++) {
+            if (sliced[i]) {
+                chunkInputs.push_back(sliceTensor(inputs[i], chunkShape, start));
+            } else if (ov::is_scalar(inputs[i].get_shape())) {
+                chunkInputs.push_back(inputs[i]);
+            } else {
+                // the single element input is broadcast to the 1D chunk
+                chunkInputs.push_back(sliceTensor(inputs[i], ov::Shape{1}, 0));
+            }
+        }
+        for (const auto& output : outputs) {
+            chunkOutputs.push_back(sliceTensor(output, chunkShape, start));
+        }
+        return true;
+    });
+    return true;
+}
+
+bool Reference::evaluateOuter(const ov::TensorVector& outputs, const ov::TensorVector& inputs) const {
+    std::vector<const ov::Tensor*> slicedTensors;
+    for (auto port : parallelTrait.slicedInputs) {
+        slicedTensors.push_back(&inputs[port]);
+    }
+    for (const auto& output : outputs) {
+        slicedTensors.push_back(&output);
+    }
+
+    // the dims before the split axis must be 1, so each part of a tensor is dense
+    const auto& shape = inputs[parallelTrait.slicedInputs.front()].get_shape();
+    size_t axis = 0;
+    while (axis < shape.size() && shape[axis] == 1) {
+        axis++;
+    }
+    if (axis == shape.size() || parallelTrait.dependentAxes.count(axis) != 0) {
+        return false;
+    }
+    for (const auto* tensor : slicedTensors) {
+        const auto& tensorShape = tensor->get_shape();
+        if (tensorShape.size() != shape.size() ||
+            !std::equal(shape.begin(), shape.begin() + axis + 1, tensorShape.begin()) ||
+            !isSplittable(tensor->get_element_type())) {
+            return false;
+        }
+    }
+
+    const auto work = shape[axis];
+    const auto maxThreads = static_cast<size_t>(parallel_get_max_threads());
+    const auto nthr = static_cast<int>(std::min({maxThreads, work, ov::shape_size(shape) / minElementsPerThread}));
+    if (nthr < 2) {
+        return false;
+    }
+
+    evaluateChunks(nthr, [&](int ithr, int nthr, ov::TensorVector& chunkInputs, ov::TensorVector& chunkOutputs) {
+        size_t start = 0;
+        size_t end = 0;
+        splitter(work, nthr, ithr, start, end);
+        if (start >= end) {
+            return false;
+        }
+        auto slice = [&](const ov::Tensor& tensor) {
+            auto chunkShape = tensor.get_shape();
+            const auto innerSize = ov::shape_size(chunkShape) / chunkShape[axis];
+            chunkShape[axis] = end - start;
+            return sliceTensor(tensor, chunkShape, start * innerSize);
+        };
+        chunkInputs = inputs;
+        for (auto port : parallelTrait.slicedInputs) {
+            chunkInputs[port] = slice(inputs[port]);
+        }
+        for (const auto& output : outputs) {
+            chunkOutputs.push_back(slice(output));
+        }
+        return true;
+    });
+    return true;
+}
+
+void Reference::evaluateChunks(
+    int nthr,
+    const std::function<bool(int, int, ov::TensorVector&, ov::TensorVector&)>& makeChunk) const {
+    std::vector<std::exception_ptr> errors(nthr);
+    std::vector<uint8_t> failed(nthr, 0);
+    ov::parallel_nt_static(nthr, [&](const int ithr, const int nthr) {
+        try {
+            ov::TensorVector chunkInputs;
+            ov::TensorVector chunkOutputs;
+            if (makeChunk(ithr, nthr, chunkInputs, chunkOutputs)) {
+                failed[ithr] = !ovCoreNode->evaluate(chunkOutputs, chunkInputs);
+            }
+        } catch (...) {
+            errors[ithr] = std::current_exception();
+        }
+    });
+    for (int ithr = 0; ithr < nthr; ithr++) {
+        if (errors[ithr]) {
+            std::rethrow_exception(errors[ithr]);
+        }
+        if (failed[ithr]) {
+            THROW_CPU_NODE_ERR("evaluation failed for core operation: ", std::string(ovCoreNode->get_type_name()));
+        }
+    }
+}
+
 void Reference::executeDynamicImpl(const dnnl::stream& strm) {
     if (!hasOutputShapeDataDependency) {
         // if there is no data dependency for the output shape, we can execute the operation as is, similar to the
@@ -133,6 +399,44 @@ void Reference::executeDynamicImpl(const dnnl::stream& strm) {
     }
 }
 
+ov::AnyMap Reference::fallbackReport(const std::vector<std::vector<NodePtr>>& graphsNodes) {
+    struct OpStatistics {
+        std::set<std::string> nodes;  // by name, the graphs of the same model have the same nodes
+        std::set<std::string> parallelNodes;
+        uint64_t time = 0;
+    };
+    std::map<std::string, OpStatistics> statistics;
+    uint64_t totalTime = 0;
+    for (const auto& nodes : graphsNodes) {
+        for (const auto& node : nodes) {
+            if (node->isConstant()) {
+                continue;
+            }
+            const auto time = node->PerfCounter().avg();
+            totalTime += time;
+            const auto* reference = dynamic_cast<const Reference*>(node.get());
+            if (!reference) {
+                continue;
+            }
+            auto& opStatistics = statistics[reference->ovCoreNode->get_type_info().name];
+            opStatistics.nodes.insert(node->getName());
+            if (reference->executedInParallel) {
+                opStatistics.parallelNodes.insert(node->getName());
+            }
+            opStatistics.time += time;
+        }
+    }
+
+    ov::AnyMap report;
+    for (const auto& [type, opStatistics] : statistics) {
+        const double timeShare = totalTime != 0 ? 100.0 * opStatistics.time / totalTime : 0.0;
+        report[type] = ov::AnyMap{{"NODES", static_cast<int64_t>(opStatistics.nodes.size())},
+                                  {"PARALLEL_NODES", static_cast<int64_t>(opStatistics.parallelNodes.size())},
+                                  {"TIME_SHARE", timeShare}};
+    }
+    return report;
+}
+
 bool Reference::created() const {
     return getType() == Type::Reference;
 }
@@ -6,11 +6,17 @@
 
 #include <node.h>
 
+#include <atomic>
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
+#include <vector>
 
 #include "graph_context.h"
+#include "openvino/core/any.hpp"
+#include "openvino/core/axis_set.hpp"
 #include "openvino/core/node.hpp"
 #include "openvino/runtime/tensor.hpp"
 
@@ -38,13 +44,49 @@ public:
     }
     void executeDynamicImpl(const dnnl::stream& strm) override;
 
+    /**
+     * @brief Summary of the ops executed by the reference fallback among the non constant nodes, by the op type: the
+     * number of "NODES" of the model, the number of the nodes the last execution of which was split across the threads
+     * in any of the graphs ("PARALLEL_NODES") and the share of the nodes in the inference time of all the graphs in
+     * percents ("TIME_SHARE", only measured with ov::enable_profiling).
+     * @param graphsNodes the nodes of the graphs of the same model, e.g. one per stream
+     */
+    static ov::AnyMap fallbackReport(const std::vector<std::vector<NodePtr>>& graphsNodes);
+
 private:
+    // how the evaluation of the op can be split into the independent parts
+    struct ParallelTrait {
+        enum class Kind : uint8_t {
+            None,
+            // all the outputs and the non scalar inputs have the same shape, the tensors are split as 1D
+            Elementwise,
+            // the outputs and the sliced inputs are split along the outermost non unit axis which is not dependent
+            Outer,
+        };
+        Kind kind = Kind::None;
+        bool numpyBroadcast = false;       // Elementwise: the single element inputs can be broadcast
+        std::vector<size_t> slicedInputs;  // Outer: the other inputs (axes, k, etc.) are passed as is
+        ov::AxisSet dependentAxes;         // Outer: the axes the op computes along
+    };
+
+    static ParallelTrait getParallelTrait(const ov::Node& op);
+
     ov::TensorVector prepareInputs() const;
     ov::TensorVector prepareOutputs() const;
 
+    void evaluate(ov::TensorVector& outputs, const ov::TensorVector& inputs);
+    bool evaluateElementwise(const ov::TensorVector& outputs, const ov::TensorVector& inputs) const;
+    bool evaluateOuter(const ov::TensorVector& outputs, const ov::TensorVector& inputs) const;
+    // evaluates the chunks produced by makeChunk(ithr, nthr, inputs, outputs) on the threads
+    void evaluateChunks(int nthr,
+                        const std::function<bool(int, int, ov::TensorVector&, ov::TensorVector&)>& makeChunk) const;
+
     const std::shared_ptr<ov::Node> ovCoreNode;
     const std::string additionalErrorMessage;
     bool hasOutputShapeDataDependency = false;  // flag to cache the output shape data dependency check result
+    ParallelTrait parallelTrait;
+    // written by execute() and read by the fallback report requested from the compiled model on another thread
+    std::atomic<bool> executedInParallel{false};
 };
 
 }  // namespace ov::intel_cpu::node
@@ -1131,8 +1131,13 @@ ScaledDotProductAttention::ScaledDotProductAttention(const std::shared_ptr<ov::N
     const auto keyS = *(keyDims.end() - 1);
     const auto valueS = *(valueDims.end() - 1);
     CPU_NODE_ASSERT(valueCachePrecision == keyCachePrecision, "supports same key/value cache precision");
-    CPU_NODE_ASSERT(one_of(keyCachePrecision, ov::element::f32, ov::element::f16, ov::element::bf16, ov::element::u8),
-                    "supports key/value cache precision f32, f16, bf16, u8 but gets ",
+    CPU_NODE_ASSERT(one_of(keyCachePrecision,
+                           ov::element::f32,
+                           ov::element::f16,
+                           ov::element::bf16,
+                           ov::element::u8,
+                           ov::element::u4),
+                    "supports key/value cache precision f32, f16, bf16, u8, u4 but gets ",
                     keyCachePrecision);
     m_key_quant_param.groupSize = (cpuConfig.keyCacheGroupSize == 0 || keyS % cpuConfig.keyCacheGroupSize != 0)
                                       ? keyS
@@ -1257,6 +1262,11 @@ void ScaledDotProductAttention::createPrimitive() {
                        std::to_string(keyS) + " cannot be divided by group size " +
                        std::to_string(m_key_quant_param.groupSize));
     }
+    if (getKVCachePrecision() == ov::element::u4) {
+        // u4 values are packed by two in a byte, the groups must not share a byte
+        CPU_NODE_ASSERT(m_key_quant_param.groupSize % 2 == 0 && m_value_quant_param.groupSize % 2 == 0,
+                        "supports u4 key/value cache with even group sizes only");
+    }
     ScaledDotProductAttentionKey key = {rtPrecision};
 
     auto builder = [&]([[maybe_unused]] const ScaledDotProductAttentionKey& key) -> std::shared_ptr<Executor> {
@@ -1530,15 +1540,15 @@ void ScaledDotProductAttention::resetBeamTablePastkv(const MemoryPtr& mem_cur_k,
             parallel_for3d(B, H, L0, [&](size_t b, size_t h, size_t m) {
                 auto idx = static_cast<size_t>(table[b]);
                 auto b_kv = static_cast<size_t>(old_beam_table_k.at<int32_t>({idx, m}));
-                memcpy(&new_pastk.at<char>({b, h, m}),
-                       &old_past_k.at<char>({b_kv, h, m}),
-                       S * old_past_k.m_element_size);
-                memcpy(&new_pastv.at<char>({b, h, m}),
-                       &old_past_v.at<char>({b_kv, h, m}),
-                       SV * old_past_v.m_element_size);
+                memcpy(new_pastk.ptr_v(b, h, m),
+                       old_past_k.ptr_v(b_kv, h, m),
+                       S * old_past_k.m_element_size / old_past_k.m_sub_byte_multiplier);
+                memcpy(new_pastv.ptr_v(b, h, m),
+                       old_past_v.ptr_v(b_kv, h, m),
+                       SV * old_past_v.m_element_size / old_past_v.m_sub_byte_multiplier);
             });
         }
-        if (kvcache_precision == ov::element::u8) {
+        if (one_of(kvcache_precision, ov::element::u8, ov::element::u4)) {
             auto& old_scale_zp_k = m_k_state->get_scale_zp();
             auto& old_scale_zp_v = m_v_state->get_scale_zp();
             PlainTensor new_scale_zp_k;
@@ -1619,7 +1629,7 @@ void ScaledDotProductAttention::resetBeamTablePastkv(const MemoryPtr& mem_cur_k,
                                                             VectorDims{},
                                                             strides);
         new_internal_mem_v->redefineDesc(mem_desc_v);
-        if (kvcache_precision == ov::element::u8) {
+        if (one_of(kvcache_precision, ov::element::u8, ov::element::u4)) {
             // past_k's shape is BHLS, internal layout LBHS
             // scale_zp's shape is LBHS, internal layout LBHS
             auto newMemDesc = std::make_shared<CpuBlockedMemoryDesc>(
@@ -1705,6 +1715,9 @@ void ScaledDotProductAttention::gatherConcatPastkv(const MemoryPtr& mem_cur_k,
         return;
     }
 
+    // the states forked from a common prefix share the KV buffers
+    m_k_state->prepare_append(L1);
+    m_v_state->prepare_append(L1);
     updateBeamTable(mem_beam_idx, L1);
     updatePastkv(mem_cur_k, mem_cur_v);
 }
@@ -1926,7 +1939,7 @@ void ScaledDotProductAttention::updatePastkv(const MemoryPtr& mem_cur_k, const M
         m_v_state->assign_internal_state(new_internal_mem_v);
         m_k_state->assign_internal_state_max_size(2 * (L0 + L1) * B * H * S);
         m_v_state->assign_internal_state_max_size(2 * (L0 + L1) * B * H * SV);
-        if (kvcache_precision == ov::element::u8) {
+        if (one_of(kvcache_precision, ov::element::u8, ov::element::u4)) {
             auto& old_scale_zp_k = m_k_state->get_scale_zp();
             auto& old_scale_zp_v = m_v_state->get_scale_zp();
             PlainTensor new_scale_zp_k;
@@ -1996,7 +2009,7 @@ void ScaledDotProductAttention::updatePastkv(const MemoryPtr& mem_cur_k, const M
         };
         internal_mem_k->redefineDesc(reset_desc(S));
         internal_mem_v->redefineDesc(reset_desc(SV));
-        if (kvcache_precision == ov::element::u8) {
+        if (one_of(kvcache_precision, ov::element::u8, ov::element::u4)) {
             auto& old_scale_zp_k = m_k_state->get_scale_zp();
             auto& old_scale_zp_v = m_v_state->get_scale_zp();
             // only dim0, dim1 need change
@@ -2049,7 +2062,7 @@ void ScaledDotProductAttention::updatePastkv(const MemoryPtr& mem_cur_k, const M
             init_v.reset(v_mem);
             init_k = init_k.permute(order);
             init_v = init_v.permute(order);
-            if (kvcache_precision == ov::element::u8) {
+            if (one_of(kvcache_precision, ov::element::u8, ov::element::u4)) {
                 auto newMemDesc = std::make_shared<CpuBlockedMemoryDesc>(
                     ov::element::f32,
                     ov::intel_cpu::Shape{static_cast<size_t>(parallel_get_max_threads()),
@@ -2074,7 +2087,7 @@ void ScaledDotProductAttention::updatePastkv(const MemoryPtr& mem_cur_k, const M
         }
     }
 
-    if (kvcache_precision == ov::element::u8) {
+    if (one_of(kvcache_precision, ov::element::u8, ov::element::u4)) {
         // past_k's shape is BHLS, internal layout LBHS
         // scale_zp's shape is LBHS, internal layout LBHS
         auto newMemDesc = std::make_shared<CpuBlockedMemoryDesc>(
@@ -2110,8 +2123,12 @@ ov::element::Type ScaledDotProductAttention::getKVCachePrecision() {
     kvcache_precision = enableKVCacheFP16 ? ov::element::f16 : rtPrecision;
     bool use_int8_kv_cache_precision =
         (keyCachePrecisionHint == ov::element::u8 && valueCachePrecisionHint == ov::element::u8);
+    bool use_int4_kv_cache_precision =
+        (keyCachePrecisionHint == ov::element::u4 && valueCachePrecisionHint == ov::element::u4);
     if (use_int8_kv_cache_precision) {
         kvcache_precision = ov::element::u8;
+    } else if (use_int4_kv_cache_precision) {
+        kvcache_precision = ov::element::u4;
     } else {
         kvcache_precision = enableKVCacheFP16 ? ov::element::f16 : rtPrecision;
     }
@@ -4,12 +4,15 @@
 
 #include "search_sorted.h"
 
+#include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
 #include <tuple>
 
+#include "common/sorted_search.h"
 #include "cpu_types.h"
 #include "graph_context.h"
 #include "memory_desc/cpu_memory_desc.h"
@@ -17,11 +20,11 @@
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/node.hpp"
+#include "openvino/core/shape.hpp"
 #include "openvino/core/type.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/core/type/element_type_traits.hpp"
 #include "openvino/op/search_sorted.hpp"
-#include "openvino/reference/search_sorted.hpp"
 #include "selective_build.h"
 #include "shape_inference/shape_inference_cpu.hpp"
 #include "utils/general_utils.h"
@@ -94,12 +97,31 @@ void SearchSorted::executeDynamicImpl(const dnnl::stream& strm) {
 
 template <typename INPUT_TYPE, typename OUTPUT_TYPE>
 void SearchSorted::executeImpl() {
-    ov::reference::search_sorted<INPUT_TYPE, OUTPUT_TYPE>(getSrcDataAtPortAs<const INPUT_TYPE>(0),
-                                                          getSrcDataAtPortAs<const INPUT_TYPE>(1),
-                                                          getDstDataAtPortAs<OUTPUT_TYPE>(0),
-                                                          ov::Shape{getSrcMemoryAtPort(0)->getStaticDims()},
-                                                          ov::Shape{getSrcMemoryAtPort(1)->getStaticDims()},
-                                                          right_mode);
+    const auto* sorted = getSrcDataAtPortAs<const INPUT_TYPE>(0);
+    const auto* values = getSrcDataAtPortAs<const INPUT_TYPE>(1);
+    auto* out = getDstDataAtPortAs<OUTPUT_TYPE>(0);
+    const auto& sortedDims = getSrcMemoryAtPort(0)->getStaticDims();
+    const auto& valuesDims = getSrcMemoryAtPort(1)->getStaticDims();
+    const size_t sortedRowSize = sortedDims.back();
+    const size_t valuesCount = ov::shape_size(valuesDims);
+
+    auto search = [&](const auto& precedes) {
+        if (sortedDims.size() == 1) {
+            // the single sequence is searched for all the values
+            SortedSearch<INPUT_TYPE>(sorted, sortedRowSize, valuesCount).findAll(values, out, valuesCount, precedes);
+        } else {
+            // the leading dims of the inputs are equal, each row of the values has its own sorted sequence
+            const size_t valuesRowSize = valuesDims.back();
+            const size_t rows = valuesRowSize == 0 ? 0 : valuesCount / valuesRowSize;
+            searchSortedRows(sorted, sortedRowSize, values, out, valuesRowSize, rows, precedes);
+        }
+    };
+
+    if (right_mode) {
+        search(std::less_equal<>());
+    } else {
+        search(std::less<>());
+    }
 }
 
 namespace {
@@ -4,13 +4,16 @@
 
 #include "segment_max.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <limits>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
+#include <vector>
 
+#include "common/segment_reduce.h"
 #include "cpu_types.h"
 #include "graph_context.h"
 #include "memory_desc/cpu_memory_desc.h"
@@ -18,13 +21,14 @@
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/node.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/shape.hpp"
 #include "openvino/core/type.hpp"
 #include "openvino/core/type/bfloat16.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/core/type/float16.hpp"
 #include "openvino/op/segment_max.hpp"
 #include "openvino/op/util/attr_types.hpp"
-#include "openvino/reference/segment_max.hpp"
 #include "selective_build.h"
 #include "shape_inference/shape_inference_cpu.hpp"
 
@@ -134,15 +138,57 @@ bool SegmentMax::needShapeInfer() const {
 
 template <class T>
 void SegmentMax::executeImpl() {
-    const auto& data_shape = getSrcMemoryAtPort(0)->getStaticDims();
-    const auto& output_shape = getDstMemoryAtPort(0)->getShape().getStaticDims();
-    const auto empty_segment_value = fillMode == ov::op::FillMode::ZERO ? T(0) : std::numeric_limits<T>::lowest();
-    ov::reference::segment_max(getSrcDataAtPortAs<const T>(0),
-                               data_shape,
-                               getSrcDataAtPortAs<const int32_t>(1),
-                               getDstDataAtPortAs<T>(0),
-                               output_shape,
-                               empty_segment_value);
+    const auto& dataShape = getSrcMemoryAtPort(0)->getStaticDims();
+    const auto& outputShape = getDstMemoryAtPort(0)->getShape().getStaticDims();
+    const auto* data = getSrcDataAtPortAs<const T>(0);
+    const auto* segmentIds = getSrcDataAtPortAs<const int32_t>(1);
+    auto* out = getDstDataAtPortAs<T>(0);
+    const auto emptySegmentValue = fillMode == ov::op::FillMode::ZERO ? T(0) : std::numeric_limits<T>::lowest();
+    const size_t numSegments = outputShape[0];
+    const size_t innerSize = ov::shape_size(dataShape.begin() + 1, dataShape.end());
+
+    // the data rows of each segment grouped with a counting sort, so the segment ids do not have to be sorted
+    std::vector<size_t> rowBegins(numSegments + 1, 0);
+    for (size_t row = 0; row < dataShape[0]; row++) {
+        const auto segment = static_cast<size_t>(segmentIds[row]);
+        if (segment < numSegments) {
+            rowBegins[segment + 1]++;
+        }
+    }
+    SegmentReduce segments(numSegments);
+    for (size_t segment = 0; segment < numSegments; segment++) {
+        segments.setRows(segment, rowBegins[segment + 1]);
+        rowBegins[segment + 1] += rowBegins[segment];
+    }
+    segments.computeWork();
+    std::vector<size_t> rows(rowBegins.back());
+    std::vector<size_t> positions(rowBegins.begin(), rowBegins.end() - 1);
+    for (size_t row = 0; row < dataShape[0]; row++) {
+        const auto segment = static_cast<size_t>(segmentIds[row]);
+        if (segment < numSegments) {
+            rows[positions[segment]++] = row;
+        }
+    }
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0;
+        size_t end = 0;
+        segments.split(nthr, ithr, start, end);
+        for (size_t segment = start; segment < end; segment++) {
+            T* dst = out + segment * innerSize;
+            if (rowBegins[segment] == rowBegins[segment + 1]) {
+                std::fill(dst, dst + innerSize, emptySegmentValue);
+                continue;
+            }
+            std::fill(dst, dst + innerSize, std::numeric_limits<T>::lowest());
+            for (size_t i = rowBegins[segment]; i < rowBegins[segment + 1]; i++) {
+                if (i + 1 < rowBegins[segment + 1]) {
+                    prefetchRow(data + rows[i + 1] * innerSize, innerSize);
+                }
+                maxRow(dst, data + rows[i] * innerSize, innerSize);
+            }
+        }
+    });
 }
 
 namespace {
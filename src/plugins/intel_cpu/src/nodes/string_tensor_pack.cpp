@@ -9,6 +9,7 @@
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
 
+#include "common/packed_strings.h"
 #include "cpu_types.h"
 #include "graph_context.h"
 #include "memory_desc/cpu_memory_desc.h"
@@ -20,7 +21,6 @@
 #include "openvino/core/type.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/op/string_tensor_pack.hpp"
-#include "openvino/reference/string_tensor_pack.hpp"
 #include "selective_build.h"
 #include "shape_inference/shape_inference_cpu.hpp"
 
@@ -77,11 +77,11 @@ void StringTensorPack::executeDynamicImpl(const dnnl::stream& strm) {
 template <class T_idx>
 void StringTensorPack::executeImpl() {
     const auto& data_shape = getSrcMemoryAtPort(0)->getStaticDims();
-    ov::reference::string_tensor_pack(getSrcDataAtPortAs<const T_idx>(0),
-                                      getSrcDataAtPortAs<const T_idx>(1),
-                                      getSrcDataAtPortAs<const uint8_t>(2),
-                                      getDstDataAtPortAs<std::string>(0),
-                                      ov::shape_size(data_shape));
+    PackedStrings::pack(getSrcDataAtPortAs<const T_idx>(0),
+                        getSrcDataAtPortAs<const T_idx>(1),
+                        getSrcDataAtPortAs<const uint8_t>(2),
+                        getDstDataAtPortAs<std::string>(0),
+                        ov::shape_size(data_shape));
 }
 
 namespace {
@@ -12,6 +12,7 @@
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
 
+#include "common/packed_strings.h"
 #include "cpu_types.h"
 #include "graph_context.h"
 #include "memory_desc/cpu_memory_desc.h"
@@ -23,7 +24,6 @@
 #include "openvino/core/type.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/op/string_tensor_unpack.hpp"
-#include "openvino/reference/string_tensor_unpack.hpp"
 #include "shape_inference/shape_inference_internal_dyn.hpp"
 
 namespace ov::intel_cpu::node {
@@ -76,20 +76,17 @@ void StringTensorUnpack::executeDynamicImpl(const dnnl::stream& strm) {
     const auto& srcDataDims = srcMemory->getStaticDims();
     const auto& srcData = srcMemory->getDataAs<std::string>();
     Dim stringCount = std::accumulate(srcDataDims.begin(), srcDataDims.end(), 1, std::multiplies<>());
-    size_t totalCharLength = 0;
-    for (Dim i = 0; i < stringCount; ++i) {
-        totalCharLength += srcData[i].length();
-    }
+    const size_t totalCharLength = PackedStrings::length(srcData, stringCount);
     redefineOutputMemory({srcDataDims, srcDataDims, {totalCharLength}});
     execute(strm);
 }
 
 void StringTensorUnpack::execute([[maybe_unused]] const dnnl::stream& strm) {
     const auto stringCount = ov::shape_size(getSrcMemoryAtPort(0)->getStaticDims());
-    ov::reference::string_tensor_unpack(getSrcDataAtPortAs<const std::string>(0),
-                                        getDstDataAtPortAs<int32_t>(0),
-                                        getDstDataAtPortAs<int32_t>(1),
-                                        getDstDataAtPortAs<uint8_t>(2),
-                                        stringCount);
+    PackedStrings::unpack(getSrcDataAtPortAs<const std::string>(0),
+                          getDstDataAtPortAs<int32_t>(0),
+                          getDstDataAtPortAs<int32_t>(1),
+                          getDstDataAtPortAs<uint8_t>(2),
+                          stringCount);
 }
 }  // namespace ov::intel_cpu::node
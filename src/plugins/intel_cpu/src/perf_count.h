@@ -5,9 +5,12 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <ratio>
 
+#include "hw_perf_counters.hpp"
+
 namespace ov::intel_cpu {
 
 class PerfCount {
@@ -17,6 +20,12 @@ class PerfCount {
     std::chrono::high_resolution_clock::time_point _start;
     std::chrono::high_resolution_clock::time_point _finish;
 
+    // hardware counters, only collected if the counters are passed to PerfHelper
+    uint32_t hw_num = 0;
+    HwPerfCounters::Sample hw_total{};
+    HwPerfCounters::Sample hw_start{};
+    HwPerfCounters::Sample hw_last{};
+
 public:
     PerfCount() = default;
 
@@ -31,15 +40,38 @@ public:
         return num;
     }
 
+    [[nodiscard]] bool hasHwCounters() const {
+        return hw_num != 0;
+    }
+    [[nodiscard]] uint64_t hwAvg(HwPerfCounters::Event event) const {
+        return (hw_num == 0) ? 0 : hw_total[event] / hw_num;
+    }
+    // of the last iteration
+    [[nodiscard]] uint64_t hwLast(HwPerfCounters::Event event) const {
+        return hw_last[event];
+    }
+
 private:
-    void start_itr() {
+    void start_itr(const HwPerfCounters* hw) {
+        if (hw) {
+            hw_start = hw->read();
+        }
         _start = std::chrono::high_resolution_clock::now();
     }
 
-    void finish_itr() {
+    void finish_itr(const HwPerfCounters* hw) {
         _finish = std::chrono::high_resolution_clock::now();
         total_duration += std::chrono::duration_cast<std::chrono::microseconds>(_finish - _start).count();
         num++;
+        if (hw) {
+            const auto hw_finish = hw->read();
+            for (size_t i = 0; i < hw_finish.size(); i++) {
+                // the sample is empty if the counters of the thread cannot be read
+                hw_last[i] = hw_finish[i] > hw_start[i] ? hw_finish[i] - hw_start[i] : 0;
+                hw_total[i] += hw_last[i];
+            }
+            hw_num++;
+        }
     }
 
     friend class PerfHelper;
@@ -47,18 +79,21 @@ private:
 
 class PerfHelper {
     PerfCount& counter;
+    const HwPerfCounters* hw;
 
 public:
-    explicit PerfHelper(PerfCount& count) : counter(count) {
-        counter.start_itr();
+    explicit PerfHelper(PerfCount& count, const HwPerfCounters* hw_counters = nullptr)
+        : counter(count),
+          hw(hw_counters) {
+        counter.start_itr(hw);
     }
 
     ~PerfHelper() {
-        counter.finish_itr();
+        counter.finish_itr(hw);
     }
 };
 
 }  // namespace ov::intel_cpu
 
-#define GET_PERF(_node)    std::unique_ptr<PerfHelper>(new PerfHelper((_node)->PerfCounter()))
-#define PERF(_node, _need) auto pc = (_need) ? GET_PERF(_node) : nullptr;
+#define GET_PERF(_node, _hw)    std::unique_ptr<PerfHelper>(new PerfHelper((_node)->PerfCounter(), _hw))
+#define PERF(_node, _need, _hw) auto pc = (_need) ? GET_PERF(_node, _hw) : nullptr;
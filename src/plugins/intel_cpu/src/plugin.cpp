@@ -207,6 +207,9 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
     Config conf = engConfig;
     conf.applyRtInfo(cloned_model);
     conf.readProperties(config, modelType);
+    if (conf.enableKernelWarmup && conf.kernelWarmupCacheDir.empty()) {
+        conf.kernelWarmupCacheDir = get_core()->get_property(get_device_name(), ov::cache_dir);
+    }
 
     Transformations transformations(cloned_model, conf);
 
@@ -256,7 +259,9 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
             denormals_as_zero(false);
         }
     }
-    return std::make_shared<CompiledModel>(cloned_model, shared_from_this(), conf, false);
+    auto compiled_model = std::make_shared<CompiledModel>(cloned_model, shared_from_this(), conf, false);
+    compiled_model->warm_up_kernels();
+    return compiled_model;
 }
 
 void Plugin::set_property(const ov::AnyMap& config) {
@@ -600,10 +605,19 @@ std::shared_ptr<ov::ICompiledModel> Plugin::import_model(std::istream& model_str
         _config.erase(it);
     }
     conf.readProperties(_config, modelType);
+    if (conf.enableKernelWarmup && conf.kernelWarmupCacheDir.empty()) {
+        conf.kernelWarmupCacheDir = get_core()->get_property(get_device_name(), ov::cache_dir);
+    }
 
     // import config props from caching model
     calculate_streams(conf, model, true);
-    auto compiled_model = std::make_shared<CompiledModel>(model, shared_from_this(), conf, loaded_from_cache);
+    auto compiled_model = std::make_shared<CompiledModel>(model,
+                                                          shared_from_this(),
+                                                          conf,
+                                                          loaded_from_cache,
+                                                          nullptr,
+                                                          deserializer.get_memory_plans());
+    compiled_model->warm_up_kernels();
     return compiled_model;
 }
 }  // namespace ov::intel_cpu
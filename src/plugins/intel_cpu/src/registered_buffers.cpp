@@ -0,0 +1,234 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "registered_buffers.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "cpu_types.h"
+#include "edge.h"
+#include "graph.h"
+#include "node.h"
+#include "openvino/core/any.hpp"
+#include "openvino/core/except.hpp"
+#include "openvino/core/node_output.hpp"
+#include "openvino/core/partial_shape.hpp"
+#include "openvino/runtime/itensor.hpp"
+#include "openvino/runtime/tensor.hpp"
+
+namespace ov::intel_cpu {
+
+bool canShareInputMemory(const Graph& graph, size_t index) {
+    auto inputNode = graph.getInputNodeByIndex(index);
+    OPENVINO_ASSERT(inputNode, "Cannot find input tensor with index: ", index);
+    // Perform checks that the user's memory will not be modified
+    for (const auto& childEdge : inputNode->getChildEdges()) {
+        auto ce = childEdge.lock();
+        if (!ce) {
+            OPENVINO_THROW("Node ", inputNode->getName(), " contains empty child edge");
+        }
+
+        const auto& child = ce->getChild();
+
+        if (child->isConstant()) {
+            return false;
+        }
+
+        // the input memory should be referenced by the children, otherwise it should be written to a
+        // specific location
+        if (ce->inPlace(Edge::LOOK_DOWN)) {
+            return false;
+        }
+
+        if (ce->modifiedInPlace()) {
+            return false;
+        }
+
+        if (child->getType() == Type::Concatenation && child->isInPlace()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool canShareOutputMemory(const Graph& graph, size_t index) {
+    auto output = graph.getOutputNodeByIndex(index);
+    OPENVINO_ASSERT(output, "Cannot find output tensor with index: ", index);
+    auto parentEdge = output->getParentEdgeAt(0);
+
+    // Cannot be in-place after concat because concat is using different ptrs without offsets
+    auto parent = parentEdge->getParent();
+    NodePtr previousParent;
+    auto parent_port = parentEdge->getInputNum();
+    do {
+        previousParent = parent;
+        if (parent->getChildEdgesAtPort(parent_port).size() != 1 || parent->isConstant()) {
+            return false;
+        }
+        if (parent->getChildEdgeAt(parent_port)->inPlace(Edge::LOOK_UP)) {
+            return false;
+        }
+
+        const auto& parentEdges = parent->getParentEdges();
+        for (const auto& edge : parentEdges) {
+            auto e = edge.lock();
+            if (!e) {
+                OPENVINO_THROW("Node ", parent->getName(), " contains empty parent edge");
+            }
+
+            if (parent_port == parent->inPlaceInputPort(e->getOutputNum())) {
+                parent = e->getParent();
+                parent_port = e->getInputNum();
+                break;
+            }
+        }
+    } while (previousParent != parent);
+    return true;
+}
+
+namespace {
+
+// the buffers are validated against the ports of the compiled model, since the graphs of the streams are created lazily
+void validateBuffer(const ov::Tensor& buffer, const ov::Output<const ov::Node>& port, bool isInput) {
+    const auto& name = port.get_any_name();
+    OPENVINO_ASSERT(buffer, "Empty buffer is registered for the port ", name);
+    OPENVINO_ASSERT(buffer.get_element_type() == port.get_element_type(),
+                    "The buffer precision ",
+                    buffer.get_element_type(),
+                    " does not match the precision ",
+                    port.get_element_type(),
+                    " of the port ",
+                    name);
+    OPENVINO_ASSERT(port.get_partial_shape().compatible(buffer.get_shape()),
+                    "The buffer shape ",
+                    buffer.get_shape(),
+                    " is not compatible with the shape ",
+                    port.get_partial_shape(),
+                    " of the port ",
+                    name);
+    OPENVINO_ASSERT(isInput || port.get_partial_shape().is_static(),
+                    "The buffers cannot be registered for the dynamic output ",
+                    name);
+    // the inputs and the outputs of the graph are always in the planar layout
+    OPENVINO_ASSERT(buffer.is_continuous(), "The buffer of the port ", name, " is not dense");
+    OPENVINO_ASSERT(reinterpret_cast<uintptr_t>(buffer.data()) % RegisteredBuffers::alignment == 0,
+                    "The buffer of the port ",
+                    name,
+                    " is not aligned to ",
+                    RegisteredBuffers::alignment,
+                    " bytes");
+}
+
+}  // namespace
+
+template <typename F>
+void RegisteredBuffers::forEachBuffer(const ov::AnyMap& buffers,
+                                      const std::vector<ov::Output<const ov::Node>>& inputs,
+                                      const std::vector<ov::Output<const ov::Node>>& outputs,
+                                      const F& f) {
+    auto findPort = [](const std::vector<ov::Output<const ov::Node>>& ports, const std::string& name) {
+        for (size_t i = 0; i < ports.size(); i++) {
+            if (ports[i].get_names().count(name) != 0) {
+                return i;
+            }
+        }
+        return ports.size();
+    };
+
+    for (const auto& item : buffers) {
+        const auto& name = item.first;
+        bool isInput = true;
+        size_t index = findPort(inputs, name);
+        if (index == inputs.size()) {
+            isInput = false;
+            index = findPort(outputs, name);
+            OPENVINO_ASSERT(index != outputs.size(), "The compiled model does not have the port ", name);
+        }
+        const auto& port = isInput ? inputs[index] : outputs[index];
+        const auto portBuffers = item.second.is<ov::Tensor>() ? std::vector<ov::Tensor>{item.second.as<ov::Tensor>()}
+                                                              : item.second.as<std::vector<ov::Tensor>>();
+        for (const auto& buffer : portBuffers) {
+            f(buffer, port, isInput, index);
+        }
+    }
+}
+
+void RegisteredBuffers::add(const ov::AnyMap& buffers,
+                            const std::vector<ov::Output<const ov::Node>>& inputs,
+                            const std::vector<ov::Output<const ov::Node>>& outputs) {
+    std::vector<std::pair<const void*, Buffer>> validated;
+    forEachBuffer(buffers,
+                  inputs,
+                  outputs,
+                  [&](const ov::Tensor& buffer, const ov::Output<const ov::Node>& port, bool isInput, size_t index) {
+                      validateBuffer(buffer, port, isInput);
+                      validated.emplace_back(buffer.data(),
+                                             Buffer{isInput, index, buffer.get_element_type(), buffer.get_shape()});
+                  });
+
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    for (auto& item : validated) {
+        m_buffers.emplace(item.first, std::move(item.second));
+    }
+}
+
+void RegisteredBuffers::remove(const ov::AnyMap& buffers,
+                               const std::vector<ov::Output<const ov::Node>>& inputs,
+                               const std::vector<ov::Output<const ov::Node>>& outputs) {
+    std::vector<std::pair<const void*, Buffer>> removed;
+    forEachBuffer(buffers,
+                  inputs,
+                  outputs,
+                  [&](const ov::Tensor& buffer, const ov::Output<const ov::Node>&, bool isInput, size_t index) {
+                      OPENVINO_ASSERT(buffer, "Empty buffer is unregistered");
+                      removed.emplace_back(buffer.data(),
+                                           Buffer{isInput, index, buffer.get_element_type(), buffer.get_shape()});
+                  });
+
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    for (const auto& [data, buffer] : removed) {
+        auto range = m_buffers.equal_range(data);
+        for (auto it = range.first; it != range.second; ++it) {
+            const auto& registered = it->second;
+            if (registered.isInput == buffer.isInput && registered.index == buffer.index &&
+                registered.precision == buffer.precision && registered.shape == buffer.shape) {
+                m_buffers.erase(it);
+                break;
+            }
+        }
+    }
+}
+
+bool RegisteredBuffers::contains(const ov::ITensor& tensor, bool isInput, size_t index) const {
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    auto range = m_buffers.equal_range(tensor.data());
+    for (auto it = range.first; it != range.second; ++it) {
+        const auto& buffer = it->second;
+        // a strided view of the same memory must be validated again
+        if (buffer.isInput == isInput && buffer.index == index && buffer.precision == tensor.get_element_type() &&
+            buffer.shape == tensor.get_shape() && tensor.is_continuous()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool RegisteredBuffers::empty() const {
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    return m_buffers.empty();
+}
+
+ov::AnyMap RegisteredBuffers::fallbacks() const {
+    return {{"INPUTS", m_inputFallbacks.load(std::memory_order_relaxed)},
+            {"OUTPUTS", m_outputFallbacks.load(std::memory_order_relaxed)}};
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,90 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "graph.h"
+#include "openvino/core/any.hpp"
+#include "openvino/core/node_output.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/runtime/itensor.hpp"
+#include "openvino/runtime/tensor.hpp"
+
+namespace ov::intel_cpu {
+
+// whether the graph can read the input directly from the user memory (the memory is not modified by the graph)
+bool canShareInputMemory(const Graph& graph, size_t index);
+
+// whether the producer of the output can write directly to the user memory
+bool canShareOutputMemory(const Graph& graph, size_t index);
+
+/**
+ * @brief Host buffers the application registered for the inputs and the outputs of a compiled model. A buffer is
+ * validated once at the registration against the port of the compiled model (precision, shape, dense layout and
+ * alignment), so the infer requests bind it to the graph without a copy and without repeating the layout checks. The
+ * pool also counts the tensors which could not be bound without a copy.
+ */
+class RegisteredBuffers {
+public:
+    // the data of the registered buffers is expected to be aligned as the memory allocated by the plugin
+    static constexpr size_t alignment = 64;
+
+    /**
+     * @brief Validates and registers the buffers of the ports, the ports are looked up by the tensor names. A port is
+     * mapped to an ov::Tensor or to a std::vector<ov::Tensor>.
+     * Throws if any of the buffers cannot be bound without a copy, nothing is registered in this case.
+     */
+    void add(const ov::AnyMap& buffers,
+             const std::vector<ov::Output<const ov::Node>>& inputs,
+             const std::vector<ov::Output<const ov::Node>>& outputs);
+
+    /**
+     * @brief Unregisters the buffers of the ports, the map has the same format as in add(). The buffers which are
+     * already set to the infer requests stay bound until they are replaced.
+     */
+    void remove(const ov::AnyMap& buffers,
+                const std::vector<ov::Output<const ov::Node>>& inputs,
+                const std::vector<ov::Output<const ov::Node>>& outputs);
+
+    // whether the tensor is one of the buffers registered for the port
+    [[nodiscard]] bool contains(const ov::ITensor& tensor, bool isInput, size_t index) const;
+
+    [[nodiscard]] bool empty() const;
+
+    void countFallback(bool isInput) {
+        (isInput ? m_inputFallbacks : m_outputFallbacks).fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // the number of the "INPUTS" and "OUTPUTS" tensors bound with a copy
+    [[nodiscard]] ov::AnyMap fallbacks() const;
+
+private:
+    // calls f(buffer, port, isInput, index) for each buffer of the map
+    template <typename F>
+    static void forEachBuffer(const ov::AnyMap& buffers,
+                              const std::vector<ov::Output<const ov::Node>>& inputs,
+                              const std::vector<ov::Output<const ov::Node>>& outputs,
+                              const F& f);
+
+    struct Buffer {
+        bool isInput;
+        size_t index;
+        ov::element::Type precision;
+        ov::Shape shape;
+    };
+
+    std::unordered_multimap<const void*, Buffer> m_buffers;
+    mutable std::shared_mutex m_mutex;
+    std::atomic<uint64_t> m_inputFallbacks{0};
+    std::atomic<uint64_t> m_outputFallbacks{0};
+};
+
+}  // namespace ov::intel_cpu
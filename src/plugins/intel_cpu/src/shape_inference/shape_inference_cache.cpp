@@ -0,0 +1,77 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shape_inference_cache.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "cpu_types.h"
+#include "hash_builder.hpp"
+#include "openvino/core/coordinate_diff.hpp"
+#include "openvino/core/except.hpp"
+#include "shape_inference/shape_inference_status.hpp"
+#include "shape_inference_cpu.hpp"
+
+namespace ov::intel_cpu {
+
+ShapeInferWithCache::ShapeInferWithCache(ShapeInferPtr shapeInfer, size_t capacity)
+    : m_shapeInfer(std::move(shapeInfer)),
+      m_cache(capacity) {
+    OPENVINO_ASSERT(m_shapeInfer, "ShapeInferWithCache: the wrapped shape inference is null");
+    OPENVINO_ASSERT(m_shapeInfer->get_port_mask() == EMPTY_PORT_MASK,
+                    "ShapeInferWithCache: the data dependent shape inference can not be cached");
+}
+
+size_t ShapeInferWithCache::Key::hash() const {
+    return hash::combine(0, inputShapes);
+}
+
+IShapeInfer::Result ShapeInferWithCache::infer(
+    const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes,
+    const std::unordered_map<size_t, MemoryPtr>& data_dependency) {
+    // the key storage is reused to avoid the allocations on each call
+    m_lastKey.inputShapes.resize(input_shapes.size());
+    for (size_t i = 0; i < input_shapes.size(); ++i) {
+        m_lastKey.inputShapes[i] = input_shapes[i].get();
+    }
+
+    auto outputShapes = m_cache.get(m_lastKey);
+    if (!outputShapes.empty()) {
+        return {std::move(outputShapes), ShapeInferStatus::success};
+    }
+
+    auto result = m_shapeInfer->infer(input_shapes, data_dependency);
+    m_inferredKey = m_lastKey;
+    if (result.status == ShapeInferStatus::success && !result.dims.empty()) {
+        m_cache.put(m_lastKey, result.dims);
+    }
+    return result;
+}
+
+void ShapeInferWithCache::syncPaddings() {
+    if (m_inferredKey == m_lastKey) {
+        return;
+    }
+    std::vector<std::reference_wrapper<const VectorDims>> inputShapes(m_lastKey.inputShapes.begin(),
+                                                                      m_lastKey.inputShapes.end());
+    m_shapeInfer->infer(inputShapes, {});
+    m_inferredKey = m_lastKey;
+}
+
+const ov::CoordinateDiff& ShapeInferWithCache::get_pads_begin() {
+    syncPaddings();
+    return m_shapeInfer->get_pads_begin();
+}
+
+const ov::CoordinateDiff& ShapeInferWithCache::get_pads_end() {
+    syncPaddings();
+    return m_shapeInfer->get_pads_end();
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include "cache/lru_cache.h"
+#include "cpu_memory.h"
+#include "cpu_types.h"
+#include "openvino/core/coordinate_diff.hpp"
+#include "shape_inference_cpu.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * Shape inference decorator memoizing the output shapes by the input shapes.
+ * Dynamic models often switch between a few shape sets (e.g. the first and the next tokens of LLM, or the different
+ * batch sizes), the cache allows to skip the shape inference computations for the sets which were already seen.
+ * Only the shape inference objects which do not depend on the input data (EMPTY_PORT_MASK) can be wrapped.
+ */
+class ShapeInferWithCache final : public IShapeInfer {
+public:
+    static constexpr size_t defaultCapacity = 16;
+
+    explicit ShapeInferWithCache(ShapeInferPtr shapeInfer, size_t capacity = defaultCapacity);
+
+    Result infer(const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes,
+                 const std::unordered_map<size_t, MemoryPtr>& data_dependency) override;
+
+    const ov::CoordinateDiff& get_pads_begin() override;
+    const ov::CoordinateDiff& get_pads_end() override;
+
+    [[nodiscard]] port_mask_t get_port_mask() const override {
+        return m_shapeInfer->get_port_mask();
+    }
+
+private:
+    struct Key {
+        std::vector<VectorDims> inputShapes;
+
+        [[nodiscard]] size_t hash() const;
+        bool operator==(const Key& rhs) const {
+            return inputShapes == rhs.inputShapes;
+        }
+    };
+
+    // the paddings are the by-product of the wrapped shape inference, so it is rerun if the last shapes were cached
+    void syncPaddings();
+
+    ShapeInferPtr m_shapeInfer;
+    LruCache<Key, std::vector<VectorDims>> m_cache;
+    Key m_lastKey;      // the input shapes of the last infer() call
+    Key m_inferredKey;  // the input shapes of the last call of the wrapped shape inference
+};
+
+}  // namespace ov::intel_cpu
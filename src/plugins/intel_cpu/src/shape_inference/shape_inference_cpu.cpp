@@ -9,7 +9,13 @@
 
 #include "openvino/core/coordinate_diff.hpp"
 #include "openvino/core/node.hpp"
+#include "openvino/core/type.hpp"
+#include "openvino/op/util/binary_elementwise_arithmetic.hpp"
+#include "openvino/op/util/binary_elementwise_comparison.hpp"
+#include "openvino/op/util/binary_elementwise_logical.hpp"
+#include "openvino/op/util/unary_elementwise_arithmetic.hpp"
 #include "shape_inference/shape_inference.hpp"
+#include "shape_inference/shape_inference_cache.hpp"
 
 namespace ov::intel_cpu {
 NgraphShapeInferFactory::NgraphShapeInferFactory(std::shared_ptr<ov::Node> op) : m_op(std::move(op)) {}
@@ -18,6 +24,19 @@ ShapeInferPtr NgraphShapeInferFactory::makeShapeInfer() const {
     return make_shape_inference(m_op);
 }
 
+ShapeInferPtr NgraphShapeInferFactory::makeCachedShapeInfer() const {
+    ShapeInferPtr shapeInfer = makeShapeInfer();
+    // the element-wise shape inference is as cheap as the cache lookup
+    const bool isElementwise = ov::is_type_any_of<op::util::UnaryElementwiseArithmetic,
+                                                  op::util::BinaryElementwiseArithmetic,
+                                                  op::util::BinaryElementwiseComparison,
+                                                  op::util::BinaryElementwiseLogical>(m_op);
+    if (!isElementwise && shapeInfer->get_port_mask() == EMPTY_PORT_MASK) {
+        return std::make_shared<ShapeInferWithCache>(shapeInfer);
+    }
+    return shapeInfer;
+}
+
 const ov::CoordinateDiff ShapeInferEmptyPads::m_emptyVec = {};
 
 }  // namespace ov::intel_cpu
@@ -93,6 +93,13 @@ class ShapeInferFactory {
 public:
     virtual ~ShapeInferFactory() = default;
     [[nodiscard]] virtual ShapeInferPtr makeShapeInfer() const = 0;
+    /**
+     * @brief Creates the shape inference memoizing the output shapes by the input shapes, where it is profitable
+     * (see ov::intel_cpu::cpu_shape_infer_cache)
+     */
+    [[nodiscard]] virtual ShapeInferPtr makeCachedShapeInfer() const {
+        return makeShapeInfer();
+    }
 };
 
 /**
@@ -109,6 +116,7 @@ public:
     NgraphShapeInferFactory(std::shared_ptr<ov::Node> op);
 
     [[nodiscard]] ShapeInferPtr makeShapeInfer() const override;
+    [[nodiscard]] ShapeInferPtr makeCachedShapeInfer() const override;
 
 private:
     std::shared_ptr<ov::Node> m_op;
@@ -21,6 +21,7 @@
 #include <vector>
 
 #include "cpu_types.h"
+#include "hw_perf_counters.hpp"
 #include "memory_control.hpp"
 #include "nodes/node_config.h"
 #include "openvino/core/attribute_adapter.hpp"
@@ -394,6 +395,12 @@ std::ostream& operator<<(std::ostream& os, const Node& c_node) {
     if (node.PerfCounter().count()) {
         os << " latency:" << node.PerfCounter().avg() << "(us) x" << node.PerfCounter().count();
     }
+    if (node.PerfCounter().hasHwCounters()) {
+        for (uint8_t i = 0; i < HwPerfCounters::EVENTS_NUM; i++) {
+            const auto event = static_cast<HwPerfCounters::Event>(i);
+            os << " " << HwPerfCounters::name(event) << ":" << node.PerfCounter().hwAvg(event);
+        }
+    }
 
     for (const auto& fn : node.getFusedWith()) {
         os << "\n\t  FusedWith: " << *fn;
@@ -720,6 +727,8 @@ std::ostream& operator<<(std::ostream& os, const MemoryStatisticsRecord& record)
     os << "Total size: " << record.total_size << " bytes\n";
     os << "Optimal total size: " << record.optimal_total_size << " bytes\n";
     os << "Max region size: " << record.max_region_size << " bytes\n";
+    os << "Page size: " << record.page_size << " bytes\n";
+    os << "NUMA node: " << record.numa_node << "\n";
     return os;
 }
 
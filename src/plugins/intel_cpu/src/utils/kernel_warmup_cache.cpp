@@ -0,0 +1,176 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "kernel_warmup_cache.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <ios>
+#include <mutex>
+#include <oneapi/dnnl/dnnl.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "config.h"
+#include "hash_builder.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/core/node_output.hpp"
+#include "openvino/core/shape.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/core/version.hpp"
+#include "openvino/runtime/iinfer_request.hpp"
+#include "openvino/runtime/ivariable_state.hpp"
+#include "openvino/runtime/make_tensor.hpp"
+#include "openvino/runtime/tensor.hpp"
+#include "openvino/util/file_util.hpp"
+#include "utils/debug_capabilities.h"
+
+namespace ov::intel_cpu {
+
+namespace {
+
+size_t computeModelKey(const ov::Model& model, const Config& config) {
+    auto builder = hash::Builder(0)
+                       .combine(std::string(ov::get_openvino_version().buildNumber))
+                       .combine(static_cast<int>(dnnl::get_effective_cpu_isa()))
+                       .combine(config.inferencePrecision.to_string());
+
+    // the topological order of the imported model may differ for the independent branches, so the per-op hashes are
+    // accumulated in an order agnostic way
+    size_t opsHash = 0;
+    for (const auto& op : model.get_ordered_ops()) {
+        auto opBuilder = hash::Builder(0)
+                             .combine(std::string(op->get_type_info().name))
+                             .combine(op->get_friendly_name());
+        for (const auto& output : op->outputs()) {
+            opBuilder.combine(output.get_partial_shape().to_string());
+        }
+        opsHash += opBuilder.generate();
+    }
+
+    return builder.combine(opsHash).generate();
+}
+
+bool parseShapes(const std::string& line, size_t numInputs, KernelWarmupCache::InputShapes& shapes) {
+    shapes.clear();
+    size_t begin = 0;
+    while (true) {
+        const auto end = line.find(';', begin);
+        const auto shapeStr = line.substr(begin, end == std::string::npos ? std::string::npos : end - begin);
+        ov::Shape shape;
+        std::istringstream dims(shapeStr);
+        std::string dim;
+        while (std::getline(dims, dim, ',')) {
+            if (dim.empty() || dim.find_first_not_of("0123456789") != std::string::npos) {
+                return false;
+            }
+            shape.push_back(std::stoull(dim));
+        }
+        shapes.push_back(std::move(shape));
+        if (end == std::string::npos) {
+            break;
+        }
+        begin = end + 1;
+    }
+    return shapes.size() == numInputs;
+}
+
+}  // namespace
+
+KernelWarmupCache::KernelWarmupCache(const std::string& cacheDir, const ov::Model& model, const Config& config)
+    : m_numInputs(model.inputs().size()) {
+    std::stringstream fileName;
+    fileName << std::hex << computeModelKey(model, config) << ".cpu_warmup";
+    m_path = ov::util::make_path(cacheDir, fileName.str());
+
+    for (const auto& shapes : load()) {
+        m_records.insert(toString(shapes));
+    }
+    m_full = m_records.size() >= maxRecords;
+}
+
+std::vector<KernelWarmupCache::InputShapes> KernelWarmupCache::load() const {
+    std::vector<InputShapes> records;
+    std::ifstream file(m_path);
+    std::string line;
+    InputShapes shapes;
+    while (records.size() < maxRecords && std::getline(file, line)) {
+        if (parseShapes(line, m_numInputs, shapes)) {
+            records.push_back(shapes);
+        }
+    }
+    return records;
+}
+
+void KernelWarmupCache::record(const InputShapes& shapes) {
+    if (isFull()) {
+        return;
+    }
+
+    auto line = toString(shapes);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_records.size() >= maxRecords || !m_records.insert(line).second) {
+        return;
+    }
+    // the record is appended immediately, so the shapes survive an abnormal process termination
+    std::ofstream file(m_path, std::ios_base::app);
+    if (file) {
+        file << line << '\n';
+    }
+    m_full = m_records.size() >= maxRecords;
+}
+
+void KernelWarmupCache::replay(const std::vector<InputShapes>& records,
+                               const std::vector<ov::Output<const ov::Node>>& inputs,
+                               ov::IInferRequest& request) const {
+    if (records.empty() || inputs.size() != m_numInputs) {
+        return;
+    }
+    for (const auto& input : inputs) {
+        if (input.get_element_type().is_dynamic()) {
+            return;
+        }
+    }
+
+    try {
+        for (size_t r = 0; r < std::min(records.size(), maxReplays); ++r) {
+            const auto& shapes = records[r];
+            for (size_t i = 0; i < inputs.size(); ++i) {
+                ov::Tensor tensor(inputs[i].get_element_type(), shapes[i]);
+                if (inputs[i].get_element_type() != ov::element::string && tensor.get_byte_size() != 0) {
+                    std::memset(tensor.data(), 0, tensor.get_byte_size());
+                }
+                request.set_tensor(inputs[i], ov::get_tensor_impl(tensor));
+            }
+            request.infer();
+            for (const auto& state : request.query_state()) {
+                state->reset();
+            }
+        }
+    } catch (const std::exception& e) {
+        DEBUG_LOG("Kernel warm-up from ", m_path, " is stopped: ", e.what());
+    }
+}
+
+std::string KernelWarmupCache::toString(const InputShapes& shapes) {
+    std::string line;
+    for (size_t i = 0; i < shapes.size(); ++i) {
+        if (i != 0) {
+            line += ';';
+        }
+        for (size_t j = 0; j < shapes[i].size(); ++j) {
+            if (j != 0) {
+                line += ',';
+            }
+            line += std::to_string(shapes[i][j]);
+        }
+    }
+    return line;
+}
+
+}  // namespace ov::intel_cpu
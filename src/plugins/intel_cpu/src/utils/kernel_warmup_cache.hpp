@@ -0,0 +1,79 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "config.h"
+#include "openvino/core/model.hpp"
+#include "openvino/core/shape.hpp"
+#include "openvino/core/node_output.hpp"
+#include "openvino/runtime/iinfer_request.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Persistent storage of the input shapes a dynamic model was executed with.
+ * JIT kernels and oneDNN primitives of a dynamic graph are created lazily on the first inference with a new input
+ * shape, so a freshly started process pays the whole code generation cost on its first requests even if the compiled
+ * blob was imported from the cache. The cache records every new input shapes combination into a file inside the
+ * warm-up directory. The file is keyed by the model topology, the host ISA, the inference precision and the OpenVINO
+ * build, so a record is only replayed by the same model on a compatible host. On the next compile/import the recorded
+ * shapes are replayed with zero filled inputs, which fills the runtime caches before the first user request.
+ */
+class KernelWarmupCache {
+public:
+    using Ptr = std::shared_ptr<KernelWarmupCache>;
+    using InputShapes = std::vector<ov::Shape>;
+
+    KernelWarmupCache(const std::string& cacheDir, const ov::Model& model, const Config& config);
+
+    /**
+     * @brief Reads all the input shapes combinations stored for the model. Malformed records are skipped.
+     */
+    [[nodiscard]] std::vector<InputShapes> load() const;
+
+    /**
+     * @brief Stores the input shapes combination if it has not been seen yet. Thread safe.
+     */
+    void record(const InputShapes& shapes);
+
+    /**
+     * @brief Runs one inference per input shapes combination with zero filled inputs on the request, for the first
+     * maxReplays records only. The request is expected to run on the graph to warm up.
+     * Any failure stops the warm-up silently, since it only affects the first inference latency.
+     */
+    void replay(const std::vector<InputShapes>& records,
+                const std::vector<ov::Output<const ov::Node>>& inputs,
+                ov::IInferRequest& request) const;
+
+    [[nodiscard]] bool isFull() const noexcept {
+        return m_full.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] const std::string& path() const {
+        return m_path;
+    }
+
+    static constexpr size_t maxRecords = 64;
+    // bounds the time the compile/import is extended by, the rest of the shapes are compiled on the first use
+    static constexpr size_t maxReplays = 16;
+
+private:
+    static std::string toString(const InputShapes& shapes);
+
+    std::string m_path;
+    size_t m_numInputs;
+    std::mutex m_mutex;
+    std::unordered_set<std::string> m_records;
+    std::atomic_bool m_full{false};
+};
+
+}  // namespace ov::intel_cpu
@@ -45,7 +45,8 @@ static void dumpStatistics(std::ostream& os,
 
         const auto& scratchpads = ctx->getScratchPads();
         for (size_t i = 0; i < scratchpads.size(); ++i) {
-            os << "Scratchpad " << i << " size: " << scratchpads[i]->size() << " bytes\n\n";
+            os << "Scratchpad " << i << " size: " << scratchpads[i]->size() << " bytes, page size "
+               << scratchpads[i]->pageSize() << " bytes\n\n";
         }
     }
     os << "Weights cache statistics\n";
@@ -63,39 +64,40 @@ static void dumpStatisticsCSV(std::ofstream& os,
                               const SocketsWeights& weights_cache) {
     for (auto&& graph : graphs) {
         CompiledModel::GraphGuard::Lock graph_lock{graph};
-        os << "Memory stats for graph name: " << graph_lock._graph.GetName() << ";;;;;;\n";
+        os << "Memory stats for graph name: " << graph_lock._graph.GetName() << ";;;;;;;;\n";
         auto ctx = graph_lock._graph.getGraphContext();
         auto&& statistics = ctx->getAuxiliaryNetworkMemoryControl()->dumpStatistics();
 
         for (auto&& stat : statistics) {
-            os << "Memory control ID: " << stat.first << ";;;;;;\n";
+            os << "Memory control ID: " << stat.first << ";;;;;;;;\n";
             os << "Record name;Total regions [-];Total unique blocks [-];Total size [bytes];Optimal total size "
-                  "[bytes];Max region size [bytes]\n";
+                  "[bytes];Max region size [bytes];Page size [bytes];NUMA node [-];\n";
 
             for (auto&& item : stat.second) {
                 os << item.id << ";" << item.total_regions << ";" << item.total_unique_blocks << ";" << item.total_size
-                   << ";" << item.optimal_total_size << ";" << item.max_region_size << ";\n";
+                   << ";" << item.optimal_total_size << ";" << item.max_region_size << ";" << item.page_size << ";"
+                   << item.numa_node << ";\n";
             }
         }
-        os << ";;;;;;\n";
-        os << "Scratchpad stats;;;;;;\n";
+        os << ";;;;;;;;\n";
+        os << "Scratchpad stats;;;;;;;;\n";
 
-        os << "Scratchpad ID;Size [bytes];;;;;\n";
+        os << "Scratchpad ID;Size [bytes];Page size [bytes];;;;;;\n";
 
         const auto& scratchpads = ctx->getScratchPads();
         for (size_t i = 0; i < scratchpads.size(); ++i) {
-            os << i << ";" << scratchpads[i]->size() << ";;;;;\n";
+            os << i << ";" << scratchpads[i]->size() << ";" << scratchpads[i]->pageSize() << ";;;;;;\n";
         }
     }
     auto weights_statistics = weights_cache.dumpStatistics();
     if (!weights_statistics.empty()) {
-        os << ";;;;;;\n";
-        os << "Weights cache statistics;;;;;;\n";
-        os << "Socket ID;Total size [bytes];Total memory objects [-];;;\n";
+        os << ";;;;;;;;\n";
+        os << "Weights cache statistics;;;;;;;;\n";
+        os << "Socket ID;Total size [bytes];Total memory objects [-];;;;;;\n";
     }
 
     for (auto&& item : weights_statistics) {
-        os << item.first << ";" << item.second.total_size << ";" << item.second.total_memory_objects << ";;;;;\n";
+        os << item.first << ";" << item.second.total_size << ";" << item.second.total_memory_objects << ";;;;;;\n";
     }
 }
 
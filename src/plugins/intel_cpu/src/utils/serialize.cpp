@@ -5,6 +5,7 @@
 #include "serialize.hpp"
 
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <istream>
 #include <memory>
@@ -12,6 +13,7 @@
 #include <string>
 #include <utility>
 
+#include "memory_plan.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/model.hpp"
 #include "openvino/core/shape.hpp"
@@ -35,6 +37,20 @@ void ModelSerializer::operator<<(const std::shared_ptr<ov::Model>& model) {
         pugi::xml_document xml_doc;
         pugi::xml_node root = xml_doc.append_child("cnndata");
         root.append_child("outputs");
+        if (!m_memory_plans.empty()) {
+            auto plans = root.append_child("memory_plans");
+            for (const auto& [id, plan] : m_memory_plans) {
+                auto planNode = plans.append_child("plan");
+                planNode.append_attribute("id").set_value(id.c_str());
+                planNode.append_attribute("hash").set_value(static_cast<unsigned long long>(plan.boxesHash));
+                planNode.append_attribute("size").set_value(static_cast<long long>(plan.totalSize));
+                for (const auto& [regionId, offset] : plan.offsets) {
+                    auto region = planNode.append_child("region");
+                    region.append_attribute("id").set_value(static_cast<long long>(regionId));
+                    region.append_attribute("offset").set_value(static_cast<long long>(offset));
+                }
+            }
+        }
         xml_doc.save(stream);
     };
 
@@ -60,7 +76,18 @@ ModelDeserializer::ModelDeserializer(std::istream& model_stream,
     }
 }
 
-void ModelDeserializer::set_info(pugi::xml_node& root, std::shared_ptr<ov::Model>& model) {}
+void ModelDeserializer::set_info(pugi::xml_node& root, [[maybe_unused]] std::shared_ptr<ov::Model>& model) {
+    m_memory_plans.clear();
+    for (auto planNode : root.child("memory_plans").children("plan")) {
+        StaticMemoryPlan plan;
+        plan.boxesHash = static_cast<size_t>(planNode.attribute("hash").as_ullong());
+        plan.totalSize = static_cast<int64_t>(planNode.attribute("size").as_llong());
+        for (auto region : planNode.children("region")) {
+            plan.offsets.emplace_back(region.attribute("id").as_llong(), region.attribute("offset").as_llong());
+        }
+        m_memory_plans.emplace(planNode.attribute("id").as_string(), std::move(plan));
+    }
+}
 
 void ModelDeserializer::operator>>(std::shared_ptr<ov::Model>& model) {
     if (m_model_buffer) {
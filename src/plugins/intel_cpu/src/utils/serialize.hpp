@@ -9,7 +9,9 @@
 #include <ostream>
 #include <pugixml.hpp>
 #include <string>
+#include <utility>
 
+#include "memory_plan.hpp"
 #include "openvino/core/model.hpp"
 #include "openvino/runtime/aligned_buffer.hpp"
 #include "utils/codec_xor.hpp"
@@ -22,11 +24,17 @@ public:
 
     ModelSerializer(std::ostream& ostream, CacheEncrypt encrypt_fn = {});
 
+    // the plans are stored in the custom data of the blob, must be set before the model is serialized
+    void set_memory_plans(MemoryPlans plans) {
+        m_memory_plans = std::move(plans);
+    }
+
     void operator<<(const std::shared_ptr<ov::Model>& model);
 
 private:
     std::ostream& m_ostream;
     CacheEncrypt m_cache_encrypt;
+    MemoryPlans m_memory_plans;
 };
 
 class ModelDeserializer {
@@ -44,8 +52,13 @@ public:
 
     void operator>>(std::shared_ptr<ov::Model>& model);
 
+    // the memory plans stored with the model, empty if the blob has none
+    [[nodiscard]] const MemoryPlans& get_memory_plans() const {
+        return m_memory_plans;
+    }
+
 protected:
-    static void set_info(pugi::xml_node& root, std::shared_ptr<ov::Model>& model);
+    void set_info(pugi::xml_node& root, std::shared_ptr<ov::Model>& model);
 
     void process_mmap(std::shared_ptr<ov::Model>& model, const std::shared_ptr<ov::AlignedBuffer>& memory);
 
@@ -56,6 +69,7 @@ protected:
     CacheDecrypt m_cache_decrypt;
     bool m_decript_from_string;
     std::shared_ptr<ov::AlignedBuffer> m_model_buffer;
+    MemoryPlans m_memory_plans;
 };
 
 }  // namespace ov::intel_cpu
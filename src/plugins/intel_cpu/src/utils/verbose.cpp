@@ -23,6 +23,7 @@
 #    include "../src/common/c_types_map.hpp"
 #    include "../src/common/verbose.hpp"
 #    include "cpu_types.h"
+#    include "hw_perf_counters.hpp"
 #    include "memory_desc/cpu_memory_desc_utils.h"
 #    include "verbose.h"
 
@@ -189,8 +190,22 @@ void Verbose::printInfo() {
 }
 
 void Verbose::printDuration() {
-    const auto& duration = node->PerfCounter().duration().count();
+    const auto& perfCounter = node->PerfCounter();
+    const auto& duration = perfCounter.duration().count();
     stream << duration << "ms";
+    if (perfCounter.hasHwCounters()) {
+        const auto cycles = perfCounter.hwLast(HwPerfCounters::CYCLES);
+        const auto instructions = perfCounter.hwLast(HwPerfCounters::INSTRUCTIONS);
+        const auto llcMisses = perfCounter.hwLast(HwPerfCounters::LLC_MISSES);
+        stream << ",cycles:" << cycles << ",instructions:" << instructions
+               << ",ipc:" << (cycles ? static_cast<double>(instructions) / cycles : 0.0)
+               << ",llc_references:" << perfCounter.hwLast(HwPerfCounters::LLC_REFERENCES)
+               << ",llc_misses:" << llcMisses;
+        // the memory traffic estimation: every LLC miss is a cache line read from / written to the memory
+        if (duration > 0) {
+            stream << ",llc_miss_bw:" << llcMisses * HwPerfCounters::cacheLineSize / (duration * 1e6) << "GB/s";
+        }
+    }
 }
 
 void Verbose::flush() const {
@@ -4,20 +4,228 @@
 
 #include "weights_cache.hpp"
 
+#include <array>
 #include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
 #include <functional>
+#include <iterator>
 #include <memory>
 #include <mutex>
+#include <oneapi/dnnl/dnnl.hpp>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "cpu_memory.h"
+#include "graph_context.h"
+#include "memory_desc/cpu_memory_desc.h"
 #include "openvino/core/except.hpp"
+#include "openvino/runtime/compute_hash.hpp"
 #include "openvino/runtime/system_conf.hpp"
+#include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
+#include "utils/debug_capabilities.h"
 
 namespace ov::intel_cpu {
 
+RepackedWeightsStore& RepackedWeightsStore::getInstance() {
+    static RepackedWeightsStore store;
+    return store;
+}
+
+namespace {
+
+bool isSameContent(const IMemory& l, const IMemory& r) {
+    return l.getSize() == r.getSize() && std::memcmp(l.getData(), r.getData(), l.getSize()) == 0;
+}
+
+}  // namespace
+
+MemoryPtr RepackedWeightsStore::findOrCreate(const std::string& key,
+                                             const MemoryCPtr& source,
+                                             const MemoryDescPtr& desc,
+                                             const std::function<MemoryPtr(void)>& create,
+                                             const std::string& persistentDir) {
+    std::shared_ptr<Record> record;
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        auto found = storedWeights.find(key);
+        if (found == storedWeights.end()) {
+            // the expired records are dropped once the map doubles, to keep the amortized cost of the insertion
+            // constant. A record is referenced outside the map only under its lock, so an unused one is not touched
+            // by any other thread
+            if (++insertionsSinceCleanup > storedWeights.size() / 2) {
+                for (auto itr = storedWeights.begin(); itr != storedWeights.end();) {
+                    const auto& stored = itr->second;
+                    itr = stored.use_count() == 1 && stored->memory.expired() ? storedWeights.erase(itr)
+                                                                              : std::next(itr);
+                }
+                insertionsSinceCleanup = 0;
+            }
+            found = storedWeights.emplace(key, std::make_shared<Record>()).first;
+        }
+        record = found->second;
+    }
+
+    std::lock_guard<std::mutex> lock(record->guard);
+    if (auto memory = record->memory.lock()) {
+        if (auto recordSource = record->source.lock()) {
+            if (isSameContent(*recordSource, *source)) {
+                return memory;
+            }
+            // the content hash collision, the weights of the record stay with their users
+            DEBUG_LOG("The repacked weights ", key, " were produced from the other source weights");
+            return create();
+        }
+        // the source of the record is released, so its weights cannot be verified. The record is taken over by the
+        // current weights, which can be verified by the next users
+    }
+
+    MemoryPtr memory;
+    const auto path = persistentDir.empty() ? std::string{} : ov::util::make_path(persistentDir, key + ".cpu_weights");
+    if (!path.empty()) {
+        memory = load(path, key, source, desc);
+    }
+    if (!memory) {
+        memory = create();
+        if (!path.empty()) {
+            store(path, key, source, memory);
+        }
+    }
+    record->memory = memory;
+    record->source = source;
+    return memory;
+}
+
+namespace {
+
+// must be increased on any change of the file layout or of the repacked data produced for the same descriptor
+constexpr uint32_t persistedLayoutVersion = 2;
+constexpr std::array<char, 8> persistedMagic{'O', 'V', 'C', 'P', 'U', 'R', 'W', '\0'};
+constexpr uint64_t persistedDataAlignment = 64;
+
+struct PersistedHeader {
+    std::array<char, 8> magic;
+    uint32_t layoutVersion;
+    uint32_t isa;
+    uint64_t descriptorSize;  // the descriptor follows the header
+    uint64_t dataOffset;
+    uint64_t dataSize;
+    uint64_t sourceSize;  // the source weights follow the data, the file is only valid for the same ones
+};
+
+// the repacked weights are only valid for the same repacking, which is identified by the key, and the same descriptor
+std::string describePersisted(const std::string& key, const MemoryDesc& desc) {
+    return key + "_" + desc.getPrecision().to_string() + "_" + desc.getShape().toString() + "_" +
+           desc.serializeFormat();
+}
+
+uint32_t currentIsa() {
+    return static_cast<uint32_t>(dnnl::get_effective_cpu_isa());
+}
+
+}  // namespace
+
+MemoryPtr RepackedWeightsStore::load(const std::string& path,
+                                     const std::string& key,
+                                     const MemoryCPtr& source,
+                                     const MemoryDescPtr& desc) {
+    if (!ov::util::file_exists(path)) {
+        return nullptr;
+    }
+    std::shared_ptr<ov::MappedMemory> mapped;
+    try {
+        mapped = ov::load_mmap_object(path);
+    } catch (const ov::Exception& e) {
+        DEBUG_LOG("Cannot map the repacked weights ", path, ": ", e.what());
+        return nullptr;
+    }
+    if (!mapped || mapped->size() < sizeof(PersistedHeader)) {
+        return nullptr;
+    }
+
+    PersistedHeader header{};
+    std::memcpy(&header, mapped->data(), sizeof(header));
+    const auto descriptor = describePersisted(key, *desc);
+    const auto isValid = [&]() {
+        return header.magic == persistedMagic && header.layoutVersion == persistedLayoutVersion &&
+               header.isa == currentIsa() && header.descriptorSize == descriptor.size() &&
+               sizeof(header) + descriptor.size() <= header.dataOffset &&
+               header.dataOffset % persistedDataAlignment == 0 && header.dataSize == desc->getCurrentMemSize() &&
+               header.sourceSize == source->getSize() &&
+               header.dataOffset + header.dataSize + header.sourceSize == mapped->size() &&
+               std::memcmp(mapped->data() + sizeof(header), descriptor.data(), descriptor.size()) == 0 &&
+               std::memcmp(mapped->data() + header.dataOffset + header.dataSize,
+                           source->getData(),
+                           header.sourceSize) == 0;
+    };
+    if (!isValid()) {
+        DEBUG_LOG("The persisted repacked weights ", path, " do not match the current ones");
+        return nullptr;
+    }
+
+    // the memory object refers to the mapped data, so the mapping is kept alive together with it
+    struct MappedWeights {
+        MappedWeights(std::shared_ptr<ov::MappedMemory> mapped, size_t offset, const MemoryDescPtr& desc)
+            : mapped(std::move(mapped)),
+              memory(GraphContext::getEngine(), desc, this->mapped->data() + offset, false) {}
+
+        std::shared_ptr<ov::MappedMemory> mapped;
+        Memory memory;  // the mapping is read only, so the pads must not be zeroed
+    };
+    auto weights = std::make_shared<MappedWeights>(std::move(mapped), header.dataOffset, desc);
+    return {weights, &weights->memory};
+}
+
+void RepackedWeightsStore::store(const std::string& path,
+                                 const std::string& key,
+                                 const MemoryCPtr& source,
+                                 const MemoryPtr& memory) {
+    const auto descriptor = describePersisted(key, memory->getDesc());
+    PersistedHeader header{};
+    header.magic = persistedMagic;
+    header.layoutVersion = persistedLayoutVersion;
+    header.isa = currentIsa();
+    header.descriptorSize = descriptor.size();
+    // the data is aligned in the file, as the mapping is page aligned
+    header.dataOffset = (sizeof(header) + descriptor.size() + persistedDataAlignment - 1) / persistedDataAlignment *
+                        persistedDataAlignment;
+    header.dataSize = memory->getSize();
+    header.sourceSize = source->getSize();
+
+    // the file is published by the rename, so the concurrent processes never map a partially written one
+    const auto tmpPath = path + "." + std::to_string(reinterpret_cast<uintptr_t>(memory.get())) + ".tmp";
+    {
+        std::ofstream file(tmpPath, std::ios::binary);
+        if (!file) {
+            DEBUG_LOG("Cannot persist the repacked weights ", path);
+            return;
+        }
+        const std::vector<char> padding(header.dataOffset - sizeof(header) - descriptor.size(), 0);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(descriptor.data(), static_cast<std::streamsize>(descriptor.size()));
+        file.write(padding.data(), static_cast<std::streamsize>(padding.size()));
+        file.write(memory->getDataAs<const char>(), static_cast<std::streamsize>(memory->getSize()));
+        file.write(source->getDataAs<const char>(), static_cast<std::streamsize>(source->getSize()));
+        if (!file) {
+            file.close();
+            std::remove(tmpPath.c_str());
+            return;
+        }
+    }
+    if (std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+        std::remove(tmpPath.c_str());
+    }
+}
+
+WeightsSharing::WeightsSharing(int numaNodeId, bool shareAcrossModels, std::string persistentDir)
+    : numaNodeId(numaNodeId),
+      shareAcrossModels(shareAcrossModels),
+      persistentDir(std::move(persistentDir)) {}
+
 WeightsSharing::SharedMemory::SharedMemory(std::unique_lock<std::mutex>&& lock,
                                            MemoryInfo::Ptr memory,
                                            MemoryPtr newPtr)
@@ -97,10 +305,29 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) co
                                           newPtr);
 }
 
-SocketsWeights::SocketsWeights() {
+WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreateRepacked(const std::string& key,
+                                                                       const MemoryCPtr& source,
+                                                                       const MemoryDescPtr& desc,
+                                                                       const std::string& layoutKey,
+                                                                       const std::function<MemoryPtr(void)>& create) {
+    if (!shareAcrossModels) {
+        return findOrCreate(key, create);
+    }
+
+    // the content is only hashed on the miss of the first level, i.e. once per compiled model
+    auto createShared = [&]() {
+        const auto size = source->getSize();
+        const auto contentKey = layoutKey + "_" + std::to_string(ov::runtime::compute_hash(source->getData(), size)) +
+                                "_" + std::to_string(size) + "_" + std::to_string(numaNodeId);
+        return RepackedWeightsStore::getInstance().findOrCreate(contentKey, source, desc, create, persistentDir);
+    };
+    return findOrCreate(key, createShared);
+}
+
+SocketsWeights::SocketsWeights(bool shareAcrossModels, const std::string& persistentDir) {
     int num_sockets = get_num_sockets();
     for (int socket_id = 0; socket_id < num_sockets; socket_id++) {
-        _cache_map[socket_id] = std::make_shared<WeightsSharing>();
+        _cache_map[socket_id] = std::make_shared<WeightsSharing>(socket_id, shareAcrossModels, persistentDir);
     }
 }
 
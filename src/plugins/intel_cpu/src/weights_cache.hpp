@@ -24,6 +24,53 @@
 //       classes at all.
 
 namespace ov::intel_cpu {
+/**
+ * Process wide store of the repacked weights, the second level of WeightsSharing.
+ * The records are keyed by the content of the source weights and the layout of the repacked ones, so the compiled
+ * models of the same weights share one copy even if the source constants reside in the different buffers (i.e. the
+ * model is read several times). Only weak references are kept, so a record is released together with the last
+ * compiled model using it. The key is only a hash of the content, so the source weights of a found record are compared
+ * with the requested ones byte by byte and the weights are repacked separately on a mismatch.
+ * Optionally the repacked data is persisted into a directory and mapped from the file by the subsequent processes.
+ * The file starts with a header holding the layout version, the ISA and the descriptor of the repacked weights and ends
+ * with a copy of the source weights, a file not matching them is repacked and overwritten.
+ *
+ * Is a thread safe
+ */
+class RepackedWeightsStore {
+public:
+    static RepackedWeightsStore& getInstance();
+
+    MemoryPtr findOrCreate(const std::string& key,
+                           const MemoryCPtr& source,
+                           const MemoryDescPtr& desc,
+                           const std::function<MemoryPtr(void)>& create,
+                           const std::string& persistentDir = {});
+
+private:
+    // the weights of one key are produced once, while the different keys are repacked and persisted concurrently
+    struct Record {
+        std::mutex guard;
+        std::weak_ptr<IMemory> memory;
+        std::weak_ptr<const IMemory> source;  // the weights the memory was repacked from
+    };
+
+    RepackedWeightsStore() = default;
+
+    static MemoryPtr load(const std::string& path,
+                          const std::string& key,
+                          const MemoryCPtr& source,
+                          const MemoryDescPtr& desc);
+    static void store(const std::string& path,
+                      const std::string& key,
+                      const MemoryCPtr& source,
+                      const MemoryPtr& memory);
+
+    std::mutex guard;
+    std::unordered_map<std::string, std::shared_ptr<Record>> storedWeights;
+    size_t insertionsSinceCleanup = 0;
+};
+
 /**
  * Caching store of Memory objects
  * Will return a cached object or create new one
@@ -51,6 +98,14 @@ public:
 
     using Ptr = std::shared_ptr<WeightsSharing>;
 
+    WeightsSharing() = default;
+    /**
+     * @param numaNodeId NUMA node the weights of this store are allocated on
+     * @param shareAcrossModels use RepackedWeightsStore as the second level of the cache
+     * @param persistentDir directory to persist the weights shared across the models, empty to disable
+     */
+    WeightsSharing(int numaNodeId, bool shareAcrossModels, std::string persistentDir = {});
+
     class SharedMemory {
     public:
         using Ptr = std::shared_ptr<SharedMemory>;
@@ -73,6 +128,21 @@ public:
 
     SharedMemory::Ptr get(const std::string& key) const;
 
+    /**
+     * Same as findOrCreate, but on a miss looks up the repacked weights by the content of the source ones in the
+     * process wide RepackedWeightsStore (if enabled)
+     * @param key cache key (may be based on the address of the source weights)
+     * @param source the source weights
+     * @param desc descriptor of the repacked weights
+     * @param layoutKey identifies the transformation of the source weights into the repacked ones
+     * @param create repacking function
+     */
+    SharedMemory::Ptr findOrCreateRepacked(const std::string& key,
+                                           const MemoryCPtr& source,
+                                           const MemoryDescPtr& desc,
+                                           const std::string& layoutKey,
+                                           const std::function<MemoryPtr(void)>& create);
+
 #ifdef CPU_DEBUG_CAPS
     Statistics dumpStatistics() const;
 #endif  // CPU_DEBUG_CAPS
@@ -80,6 +150,9 @@ public:
 protected:
     mutable std::mutex guard;
     std::unordered_map<std::string, MemoryInfo::Ptr> sharedWeights;
+    int numaNodeId = 0;
+    bool shareAcrossModels = false;
+    std::string persistentDir;
 };
 
 /**
@@ -89,7 +162,7 @@ protected:
  */
 class SocketsWeights {
 public:
-    SocketsWeights();
+    explicit SocketsWeights(bool shareAcrossModels = false, const std::string& persistentDir = {});
 
     WeightsSharing::Ptr& operator[](int socket_id);
     const WeightsSharing::Ptr& operator[](int socket_id) const;
@@ -7,6 +7,7 @@
 #include "common_test_utils/test_common.hpp"
 #include "common_test_utils/node_builders/eltwise.hpp"
 #include "common_test_utils/node_builders/constant.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
 #include "functional_test_utils/skip_tests_config.hpp"
 #include "openvino/opsets/opset9_decl.hpp"
 #include "openvino/op/matmul.hpp"
@@ -96,6 +97,29 @@ TEST_P(ExportOptimalNumStreams, OptimalNumStreams) {
     }
 }
 
+// the exported blob carries the static memory plan, the imported model must compute the same results with it
+TEST(ExportImportMemoryPlan, ImportedModelMatchesCompiledModel) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    auto model = MakeMatMulModel();
+    ov::Core core;
+    auto compiled = core.compile_model(model, "CPU", {ov::num_streams(1)});
+    auto input = ov::test::utils::create_and_fill_tensor(ov::element::f32, model->input().get_shape());
+
+    auto request = compiled.create_infer_request();
+    request.set_input_tensor(input);
+    request.infer();
+    const auto expected = request.get_output_tensor();
+
+    std::stringstream exported_model;
+    compiled.export_model(exported_model);
+    auto imported = core.import_model(exported_model, "CPU", {ov::num_streams(1)});
+    auto imported_request = imported.create_infer_request();
+    imported_request.set_input_tensor(input);
+    imported_request.infer();
+
+    ov::test::utils::compare(expected, imported_request.get_output_tensor());
+}
+
 const std::vector<ov::AnyMap> testing_property_for_streams = {{ov::num_streams(1)}, {ov::num_streams(2)}};
 
 const std::vector<ov::AnyMap> testing_property_for_threads = {{ov::inference_num_threads(1)},
@@ -6,6 +6,15 @@
 
 #include <gtest/gtest.h>
 
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+#include "common_test_utils/subgraph_builders/nested_split_conv_concat.hpp"
+#include "common_test_utils/subgraph_builders/single_conv.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/softmax.hpp"
 #include "openvino/runtime/compiled_model.hpp"
 #include "openvino/runtime/core.hpp"
 #include "openvino/runtime/intel_cpu/properties.hpp"
@@ -16,6 +25,12 @@
 #    include <windows.h>
 #endif
 
+#if defined(__linux__)
+#    include <linux/perf_event.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#endif
+
 namespace {
 
 TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkSupportedPropertiesAreAvailable) {
@@ -517,4 +532,228 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckCPURuntimOptionsWithCorePr
     ASSERT_EQ(valueCacheType.as<ov::element::Type>(), ov::element::bf16);
 }
 
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkHugePagesArenaMatchesDefaultResults) {
+    ov::Core core;
+    // 4 MB intermediate tensors, so the blocks of the memory control are big enough for the huge pages
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 1024, 1024});
+    auto relu = std::make_shared<ov::op::v0::Relu>(param);
+    auto softmax = std::make_shared<ov::op::v8::Softmax>(relu, -1);
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{std::make_shared<ov::op::v0::Relu>(softmax)},
+                                             ov::ParameterVector{param});
+
+    ov::Tensor input(ov::element::f32, param->get_shape());
+    auto* inputData = input.data<float>();
+    for (size_t i = 0; i < input.get_size(); i++) {
+        inputData[i] = static_cast<float>(i % 17) / 17.f - 0.5f;
+    }
+
+    auto infer = [&](bool hugePages) {
+        auto compiledModel = core.compile_model(model, deviceName, {{"CPU_HUGE_PAGES_ARENA", hugePages}});
+        auto request = compiledModel.create_infer_request();
+        request.set_input_tensor(input);
+        request.infer();
+        const auto& output = request.get_output_tensor();
+        return std::vector<float>(output.data<float>(), output.data<float>() + output.get_size());
+    };
+
+    const auto expected = infer(false);
+    ASSERT_EQ(infer(true), expected);
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkRegisteredBuffersRejectMisalignedData) {
+    ov::Core core;
+    auto model = ov::test::utils::make_nested_split_conv_concat();
+    model->input().get_tensor().set_names({"data"});
+    auto compiledModel = core.compile_model(model, deviceName);
+
+    const auto& shape = model->input().get_shape();
+    std::vector<float> storage(ov::shape_size(shape) + 16);
+    auto* misaligned = storage.data();
+    while (reinterpret_cast<uintptr_t>(misaligned) % 64 == 0) {
+        misaligned++;
+    }
+    ov::Tensor buffer(ov::element::f32, shape, misaligned);
+    ASSERT_THROW(compiledModel.set_property({{"CPU_REGISTERED_BUFFERS", ov::AnyMap{{"data", buffer}}}}), ov::Exception);
+    ASSERT_THROW(compiledModel.set_property({{"CPU_REGISTERED_BUFFERS", ov::AnyMap{{"unknown", buffer}}}}),
+                 ov::Exception);
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkRegisteredBuffersAreBoundWithoutCopy) {
+    ov::Core core;
+    auto model = ov::test::utils::make_single_conv();
+    model->input().get_tensor().set_names({"data"});
+    model->output().get_tensor().set_names({"result"});
+    // any copy of the user tensors throws
+    auto compiledModel = core.compile_model(model, deviceName, {{"CPU_STRICT_ZERO_COPY", true}});
+
+    auto makeAligned = [](const ov::Output<const ov::Node>& port, std::vector<float>& storage) {
+        storage.resize(ov::shape_size(port.get_shape()) + 16);
+        auto* aligned = storage.data();
+        while (reinterpret_cast<uintptr_t>(aligned) % 64 != 0) {
+            aligned++;
+        }
+        return ov::Tensor(port.get_element_type(), port.get_shape(), aligned);
+    };
+    std::vector<float> inputStorage;
+    std::vector<float> outputStorage;
+    auto input = makeAligned(compiledModel.input(), inputStorage);
+    auto output = makeAligned(compiledModel.output(), outputStorage);
+    for (size_t i = 0; i < input.get_size(); i++) {
+        input.data<float>()[i] = static_cast<float>(i % 7) - 3.f;
+    }
+    ASSERT_NO_THROW(
+        compiledModel.set_property({{"CPU_REGISTERED_BUFFERS", ov::AnyMap{{"data", input}, {"result", output}}}}));
+
+    auto request = compiledModel.create_infer_request();
+    ASSERT_NO_THROW(request.set_input_tensor(input));
+    ASSERT_NO_THROW(request.set_output_tensor(output));
+    ASSERT_NO_THROW(request.infer());
+    ASSERT_EQ(request.get_output_tensor().data(), output.data());
+    auto fallbacks = compiledModel.get_property("CPU_ZERO_COPY_FALLBACKS").as<ov::AnyMap>();
+    ASSERT_EQ(fallbacks.at("INPUTS").as<uint64_t>(), 0u);
+    ASSERT_EQ(fallbacks.at("OUTPUTS").as<uint64_t>(), 0u);
+
+    // the result matches the one computed without the registered buffers
+    auto referenceRequest = core.compile_model(model, deviceName).create_infer_request();
+    referenceRequest.set_input_tensor(input);
+    referenceRequest.infer();
+    const auto expected = referenceRequest.get_output_tensor();
+    ASSERT_EQ(std::memcmp(expected.data(), output.data(), output.get_byte_size()), 0);
+
+    ASSERT_NO_THROW(
+        compiledModel.set_property({{"CPU_UNREGISTER_BUFFERS", ov::AnyMap{{"data", input}, {"result", output}}}}));
+    ASSERT_THROW(compiledModel.set_property({{"CPU_UNREGISTER_BUFFERS", ov::AnyMap{{"unknown", input}}}}),
+                 ov::Exception);
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkZeroCopyFallbacksAreCounted) {
+    ov::Core core;
+    auto model = ov::test::utils::make_nested_split_conv_concat();
+    auto compiledModel = core.compile_model(model, deviceName);
+
+    auto fallbacks = compiledModel.get_property("CPU_ZERO_COPY_FALLBACKS").as<ov::AnyMap>();
+    ASSERT_EQ(fallbacks.at("INPUTS").as<uint64_t>(), 0);
+    ASSERT_EQ(fallbacks.at("OUTPUTS").as<uint64_t>(), 0);
+
+    // the ROI tensor is not dense, so it is always copied
+    auto shape = model->input().get_shape();
+    auto parentShape = shape;
+    parentShape.back() *= 2;
+    ov::Tensor parent(ov::element::f32, parentShape);
+    ov::Tensor roi(parent, ov::Coordinate(shape.size(), 0), ov::Coordinate(shape));
+
+    auto request = compiledModel.create_infer_request();
+    ASSERT_NO_THROW(request.set_input_tensor(roi));
+    fallbacks = compiledModel.get_property("CPU_ZERO_COPY_FALLBACKS").as<ov::AnyMap>();
+    ASSERT_EQ(fallbacks.at("INPUTS").as<uint64_t>(), 1);
+
+    auto strictModel = core.compile_model(model, deviceName, {{"CPU_STRICT_ZERO_COPY", true}});
+    auto strictRequest = strictModel.create_infer_request();
+    ASSERT_THROW(strictRequest.set_input_tensor(roi), ov::Exception);
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkDynamicOutputsAreNotZeroCopyFallbacks) {
+    ov::Core core;
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{-1, 3});
+    auto relu = std::make_shared<ov::op::v0::Relu>(param);
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{relu}, ov::ParameterVector{param});
+    auto compiledModel = core.compile_model(model, deviceName, {{"CPU_STRICT_ZERO_COPY", true}});
+
+    auto request = compiledModel.create_infer_request();
+    ov::Tensor output(ov::element::f32, ov::Shape{2, 3});
+    ASSERT_NO_THROW(request.set_output_tensor(output));
+    auto fallbacks = compiledModel.get_property("CPU_ZERO_COPY_FALLBACKS").as<ov::AnyMap>();
+    ASSERT_EQ(fallbacks.at("OUTPUTS").as<uint64_t>(), 0u);
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkReferenceFallbacksReport) {
+    ov::Core core;
+    auto model = ov::test::utils::make_nested_split_conv_concat();
+    auto compiledModel = core.compile_model(model, deviceName, {ov::enable_profiling(true)});
+    auto request = compiledModel.create_infer_request();
+    request.infer();
+
+    // all the ops of the model have the optimized implementations
+    ov::AnyMap report;
+    ASSERT_NO_THROW(report = compiledModel.get_property("CPU_REFERENCE_FALLBACKS").as<ov::AnyMap>());
+    ASSERT_TRUE(report.empty());
+}
+
+// whether the user space hardware cycles counter of the calling thread can be opened
+bool hwPerfCountersAvailable() {
+#if defined(__linux__)
+    perf_event_attr attr{};
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = PERF_COUNT_HW_CPU_CYCLES;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    const auto fd = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+    if (fd < 0) {
+        return false;
+    }
+    close(fd);
+    return true;
+#else
+    return false;
+#endif
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkHwPerfCountersAreReported) {
+    if (!hwPerfCountersAvailable()) {
+        GTEST_SKIP() << "perf_event_open is not available";
+    }
+    ov::Core core;
+    auto model = ov::test::utils::make_single_conv();
+    const ov::AnyMap config{ov::enable_profiling(true), {"CPU_HW_PERF_COUNTERS", true}};
+    ov::CompiledModel compiledModel;
+    ASSERT_NO_THROW(compiledModel = core.compile_model(model, deviceName, config));
+    auto request = compiledModel.create_infer_request();
+    request.infer();
+
+    bool hasCycles = false;
+    for (const auto& node : compiledModel.get_runtime_model()->get_ordered_ops()) {
+        const auto& rtInfo = node->get_rt_info();
+        const auto cycles = rtInfo.find("hwCycles");
+        if (cycles == rtInfo.end()) {
+            continue;
+        }
+        ASSERT_NE(rtInfo.find("hwInstructions"), rtInfo.end());
+        ASSERT_NE(rtInfo.find("hwLlcReferences"), rtInfo.end());
+        ASSERT_NE(rtInfo.find("hwLlcMisses"), rtInfo.end());
+        hasCycles |= std::stoull(cycles->second.as<std::string>()) > 0;
+    }
+    ASSERT_TRUE(hasCycles);
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkKernelWarmupRecordsShapeChangesToWarmupDir) {
+    const auto cacheDir = (std::filesystem::temp_directory_path() / "ov_cpu_kernel_warmup_test").string();
+    std::filesystem::remove_all(cacheDir);
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{-1, 3});
+    auto relu = std::make_shared<ov::op::v0::Relu>(param);
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{relu}, ov::ParameterVector{param});
+
+    ov::Core core;
+    // the warm-up directory is only set for this compile_model call
+    auto compiledModel =
+        core.compile_model(model, deviceName, {{"CPU_KERNEL_WARMUP", true}, {"CPU_KERNEL_WARMUP_DIR", cacheDir}});
+    auto request = compiledModel.create_infer_request();
+    for (size_t batch : {1, 1, 2, 2, 1}) {
+        request.set_input_tensor(ov::Tensor(ov::element::f32, ov::Shape{batch, 3}));
+        request.infer();
+    }
+
+    std::vector<std::string> records;
+    for (const auto& entry : std::filesystem::directory_iterator(cacheDir)) {
+        if (entry.path().extension() == ".cpu_warmup") {
+            std::ifstream file(entry.path());
+            for (std::string line; std::getline(file, line);) {
+                records.push_back(line);
+            }
+        }
+    }
+    std::filesystem::remove_all(cacheDir);
+    ASSERT_EQ(records, std::vector<std::string>({"1,3", "2,3"}));
+}
+
 }  // namespace
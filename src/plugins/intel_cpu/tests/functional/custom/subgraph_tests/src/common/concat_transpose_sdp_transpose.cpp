@@ -391,6 +391,38 @@ INSTANTIATE_TEST_SUITE_P(smoke_ConcatSDPTransposeByChannelTest,
                          ConcatSDPTransposeTest::getTestCaseName);
 }  //  namespace
 
+class ConcatSDPTransposeU4Test : public ConcatSDPTransposeTest {
+public:
+    void SetUp() override {
+        ConcatSDPTransposeTest::SetUp();
+        configuration[ov::hint::kv_cache_precision.name()] = ov::element::u4;
+        // 16 quantization levels, the states are compared after the dequantization
+        abs_threshold = 0.5f;
+    }
+};
+
+TEST_P(ConcatSDPTransposeU4Test, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    auto actualOutputs = run_test(function);
+    CheckNumberOfNodesWithType(compiledModel, "ScaledDotProductAttention", 1);
+    auto expectedOutputs = run_test(functionRefs);
+    CheckNumberOfNodesWithType(compiledModel, "ScaledDotProductAttention", 0);
+    for (size_t i = 0; i < actualOutputs.size(); i++) {
+        ov::test::utils::compare(expectedOutputs[i], actualOutputs[i], abs_threshold, rel_threshold);
+    }
+}
+
+namespace {
+INSTANTIATE_TEST_SUITE_P(smoke_ConcatSDPTransposeU4Test,
+                         ConcatSDPTransposeU4Test,
+                         ::testing::Combine(::testing::Values(ElementType::f32),
+                                            ::testing::ValuesIn(shapesWithGreedySearch),
+                                            ::testing::Values(false),
+                                            ::testing::Values(true, false),
+                                            ::testing::Values(16)),
+                         ConcatSDPTransposeTest::getTestCaseName);
+}  //  namespace
+
 class ConcatSDPTransposeTestSetState : public ConcatSDPTransposeTestBase {
 public:
     void reduce_state() {
@@ -528,6 +560,126 @@ INSTANTIATE_TEST_SUITE_P(smoke_ConcatSDPTransposeTestSetState,
                                             ::testing::Values(0)),
                          ConcatSDPTransposeTest::getTestCaseName);
 
+class ConcatSDPTransposeTestForkState : public ConcatSDPTransposeTestBase {
+public:
+    // the prefix computed by one request is continued by the others, truncate_by_shape selects the snapshot truncation
+    std::vector<ov::Tensor> run_test(std::shared_ptr<ov::Model> model, bool truncate_by_shape) {
+        function = model;
+        auto input_type = model->get_parameters()[0]->get_element_type();
+        if (quantKeyByChannel || input_type == ov::element::f16) {
+            configuration[ov::hint::kv_cache_precision.name()] = "u8";
+        } else if (input_type == ov::element::f32) {
+            configuration[ov::hint::kv_cache_precision.name()] = "f32";
+        } else {
+            configuration[ov::hint::kv_cache_precision.name()] = "bf16";
+        }
+        // the channel quantized cache is truncated in place only at the quantization group boundary
+        const size_t truncated_length = quantKeyByChannel ? keyGroupSize : 1;
+        prepare();
+        std::vector<ov::Tensor> outputs;
+        auto infer = [&](ov::InferRequest& request) {
+            for (const auto& input : inputs) {
+                request.set_tensor(input.first, input.second);
+            }
+            request.infer();
+            auto outputTensor = request.get_output_tensor(0);
+            ov::Tensor copy{outputTensor.get_element_type(), outputTensor.get_shape()};
+            outputTensor.copy_to(copy);
+            outputs.push_back(copy);
+        };
+        auto find_state = [](ov::InferRequest& request, const std::string& name) {
+            for (auto&& state : request.query_state()) {
+                if (state.get_name() == name) {
+                    return state;
+                }
+            }
+            OPENVINO_THROW("Failed to find ", name, " state");
+        };
+
+        generate(0, targetStaticShapes[0]);
+        infer(inferRequest);
+
+        auto forked = compiledModel.create_infer_request();
+        auto truncated = compiledModel.create_infer_request();
+        for (auto&& state : inferRequest.query_state()) {
+            find_state(forked, state.get_name()).set_state(state.get_state());
+
+            auto state_tensor = state.get_state();
+            auto new_shape = state_tensor.get_shape();
+            new_shape[transposeOrder[2]] -= truncated_length;
+            if (truncate_by_shape) {
+                state_tensor.set_shape(new_shape);
+                find_state(truncated, state.get_name()).set_state(state_tensor);
+            } else {
+                ov::Coordinate begin(new_shape.size(), 0);
+                ov::Tensor roi{state_tensor, begin, ov::Coordinate(new_shape)};
+                ov::Tensor copy{state_tensor.get_element_type(), new_shape};
+                roi.copy_to(copy);
+                find_state(truncated, state.get_name()).set_state(copy);
+            }
+        }
+
+        for (size_t idx = 1; idx < targetStaticShapes.size(); idx++) {
+            generate(static_cast<int>(idx), targetStaticShapes[idx]);
+            infer(inferRequest);
+            infer(forked);
+            infer(truncated);
+        }
+        return outputs;
+    }
+};
+
+TEST_P(ConcatSDPTransposeTestForkState, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    ElementType inType;
+    InputShapeAndTransposeOrder inputShapeAndOrders;
+    bool hasShapeOf;
+    bool quantKeyByChannel;
+    size_t groupSize;
+    std::tie(inType, inputShapeAndOrders, hasShapeOf, quantKeyByChannel, groupSize) = this->GetParam();
+
+    // skip bf16 test on avx512 platform
+    if (inType == ElementType::bf16 && !ov::with_cpu_x86_bfloat16())
+        GTEST_SKIP();
+
+    auto actualOutputs = run_test(function, true);
+    CheckNumberOfNodesWithType(compiledModel, "ScaledDotProductAttention", 1);
+    auto expectedOutputs = run_test(functionRefs, false);
+    CheckNumberOfNodesWithType(compiledModel, "ScaledDotProductAttention", 0);
+    for (size_t i = 0; i < actualOutputs.size(); i++) {
+        ov::test::utils::compare(expectedOutputs[i], actualOutputs[i], abs_threshold, rel_threshold);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_ConcatSDPTransposeTestForkState,
+                         ConcatSDPTransposeTestForkState,
+                         ::testing::Combine(::testing::Values(ElementType::f32, ElementType::bf16, ElementType::f16),
+                                            ::testing::ValuesIn(inputShapeAndReordersSetState),
+                                            ::testing::Values(false),
+                                            ::testing::Values(false),
+                                            ::testing::Values(0)),
+                         ConcatSDPTransposeTest::getTestCaseName);
+
+const std::vector<InputShapeAndTransposeOrder> inputShapeAndReordersForkStateByChannel = {
+    {// greedy search, the prefix is two quantization groups long
+     {{
+          // B, L1, H, S
+          {{1, -1, 8, 64}, {{1, 16, 8, 64}, {1, 1, 8, 64}, {1, 1, 8, 64}, {1, 1, 8, 64}}},
+          // B, L0, H, S
+          {{1, -1, 8, 64}, {{1, 0, 8, 64}, {1, 16, 8, 64}, {1, 17, 8, 64}, {1, 18, 8, 64}}},
+      },
+      // transposeOrder
+      {0, 2, 1, 3}}}};
+
+INSTANTIATE_TEST_SUITE_P(smoke_ConcatSDPTransposeTestForkStateByChannel,
+                         ConcatSDPTransposeTestForkState,
+                         ::testing::Combine(::testing::Values(ElementType::f32),
+                                            ::testing::ValuesIn(inputShapeAndReordersForkStateByChannel),
+                                            ::testing::Values(false),
+                                            ::testing::Values(true),
+                                            ::testing::Values(8)),
+                         ConcatSDPTransposeTest::getTestCaseName);
+
 class ConcatSDPTransposeTestWrongBeamIdx : public ConcatSDPTransposeTest {
 public:
     void generate(int idx, const std::vector<ov::Shape>& targetInputStaticShapes) override {
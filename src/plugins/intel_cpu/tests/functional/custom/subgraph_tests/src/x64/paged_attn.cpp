@@ -101,7 +101,7 @@ public:
         auto scale =
             std::make_shared<ov::op::v0::Constant>(ov::element::f32, ov::Shape{}, std::vector<float>{scale_value});
         auto silding_windows =
-            std::make_shared<ov::op::v0::Constant>(ov::element::i32, Shape{}, std::vector<int32_t>{0});
+            std::make_shared<ov::op::v0::Constant>(ov::element::i32, Shape{}, std::vector<int32_t>{sliding_window});
         auto alibi_slopes = std::make_shared<ov::op::v0::Constant>(ov::element::f32, Shape{0}, std::vector<float>{});
         auto max_context_len =
             std::make_shared<ov::op::v0::Constant>(ov::element::i32, Shape{}, std::vector<float>{128});
@@ -178,7 +178,15 @@ public:
         std::shared_ptr<ov::Node> v_in = concatV;
         k_in = std::make_shared<ov::op::v1::Transpose>(k_in, preOrder);
         v_in = std::make_shared<ov::op::v1::Transpose>(v_in, preOrder);
-        auto sdp = std::make_shared<ov::op::v13::ScaledDotProductAttention>(q_in, k_in, v_in, true);
+        std::shared_ptr<ov::Node> sdp;
+        if (sliding_window) {
+            // the sliding window is passed as an explicit mask [1, 1, L1, L0 + L1]
+            auto attn_mask = make_param(PartialShape{1, 1, -1, -1}, ov::element::f32, "attn_mask");
+            inputParams.push_back(attn_mask);
+            sdp = std::make_shared<ov::op::v13::ScaledDotProductAttention>(q_in, k_in, v_in, attn_mask, false);
+        } else {
+            sdp = std::make_shared<ov::op::v13::ScaledDotProductAttention>(q_in, k_in, v_in, true);
+        }
         sdp->set_friendly_name("mha");
         auto pastk_assign = std::make_shared<ov::op::v6::Assign>(concatK, var_k);
         auto pastv_assign = std::make_shared<ov::op::v6::Assign>(concatV, var_v);
@@ -326,6 +334,23 @@ public:
             create_input(function->get_parameters()[2], targetInputStaticShapes[0], idx + 3.0f);
             create_input(function->get_parameters()[3], targetInputStaticShapes[1], idx + 4.0f);
             create_input(function->get_parameters()[4], ov::Shape{targetInputStaticShapes[0][1]}, idx + 0.0f);
+            if (sliding_window) {
+                // the i-th new token sees the last sliding_window tokens up to itself
+                const auto q_len = targetInputStaticShapes[0][0];
+                const auto past_len = targetInputStaticShapes[1][0];
+                ov::Tensor mask{ov::element::f32, {1, 1, q_len, past_len + q_len}};
+                auto* p = mask.data<float>();
+                for (size_t m = 0; m < q_len; m++) {
+                    const auto ncausal = past_len + m + 1;
+                    const auto window = static_cast<size_t>(sliding_window);
+                    const auto start = ncausal > window ? ncausal - window : 0;
+                    for (size_t n = 0; n < past_len + q_len; n++) {
+                        p[m * (past_len + q_len) + n] =
+                            n >= start && n < ncausal ? 0.0f : std::numeric_limits<float>::lowest();
+                    }
+                }
+                inputs.insert({function->get_parameters()[5], mask});
+            }
         }
     }
     void prepare() {
@@ -345,6 +370,7 @@ public:
     ov::Tensor key_cache;
     ov::Tensor value_cache;
     int32_t past_len_count = 0;
+    int32_t sliding_window = 0;
 };
 
 class PagedAttnVSSDPATest : public PagedAttnTestBase {
@@ -422,12 +448,20 @@ TEST_P(PagedAttnVSSDPATest, CompareWithRefs) {
 }
 
 namespace {
-const std::vector<InputShapes> inputShapeAndReorders = {  // greedy search
+const std::vector<InputShapes> inputShapeAndReorders = {
+    // greedy search
     {
         // L1, B, H, S
         {{-1, 1, 8, 64}, {{10, 1, 8, 64}, {1, 1, 8, 64}, {1, 1, 8, 64}}},
         // B, L0, H, S
         {{-1, 1, 8, 64}, {{0, 1, 8, 64}, {10, 1, 8, 64}, {11, 1, 8, 64}}},
+    },
+    // speculative decoding: the draft tokens are validated in one step
+    {
+        // L1, B, H, S
+        {{-1, 1, 8, 64}, {{10, 1, 8, 64}, {4, 1, 8, 64}, {1, 1, 8, 64}}},
+        // B, L0, H, S
+        {{-1, 1, 8, 64}, {{0, 1, 8, 64}, {10, 1, 8, 64}, {14, 1, 8, 64}}},
     }};
 
 INSTANTIATE_TEST_SUITE_P(smoke_PagedAttnVSSDPATest,
@@ -437,6 +471,40 @@ INSTANTIATE_TEST_SUITE_P(smoke_PagedAttnVSSDPATest,
                          PagedAttnTestBase::getTestCaseName);
 }  // namespace
 
+class PagedAttnSlidingWindowTest : public PagedAttnVSSDPATest {
+public:
+    void SetUp() override {
+        sliding_window = 8;
+        PagedAttnVSSDPATest::SetUp();
+    }
+};
+
+TEST_P(PagedAttnSlidingWindowTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    // compare the logits from paged attn and sdpa with the window mask
+    auto actualOutputs = run_test(function);
+    auto expectedOutputs = run_ref_test(functionRefs);
+    for (size_t i = 0; i < actualOutputs.size(); i++) {
+        ov::test::utils::compare(expectedOutputs[i], actualOutputs[i], abs_threshold, rel_threshold);
+    }
+}
+
+namespace {
+// the sliding window is applied to the first token and to the several new tokens of the speculative decoding
+const std::vector<InputShapes> slidingWindowShapes = {{
+    // L1, B, H, S
+    {{-1, 1, 8, 64}, {{10, 1, 8, 64}, {4, 1, 8, 64}}},
+    // B, L0, H, S
+    {{-1, 1, 8, 64}, {{0, 1, 8, 64}, {10, 1, 8, 64}}},
+}};
+
+INSTANTIATE_TEST_SUITE_P(smoke_PagedAttnSlidingWindowTest,
+                         PagedAttnSlidingWindowTest,
+                         ::testing::Combine(::testing::Values(ElementType::f32),
+                                            ::testing::ValuesIn(slidingWindowShapes)),
+                         PagedAttnTestBase::getTestCaseName);
+}  // namespace
+
 class PagedAttnVSMatmulTest : public PagedAttnTestBase {
 public:
     std::shared_ptr<ov::Model> get_ref_model(ov::element::Type data_type,
@@ -0,0 +1,27 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "bench_utils.hpp"
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "nodes/common/cpu_convert.h"
+#include "openvino/core/type/element_type.hpp"
+
+namespace ov::intel_cpu::bench {
+
+void fill_random(void* data, ov::element::Type type, size_t count, float min, float max) {
+    // fixed seed to keep the data dependent kernels (e.g. quantization) comparable between the runs
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dist(min, max);
+    std::vector<float> values(count);
+    for (auto& value : values) {
+        value = dist(gen);
+    }
+    cpu_convert(values.data(), data, ov::element::f32, type, count);
+}
+
+}  // namespace ov::intel_cpu::bench
@@ -0,0 +1,39 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+
+#include "openvino/core/type/element_type.hpp"
+
+namespace ov::intel_cpu::bench {
+
+// the precisions are passed to the benchmarks as the integer arguments
+inline int64_t arg(ov::element::Type_t type) {
+    return static_cast<int64_t>(type);
+}
+
+inline ov::element::Type precision_arg(const benchmark::State& state, size_t idx) {
+    return static_cast<ov::element::Type_t>(state.range(idx));
+}
+
+/**
+ * @brief Reports the memory traffic and the amount of computations of a single iteration as the rates over the
+ * measured time (the "GB/s" and "GFLOP/s" counters). The flops are not reported for the memory bound kernels.
+ */
+inline void set_throughput(benchmark::State& state, double bytes, double flops = 0.0) {
+    state.counters["GB/s"] = benchmark::Counter(bytes * 1e-9, benchmark::Counter::kIsIterationInvariantRate);
+    if (flops > 0.0) {
+        state.counters["GFLOP/s"] = benchmark::Counter(flops * 1e-9, benchmark::Counter::kIsIterationInvariantRate);
+    }
+}
+
+// fills the buffer with the uniformly distributed values converted to the given precision
+void fill_random(void* data, ov::element::Type type, size_t count, float min = -1.0F, float max = 1.0F);
+
+}  // namespace ov::intel_cpu::bench
@@ -0,0 +1,64 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "nodes/kernels/scaled_attn/attn_quant.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "bench_utils.hpp"
+#include "openvino/core/type/element_type.hpp"
+
+using namespace ov::Extensions::Cpu::XARCH;
+using namespace ov::intel_cpu::bench;
+
+namespace {
+
+// the quantization of the KV cache rows of the head size S as it is done for the appended tokens
+void AttnQuantU8(benchmark::State& state) {
+    const auto S = static_cast<size_t>(state.range(0));
+    const auto tokens = static_cast<size_t>(state.range(1));
+
+    std::vector<float> src(tokens * S);
+    std::vector<uint8_t> dst(tokens * S);
+    std::vector<float> scale_zp(tokens * 2);
+    fill_random(src.data(), ov::element::f32, src.size());
+
+    for (auto _ : state) {
+        for (size_t t = 0; t < tokens; t++) {
+            attn_quant_u8(src.data() + t * S, dst.data() + t * S, S, scale_zp[2 * t], scale_zp[2 * t + 1]);
+        }
+        benchmark::DoNotOptimize(dst.data());
+        benchmark::ClobberMemory();
+    }
+
+    set_throughput(state, static_cast<double>(tokens * S * (sizeof(float) + sizeof(uint8_t))));
+}
+
+void AttnDequantU8(benchmark::State& state) {
+    const auto S = static_cast<size_t>(state.range(0));
+    const auto tokens = static_cast<size_t>(state.range(1));
+
+    std::vector<uint8_t> src(tokens * S);
+    std::vector<float> dst(tokens * S);
+    fill_random(src.data(), ov::element::u8, src.size(), 0.0F, 255.0F);
+
+    for (auto _ : state) {
+        for (size_t t = 0; t < tokens; t++) {
+            attn_dequant_u8(src.data() + t * S, dst.data() + t * S, S, 0.05F, 128.0F);
+        }
+        benchmark::DoNotOptimize(dst.data());
+        benchmark::ClobberMemory();
+    }
+
+    set_throughput(state, static_cast<double>(tokens * S * (sizeof(float) + sizeof(uint8_t))));
+}
+
+}  // namespace
+
+BENCHMARK(AttnQuantU8)->ArgNames({"S", "tokens"})->ArgsProduct({{64, 128, 256}, {1, 1024}});
+BENCHMARK(AttnDequantU8)->ArgNames({"S", "tokens"})->ArgsProduct({{64, 128, 256}, {1, 1024}});
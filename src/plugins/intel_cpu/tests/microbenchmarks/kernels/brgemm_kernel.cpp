@@ -0,0 +1,100 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "nodes/kernels/x64/brgemm_kernel.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "bench_utils.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/runtime/system_conf.hpp"
+
+using namespace ov::intel_cpu;
+using namespace ov::intel_cpu::bench;
+
+namespace {
+
+bool is_supported(ov::element::Type prc) {
+    switch (prc) {
+    case ov::element::f32:
+        return ov::with_cpu_x86_avx512_core();
+    case ov::element::bf16:
+        return ov::with_cpu_x86_bfloat16();
+    case ov::element::f16:
+        return ov::with_cpu_x86_avx512_core_fp16();
+    default:
+        return false;
+    }
+}
+
+// a single C[M, N] = A[M, K] * B[K, N] split by the M blocks between the threads, the B repacking is not measured
+void BrgemmKernelGemm(benchmark::State& state) {
+    const auto M = static_cast<size_t>(state.range(0));
+    const auto N = static_cast<size_t>(state.range(1));
+    const auto K = static_cast<size_t>(state.range(2));
+    const auto prc = precision_arg(state, 3);
+    state.SetLabel(prc.to_string());
+    if (!is_supported(prc)) {
+        state.SkipWithError("the precision is not supported by the platform");
+        return;
+    }
+
+    BrgemmKernel gemm(M, N, K, K, N, N, false, prc);
+    const auto is_f32 = prc == ov::element::f32;
+    const auto threads = static_cast<size_t>(parallel_get_max_threads());
+
+    std::vector<uint8_t> a(M * K * prc.size());
+    std::vector<uint8_t> b(K * N * prc.size());
+    std::vector<float> c(M * N);
+    std::vector<size_t> wsp(threads * 4 * 1024);
+    std::vector<uint8_t> a_scratch(threads * gemm.get_scratch_a_size());
+    std::vector<uint8_t> b_scratch(gemm.get_scratch_b_size());
+    fill_random(a.data(), prc, M * K);
+    fill_random(b.data(), prc, K * N);
+    if (!is_f32) {
+        gemm.copy_buffer_b(b.data(), b_scratch.data());
+    }
+    auto* b_ptr = is_f32 ? b.data() : b_scratch.data();
+    const auto m_block_size = gemm.get_mblk_size();
+    const auto m_blocks = (M + m_block_size - 1) / m_block_size;
+
+    for (auto _ : state) {
+        ov::parallel_nt_static(static_cast<int>(threads), [&](const size_t ithr, const size_t nthr) {
+            size_t start = 0;
+            size_t end = 0;
+            ov::splitter(m_blocks, nthr, ithr, start, end);
+            for (auto m_blk = start; m_blk < end; m_blk++) {
+                const auto m_start = m_blk * m_block_size;
+                const auto m_cnt = std::min(m_block_size, M - m_start);
+                gemm.executeGemm(m_cnt < m_block_size,
+                                 a.data() + m_start * K * prc.size(),
+                                 b_ptr,
+                                 c.data() + m_start * N,
+                                 wsp.data() + ithr * 4 * 1024,
+                                 a_scratch.data() + ithr * gemm.get_scratch_a_size());
+            }
+        });
+        benchmark::ClobberMemory();
+    }
+
+    set_throughput(state,
+                   static_cast<double>((M * K + K * N) * prc.size() + M * N * sizeof(float)),
+                   2.0 * static_cast<double>(M * N * K));
+}
+
+}  // namespace
+
+BENCHMARK(BrgemmKernelGemm)
+    ->ArgNames({"M", "N", "K", "prc"})
+    ->ArgsProduct({{32, 256, 1024},
+                   {256, 1024},
+                   {256, 1024},
+                   {arg(ov::element::Type_t::f32), arg(ov::element::Type_t::bf16), arg(ov::element::Type_t::f16)}})
+    ->UseRealTime();
@@ -0,0 +1,62 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "nodes/common/cpu_convert.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "bench_utils.hpp"
+#include "openvino/core/type/element_type.hpp"
+
+using namespace ov::intel_cpu;
+using namespace ov::intel_cpu::bench;
+
+namespace {
+
+void CpuConvert(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+    const auto src_prc = precision_arg(state, 1);
+    const auto dst_prc = precision_arg(state, 2);
+
+    std::vector<uint8_t> src(size * src_prc.size());
+    std::vector<uint8_t> dst(size * dst_prc.size());
+    fill_random(src.data(), src_prc, size, 0.0F, 100.0F);
+
+    for (auto _ : state) {
+        cpu_convert(src.data(), dst.data(), src_prc, dst_prc, size);
+        benchmark::DoNotOptimize(dst.data());
+        benchmark::ClobberMemory();
+    }
+
+    set_throughput(state, static_cast<double>(size * (src_prc.size() + dst_prc.size())));
+    state.SetLabel(src_prc.to_string() + "->" + dst_prc.to_string());
+}
+
+void CpuConvertArgs(benchmark::internal::Benchmark* b) {
+    using ov::element::Type_t;
+    const std::vector<std::pair<Type_t, Type_t>> conversions = {
+        {Type_t::f32, Type_t::bf16},
+        {Type_t::bf16, Type_t::f32},
+        {Type_t::f32, Type_t::f16},
+        {Type_t::f16, Type_t::f32},
+        {Type_t::u8, Type_t::f32},
+        {Type_t::f32, Type_t::i32},
+    };
+    b->ArgNames({"size", "src", "dst"});
+    // L2 resident and the memory bound sizes
+    for (int64_t size : {1 << 14, 1 << 24}) {
+        for (const auto& conversion : conversions) {
+            b->Args({size, arg(conversion.first), arg(conversion.second)});
+        }
+    }
+}
+
+}  // namespace
+
+BENCHMARK(CpuConvert)->Apply(CpuConvertArgs)->UseRealTime();
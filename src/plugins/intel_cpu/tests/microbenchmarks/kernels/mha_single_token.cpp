@@ -0,0 +1,108 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "nodes/kernels/scaled_attn/mha_single_token.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+
+#include "bench_utils.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "utils/plain_tensor.hpp"
+
+using namespace ov::Extensions::Cpu::XARCH;
+using namespace ov::intel_cpu;
+using namespace ov::intel_cpu::bench;
+
+namespace {
+
+// the second token attention of LLM: a single query against the KV cache of the given length and precision
+void MhaSingleToken(benchmark::State& state) {
+    const auto B = static_cast<size_t>(state.range(0));
+    const auto H = static_cast<size_t>(state.range(1));
+    const auto L = static_cast<size_t>(state.range(2));
+    const auto S = static_cast<size_t>(state.range(3));
+    const auto kv_prc = precision_arg(state, 4);
+
+    PlainTensor query;
+    PlainTensor key;
+    PlainTensor value;
+    PlainTensor output;
+    query.resize<float>({B, H, 1, S});
+    key.resize({B, H, L, S}, kv_prc.size(), kv_prc);
+    value.resize({B, H, L, S}, kv_prc.size(), kv_prc);
+    output.resize<float>({B, H, 1, S});
+    fill_random(query.ptr<float>(), ov::element::f32, B * H * S);
+
+    // the per token quantization, the group is the whole head
+    PlainTensor key_scale_zp;
+    PlainTensor value_scale_zp;
+    if (kv_prc == ov::element::u8) {
+        key_scale_zp.resize<float>({L, B, H, 2});
+        value_scale_zp.resize<float>({L, B, H, 2});
+        for (size_t i = 0; i < L * B * H * 2; i += 2) {
+            key_scale_zp.ptr<float>()[i] = value_scale_zp.ptr<float>()[i] = 0.01F;
+            key_scale_zp.ptr<float>()[i + 1] = value_scale_zp.ptr<float>()[i + 1] = 128.0F;
+        }
+        fill_random(key.ptr_v(), kv_prc, B * H * L * S, 0.0F, 255.0F);
+        fill_random(value.ptr_v(), kv_prc, B * H * L * S, 0.0F, 255.0F);
+    } else {
+        fill_random(key.ptr_v(), kv_prc, B * H * L * S);
+        fill_random(value.ptr_v(), kv_prc, B * H * L * S);
+    }
+
+    PlainTensor alibi_mask;
+    PlainTensor attention_mask;
+    PlainTensor beams;
+    PlainTensor attn_w;
+    PlainTensor attn_score;
+    PlainTensor head_sum;
+    // aligned to the cache line as it is done by the node
+    attn_w.resize<float>({B, H, 1, (L + 15) / 16 * 16});
+
+    for (auto _ : state) {
+        mha_single_token(query,
+                         key,
+                         value,
+                         alibi_mask,
+                         attention_mask,
+                         beams,
+                         output,
+                         attn_w,
+                         attn_score,
+                         false,
+                         false,
+                         0.0F,
+                         key_scale_zp,
+                         value_scale_zp,
+                         head_sum,
+                         S,
+                         S,
+                         false);
+        benchmark::ClobberMemory();
+    }
+
+    // Q*K' and W*V, the softmax is negligible
+    const auto flops = 2.0 * 2.0 * static_cast<double>(B * H * L * S);
+    // the traffic is dominated by the KV cache read
+    auto bytes = 2.0 * static_cast<double>(B * H * L * S * kv_prc.size());
+    if (kv_prc == ov::element::u8) {
+        bytes += 2.0 * static_cast<double>(L * B * H * 2 * sizeof(float));
+    }
+    set_throughput(state, bytes, flops);
+    state.SetLabel("kv:" + kv_prc.to_string());
+}
+
+}  // namespace
+
+BENCHMARK(MhaSingleToken)
+    ->ArgNames({"B", "H", "L", "S", "kv"})
+    ->ArgsProduct({{1, 4},
+                   {32},
+                   {1024, 8192},
+                   {128},
+                   {arg(ov::element::Type_t::f32), arg(ov::element::Type_t::f16), arg(ov::element::Type_t::u8)}})
+    ->UseRealTime();
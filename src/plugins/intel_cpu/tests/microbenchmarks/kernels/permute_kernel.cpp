@@ -0,0 +1,59 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "nodes/common/permute_kernel.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "bench_utils.hpp"
+#include "cpu_types.h"
+#include "openvino/core/type/element_type.hpp"
+
+using namespace ov::intel_cpu;
+using namespace ov::intel_cpu::bench;
+
+namespace {
+
+// the planar NCHW -> NHWC transposition
+void PermuteNchwToNhwc(benchmark::State& state) {
+    const VectorDims src_dims = {static_cast<size_t>(state.range(0)),
+                                 static_cast<size_t>(state.range(1)),
+                                 static_cast<size_t>(state.range(2)),
+                                 static_cast<size_t>(state.range(2))};
+    const auto prc = precision_arg(state, 3);
+
+    PermuteParams params;
+    params.src_block_dims = src_dims;
+    params.dst_block_dims = {src_dims[0], src_dims[2], src_dims[3], src_dims[1]};
+    params.src_block_order = {0, 1, 2, 3};
+    params.dst_block_order = {0, 1, 2, 3};
+    params.order = {0, 2, 3, 1};
+    params.data_size = prc.size();
+    PermuteKernel kernel(params);
+
+    const auto count = src_dims[0] * src_dims[1] * src_dims[2] * src_dims[3];
+    std::vector<uint8_t> src(count * prc.size());
+    std::vector<uint8_t> dst(count * prc.size());
+    fill_random(src.data(), prc, count);
+
+    for (auto _ : state) {
+        kernel.execute(src.data(), dst.data());
+        benchmark::DoNotOptimize(dst.data());
+        benchmark::ClobberMemory();
+    }
+
+    set_throughput(state, 2.0 * static_cast<double>(count * prc.size()));
+    state.SetLabel(prc.to_string());
+}
+
+}  // namespace
+
+BENCHMARK(PermuteNchwToNhwc)
+    ->ArgNames({"N", "C", "HW", "prc"})
+    ->ArgsProduct({{1}, {64, 256}, {56, 112}, {arg(ov::element::Type_t::f32), arg(ov::element::Type_t::bf16)}})
+    ->UseRealTime();
@@ -0,0 +1,45 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <benchmark/benchmark.h>
+
+#include <cstdlib>
+#include <string>
+
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/visibility.hpp"
+
+#if defined(OPENVINO_ARCH_X86_64)
+#    include <cpu/x64/cpu_isa_traits.hpp>
+#endif
+
+namespace {
+
+/**
+ * The JIT kernels are generated for the ISA limited by ONEDNN_MAX_CPU_ISA, so the same benchmark is compared between
+ * the ISAs by running the binary with the different values of the variable. The effective ISA is reported in the
+ * context to keep the results self-descriptive.
+ */
+void add_context() {
+#if defined(OPENVINO_ARCH_X86_64)
+    benchmark::AddCustomContext("cpu_isa", dnnl::impl::cpu::x64::get_isa_info());
+#endif
+    if (const char* max_isa = std::getenv("ONEDNN_MAX_CPU_ISA")) {
+        benchmark::AddCustomContext("onednn_max_cpu_isa", max_isa);
+    }
+    benchmark::AddCustomContext("threads", std::to_string(parallel_get_max_threads()));
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    add_context();
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
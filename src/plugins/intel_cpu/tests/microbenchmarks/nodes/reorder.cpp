@@ -0,0 +1,86 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "nodes/reorder.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "bench_utils.hpp"
+#include "cache/multi_cache.h"
+#include "cpu_memory.h"
+#include "cpu_shape.h"
+#include "memory_desc/cpu_memory_desc.h"
+#include "nodes/common/blocked_desc_creator.h"
+#include "onednn/dnnl.h"
+#include "openvino/core/type/element_type.hpp"
+
+using namespace ov::intel_cpu;
+using namespace ov::intel_cpu::bench;
+
+namespace {
+
+const char* layout_name(LayoutType layout) {
+    switch (layout) {
+    case LayoutType::nspc:
+        return "nspc";
+    case LayoutType::ncsp:
+        return "ncsp";
+    case LayoutType::nCsp8c:
+        return "nCsp8c";
+    case LayoutType::nCsp16c:
+    default:
+        return "nCsp16c";
+    }
+}
+
+// the layout conversion the graph inserts between the nodes with the different layouts, as the Reorder node does it
+void ReorderLayout(benchmark::State& state) {
+    const Shape shape(VectorDims{1,
+                                 static_cast<size_t>(state.range(0)),
+                                 static_cast<size_t>(state.range(1)),
+                                 static_cast<size_t>(state.range(1))});
+    const auto src_layout = static_cast<LayoutType>(state.range(2));
+    const auto dst_layout = static_cast<LayoutType>(state.range(3));
+    const auto prc = precision_arg(state, 4);
+
+    const dnnl::engine engine(dnnl::engine::kind::cpu, 0);
+    const auto& creators = BlockedDescCreator::getCommonCreators();
+    Memory src(engine, creators.at(src_layout)->createDesc(prc, shape));
+    Memory dst(engine, creators.at(dst_layout)->createDesc(prc, shape));
+    fill_random(src.getData(), prc, shape.getElementsCount());
+    // the primitive is created once, as it is done for the static shapes by the node
+    auto cache = std::make_shared<MultiCache>(16);
+
+    for (auto _ : state) {
+        Reorder::reorderData(src, dst, cache);
+        benchmark::ClobberMemory();
+    }
+
+    set_throughput(state, static_cast<double>(src.getSize() + dst.getSize()));
+    state.SetLabel(std::string(layout_name(src_layout)) + "->" + layout_name(dst_layout) + ":" + prc.to_string());
+}
+
+void ReorderLayoutArgs(benchmark::internal::Benchmark* b) {
+    const auto ncsp = static_cast<int64_t>(LayoutType::ncsp);
+    const auto nspc = static_cast<int64_t>(LayoutType::nspc);
+    const auto blocked = static_cast<int64_t>(LayoutType::nCsp16c);
+    b->ArgNames({"C", "HW", "src", "dst", "prc"});
+    for (auto prc : {ov::element::Type_t::f32, ov::element::Type_t::bf16}) {
+        for (int64_t C : {64, 256}) {
+            b->Args({C, 56, ncsp, blocked, arg(prc)});
+            b->Args({C, 56, blocked, ncsp, arg(prc)});
+            b->Args({C, 56, ncsp, nspc, arg(prc)});
+            b->Args({C, 56, nspc, ncsp, arg(prc)});
+        }
+    }
+}
+
+}  // namespace
+
+BENCHMARK(ReorderLayout)->Apply(ReorderLayoutArgs)->UseRealTime();
@@ -5,6 +5,8 @@
 #include <gtest/gtest.h>
 
 #include <atomic>
+#include <cstdint>
+#include <cstring>
 #include <thread>
 
 #include "cpu_memory.h"
@@ -102,3 +104,26 @@ TEST(StaticMemoryTest, UnsupportedDnnlPrecision) {
     ASSERT_THROW(dnnl_memory = testMemory->getPrimitive(), ov::Exception);
     ASSERT_FALSE(dnnl_memory);
 }
+
+TEST(MemoryBlockWithReuseTest, HugePagesBackOnlyLargeBlocks) {
+    constexpr size_t hugePageSize = MemoryBlockWithReuse::hugePageSize;
+    MemoryBlockWithReuse small(-1, true);
+    small.resize(hugePageSize / 2);
+    ASSERT_EQ(small.size(), hugePageSize / 2);
+    ASSERT_LT(small.pageSize(), hugePageSize);
+
+    MemoryBlockWithReuse large(-1, true);
+    large.resize(2 * hugePageSize + 1);
+    ASSERT_EQ(large.size(), 2 * hugePageSize + 1);
+    // the whole block is writable, even if the system has no huge pages and the regular ones are used
+    std::memset(large.getRawPtr(), 1, large.size());
+    const auto pageSize = large.pageSize();
+    ASSERT_GT(pageSize, 0u);
+    ASSERT_LE(pageSize, hugePageSize);
+    if (pageSize == hugePageSize) {
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(large.getRawPtr()) % hugePageSize, 0u);
+    }
+
+    large.free();
+    ASSERT_EQ(large.pageSize(), 0u);
+}
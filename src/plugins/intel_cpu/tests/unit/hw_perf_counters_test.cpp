@@ -0,0 +1,69 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <thread>
+
+#include "hw_perf_counters.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+class HwPerfCountersTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        if (!HwPerfCounters::instance().available()) {
+            GTEST_SKIP() << "perf_event_open is not available";
+        }
+    }
+
+    static uint64_t delta(const HwPerfCounters::Sample& start,
+                          const HwPerfCounters::Sample& finish,
+                          HwPerfCounters::Event event) {
+        return finish[event] - start[event];
+    }
+
+    // at least one instruction per iteration
+    static void work(uint64_t iterations) {
+        volatile uint64_t sum = 0;
+        for (uint64_t i = 0; i < iterations; i++) {
+            sum = sum + i;
+        }
+    }
+
+    static constexpr uint64_t iterations = 10000000;
+};
+
+}  // namespace
+
+TEST_F(HwPerfCountersTest, CountsCallingThread) {
+    const auto& counters = HwPerfCounters::instance();
+    const auto start = counters.read();
+    work(iterations);
+    const auto finish = counters.read();
+
+    EXPECT_GE(delta(start, finish, HwPerfCounters::INSTRUCTIONS), iterations);
+    EXPECT_GT(delta(start, finish, HwPerfCounters::CYCLES), 0u);
+}
+
+TEST_F(HwPerfCountersTest, OtherThreadsAreNotCounted) {
+    const auto& counters = HwPerfCounters::instance();
+    uint64_t workerInstructions = 0;
+
+    const auto start = counters.read();
+    std::thread worker([&]() {
+        const auto workerStart = counters.read();
+        work(iterations);
+        workerInstructions = delta(workerStart, counters.read(), HwPerfCounters::INSTRUCTIONS);
+    });
+    worker.join();
+    const auto finish = counters.read();
+
+    EXPECT_GE(workerInstructions, iterations);
+    // the calling thread is only blocked in join meanwhile
+    EXPECT_LT(delta(start, finish, HwPerfCounters::INSTRUCTIONS), iterations / 10);
+}
@@ -0,0 +1,108 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "config.h"
+#include "openvino/core/model.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/result.hpp"
+#include "utils/kernel_warmup_cache.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+std::shared_ptr<ov::Model> makeModel(const std::string& name) {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{-1, 3, -1});
+    auto relu = std::make_shared<ov::op::v0::Relu>(param);
+    relu->set_friendly_name(name);
+    auto result = std::make_shared<ov::op::v0::Result>(relu);
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
+}
+
+class KernelWarmupCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_cacheDir = std::filesystem::temp_directory_path().string();
+    }
+
+    void TearDown() override {
+        for (const auto& path : m_files) {
+            std::remove(path.c_str());
+        }
+    }
+
+    KernelWarmupCache::Ptr makeCache(const ov::Model& model) {
+        auto cache = std::make_shared<KernelWarmupCache>(m_cacheDir, model, m_config);
+        m_files.push_back(cache->path());
+        return cache;
+    }
+
+    std::string m_cacheDir;
+    Config m_config;
+    std::vector<std::string> m_files;
+};
+
+}  // namespace
+
+TEST_F(KernelWarmupCacheTest, RecordAndLoad) {
+    auto model = makeModel("relu_record_and_load");
+    std::remove(KernelWarmupCache(m_cacheDir, *model, m_config).path().c_str());
+
+    {
+        auto cache = makeCache(*model);
+        cache->record({ov::Shape{1, 3, 10}});
+        cache->record({ov::Shape{2, 3, 20}});
+        cache->record({ov::Shape{1, 3, 10}});
+    }
+
+    // the records are persistent, a new instance for the same model reads them back
+    auto cache = makeCache(*model);
+    const auto records = cache->load();
+    ASSERT_EQ(records.size(), 2u);
+    EXPECT_EQ(records[0], KernelWarmupCache::InputShapes{ov::Shape({1, 3, 10})});
+    EXPECT_EQ(records[1], KernelWarmupCache::InputShapes{ov::Shape({2, 3, 20})});
+}
+
+TEST_F(KernelWarmupCacheTest, ModelKey) {
+    auto first = makeCache(*makeModel("relu_model_key_first"));
+    auto second = makeCache(*makeModel("relu_model_key_second"));
+    EXPECT_NE(first->path(), second->path());
+    EXPECT_EQ(first->path(), makeCache(*makeModel("relu_model_key_first"))->path());
+}
+
+TEST_F(KernelWarmupCacheTest, SkipMalformed) {
+    auto model = makeModel("relu_skip_malformed");
+    const auto path = KernelWarmupCache(m_cacheDir, *model, m_config).path();
+    {
+        std::ofstream file(path, std::ios_base::trunc);
+        file << "1,3,x\n" << "1,3,4;1,3,4\n" << "4,3,2\n";
+    }
+
+    auto cache = makeCache(*model);
+    const auto records = cache->load();
+    ASSERT_EQ(records.size(), 1u);
+    EXPECT_EQ(records[0], KernelWarmupCache::InputShapes{ov::Shape({4, 3, 2})});
+}
+
+TEST_F(KernelWarmupCacheTest, Capacity) {
+    auto model = makeModel("relu_capacity");
+    std::remove(KernelWarmupCache(m_cacheDir, *model, m_config).path().c_str());
+
+    auto cache = makeCache(*model);
+    for (size_t i = 1; i <= KernelWarmupCache::maxRecords + 10; ++i) {
+        cache->record({ov::Shape{i, 3, 1}});
+    }
+    EXPECT_TRUE(cache->isFull());
+    EXPECT_EQ(cache->load().size(), KernelWarmupCache::maxRecords);
+}
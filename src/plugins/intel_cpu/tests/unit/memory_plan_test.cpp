@@ -0,0 +1,127 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "memory_control.hpp"
+#include "memory_plan.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "utils/codec_xor.hpp"
+#include "utils/serialize.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+constexpr int64_t alignment = 32;  // the alignment of the static regions applied by the memory control
+
+// a chain of the tensors, each is alive while it is consumed by the next node
+MemoryRegions makeRegions() {
+    return {{0, 1, 1024, 0, MemoryRegion::RegionType::VARIABLE, MemoryRegion::AllocType::POD},
+            {1, 2, 2048, 1, MemoryRegion::RegionType::VARIABLE, MemoryRegion::AllocType::POD},
+            {2, 3, 1024, 2, MemoryRegion::RegionType::VARIABLE, MemoryRegion::AllocType::POD},
+            {3, 4, 512, 3, MemoryRegion::RegionType::VARIABLE, MemoryRegion::AllocType::POD}};
+}
+
+StaticMemoryPlan solvePlan(MemoryPlans plans, const MemoryRegions& regions) {
+    NetworkMemoryControl networkControl(std::move(plans));
+    auto control = networkControl.createMemoryControlUnit("main");
+    control->insert(regions, {});
+    control->solve();
+    return control->getStaticMemoryPlan();
+}
+
+// a valid plan the solver would not produce: every region gets its own memory
+StaticMemoryPlan separatePlan(const StaticMemoryPlan& solved, const MemoryRegions& regions) {
+    StaticMemoryPlan plan = solved;
+    int64_t offset = 0;
+    for (size_t i = 0; i < regions.size(); ++i) {
+        plan.offsets[i].second = offset;
+        offset += regions[i].size;
+    }
+    plan.totalSize = offset;
+    return plan;
+}
+
+bool operator==(const StaticMemoryPlan& l, const StaticMemoryPlan& r) {
+    return l.boxesHash == r.boxesHash && l.totalSize == r.totalSize && l.offsets == r.offsets;
+}
+
+}  // namespace
+
+TEST(StaticMemoryPlanTest, ExportedPlanIsReused) {
+    const auto regions = makeRegions();
+    const auto solved = solvePlan({}, regions);
+    ASSERT_EQ(solved.offsets.size(), regions.size());
+    // the tensors alive at different times share the memory
+    ASSERT_LT(solved.totalSize, 1024 + 2048 + 1024 + 512);
+
+    const auto imported = separatePlan(solved, regions);
+    ASSERT_TRUE(solvePlan({{"main", imported}}, regions) == imported);
+}
+
+TEST(StaticMemoryPlanTest, InvalidPlanFallsBackToSolver) {
+    const auto regions = makeRegions();
+    const auto solved = solvePlan({}, regions);
+
+    // the plan was computed for the other regions
+    auto changedRegions = regions;
+    changedRegions[1].size += alignment;
+    ASSERT_FALSE(solvePlan({{"main", solved}}, changedRegions) == solved);
+    ASSERT_TRUE(solvePlan({{"main", solved}}, changedRegions) == solvePlan({}, changedRegions));
+
+    auto corrupted = separatePlan(solved, regions);
+    corrupted.boxesHash ^= 1;
+    ASSERT_TRUE(solvePlan({{"main", corrupted}}, regions) == solved);
+
+    auto outOfBounds = separatePlan(solved, regions);
+    outOfBounds.offsets.back().second = outOfBounds.totalSize;
+    ASSERT_TRUE(solvePlan({{"main", outOfBounds}}, regions) == solved);
+
+    // the regions 0 and 1 are alive at the same time (step 1)
+    auto overlapping = separatePlan(solved, regions);
+    overlapping.offsets[1].second = overlapping.offsets[0].second + alignment;
+    ASSERT_TRUE(solvePlan({{"main", overlapping}}, regions) == solved);
+}
+
+TEST(StaticMemoryPlanTest, PlansAreStoredInBlob) {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 8});
+    auto relu = std::make_shared<ov::op::v0::Relu>(param);
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{relu}, ov::ParameterVector{param});
+
+    MemoryPlans plans;
+    plans["main"] = solvePlan({}, makeRegions());
+    plans["sub"] = {42, 64, {{7, 0}, {8, 32}}};
+
+    std::stringstream blob;
+    ModelSerializer serializer(blob);
+    serializer.set_memory_plans(plans);
+    serializer << model;
+
+    ModelDeserializer deserializer(
+        blob,
+        nullptr,
+        [&](const std::shared_ptr<ov::AlignedBuffer>&, const std::shared_ptr<ov::AlignedBuffer>&) {
+            return model;
+        },
+        CacheDecrypt{},
+        false);
+    std::shared_ptr<ov::Model> imported;
+    deserializer >> imported;
+
+    const auto& importedPlans = deserializer.get_memory_plans();
+    ASSERT_EQ(importedPlans.size(), plans.size());
+    for (const auto& [id, plan] : plans) {
+        ASSERT_TRUE(importedPlans.at(id) == plan) << id;
+    }
+}
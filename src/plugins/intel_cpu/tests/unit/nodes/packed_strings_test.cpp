@@ -0,0 +1,59 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "nodes/common/packed_strings.h"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+class PackedStringsTest : public ::testing::TestWithParam<size_t> {
+protected:
+    void SetUp() override {
+        strings.resize(GetParam());
+        for (size_t i = 0; i < strings.size(); i++) {
+            // the empty strings and the strings longer than the small string buffer are mixed
+            strings[i] = std::string(i % 37, static_cast<char>('a' + i % 26));
+        }
+    }
+
+    std::vector<std::string> strings;
+};
+
+TEST_P(PackedStringsTest, UnpackPack) {
+    const size_t count = strings.size();
+    const size_t length = PackedStrings::length(strings.data(), count);
+    std::vector<int32_t> begins(count);
+    std::vector<int32_t> ends(count);
+    std::vector<uint8_t> chars(length);
+    PackedStrings::unpack(strings.data(), begins.data(), ends.data(), chars.data(), count);
+
+    size_t offset = 0;
+    for (size_t i = 0; i < count; i++) {
+        ASSERT_EQ(begins[i], static_cast<int32_t>(offset));
+        offset += strings[i].length();
+        ASSERT_EQ(ends[i], static_cast<int32_t>(offset));
+        ASSERT_EQ(std::string(chars.begin() + begins[i], chars.begin() + ends[i]), strings[i]);
+    }
+    ASSERT_EQ(offset, length);
+
+    std::vector<std::string> packed(count);
+    PackedStrings::pack(begins.data(), ends.data(), chars.data(), packed.data(), count);
+    ASSERT_EQ(packed, strings);
+}
+
+// the counts of 1024 and more strings are split between the threads
+INSTANTIATE_TEST_SUITE_P(smoke_PackedStrings,
+                         PackedStringsTest,
+                         ::testing::Values(0, 1, 5, 1023, 1024, 5000),
+                         ::testing::PrintToStringParamName());
+
+}  // namespace
@@ -0,0 +1,200 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "edge.h"
+#include "graph_context.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "nodes/input.h"
+#include "nodes/reference.h"
+#include "openvino/core/parallel.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/softmax.hpp"
+#include "weights_cache.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+/*
+ * The Reference node splits the evaluation of the elementwise ops and of the ops computing along the inner axes across
+ * the threads. The results are compared with the serial evaluation of the same core op.
+ */
+class ReferenceNodeTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        if (parallel_get_max_threads() < 2) {
+            GTEST_SKIP() << "The evaluation is split across the threads only";
+        }
+        Config conf;
+        conf.rtCacheCapacity = 100;
+        context = std::make_shared<GraphContext>(conf, std::make_shared<WeightsSharing>(), false);
+    }
+
+    // runs the op in the Reference node, which is connected to the inputs and outputs directly
+    ov::TensorVector execute(const std::shared_ptr<ov::Node>& op, const ov::TensorVector& inputs) {
+        const auto& engine = context->getEngine();
+        reference = std::make_shared<node::Reference>(op, context, "");
+        std::vector<NodePtr> nodes;
+        auto connect = [](const NodePtr& parent, const NodePtr& child, int parentPort, int childPort, MemoryPtr mem) {
+            auto edge = std::make_shared<Edge>(parent, child, parentPort, childPort);
+            edge->changeStatus(Edge::Status::NeedAllocation);
+            Node::addEdge(edge);
+            edge->reuse(std::move(mem));
+        };
+        for (size_t i = 0; i < inputs.size(); i++) {
+            auto desc = std::make_shared<CpuBlockedMemoryDesc>(inputs[i].get_element_type(),
+                                                               Shape(inputs[i].get_shape()));
+            auto input = std::make_shared<node::Input>(desc, "input" + std::to_string(i), "Parameter", context);
+            auto memory = std::make_shared<Memory>(engine, desc, inputs[i].data());
+            connect(input, reference, 0, static_cast<int>(i), memory);
+            nodes.push_back(input);
+        }
+        nodes.push_back(reference);
+        ov::TensorVector outputs;
+        for (size_t i = 0; i < op->get_output_size(); i++) {
+            outputs.emplace_back(op->get_output_element_type(i), op->get_output_shape(i));
+            auto desc = std::make_shared<CpuBlockedMemoryDesc>(outputs[i].get_element_type(),
+                                                               Shape(outputs[i].get_shape()));
+            auto output = std::make_shared<node::Input>(desc, "output" + std::to_string(i), "Result", context);
+            auto memory = std::make_shared<Memory>(engine, desc, outputs[i].data());
+            connect(reference, output, static_cast<int>(i), 0, memory);
+            nodes.push_back(output);
+        }
+        for (auto& node : nodes) {
+            node->init();
+            node->getSupportedDescriptors();
+            node->initSupportedPrimitiveDescriptors();
+            node->selectPrimitiveDescriptorByIndex(0);
+        }
+        reference->createPrimitive();
+        reference->execute(dnnl::stream{engine});
+        return outputs;
+    }
+
+    static ov::TensorVector evaluateSerially(const std::shared_ptr<ov::Node>& op, const ov::TensorVector& inputs) {
+        ov::TensorVector outputs;
+        for (size_t i = 0; i < op->get_output_size(); i++) {
+            outputs.emplace_back(op->get_output_element_type(i), op->get_output_shape(i));
+        }
+        EXPECT_TRUE(op->evaluate(outputs, inputs));
+        return outputs;
+    }
+
+    int64_t parallelNodes(const std::string& opType) const {
+        const auto report = node::Reference::fallbackReport({{reference}});
+        return report.at(opType).as<ov::AnyMap>().at("PARALLEL_NODES").as<int64_t>();
+    }
+
+    static ov::Tensor makeTensor(const ov::Shape& shape, float start) {
+        ov::Tensor tensor(ov::element::f32, shape);
+        auto* data = tensor.data<float>();
+        for (size_t i = 0; i < tensor.get_size(); i++) {
+            data[i] = start + static_cast<float>(i % 113) * 0.25F;
+        }
+        return tensor;
+    }
+
+    static void compare(const ov::Tensor& expected, const ov::Tensor& actual) {
+        ASSERT_EQ(expected.get_shape(), actual.get_shape());
+        ASSERT_EQ(expected.get_byte_size(), actual.get_byte_size());
+        const auto* expectedData = static_cast<const float*>(expected.data());
+        const auto* actualData = static_cast<const float*>(actual.data());
+        for (size_t i = 0; i < expected.get_size(); i++) {
+            ASSERT_EQ(expectedData[i], actualData[i]) << "mismatch at position " << i;
+        }
+    }
+
+    GraphContext::CPtr context;
+    std::shared_ptr<node::Reference> reference;
+};
+
+TEST_F(ReferenceNodeTest, ElementwiseWithBroadcastInput) {
+    // the size is not a multiple of the 64 elements chunk alignment, the single element input is broadcast
+    const ov::Shape shape{17, 4099};
+    auto op =
+        std::make_shared<ov::op::v1::Add>(std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape),
+                                          std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1}));
+    const ov::TensorVector inputs{makeTensor(shape, -3.F), makeTensor(ov::Shape{1}, 0.5F)};
+
+    const auto outputs = execute(op, inputs);
+    compare(evaluateSerially(op, inputs)[0], outputs[0]);
+    ASSERT_EQ(parallelNodes("Add"), 1);
+}
+
+TEST_F(ReferenceNodeTest, ReportCombinesGraphsOfModel) {
+    const ov::Shape shape{17, 4099};
+    auto op = std::make_shared<ov::op::v1::Add>(std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape),
+                                                std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape));
+    execute(op, {makeTensor(shape, -3.F), makeTensor(shape, 1.F)});
+
+    // the graphs of the streams have the same nodes, which are counted once
+    const auto report = node::Reference::fallbackReport({{reference}, {reference}});
+    const auto addReport = report.at("Add").as<ov::AnyMap>();
+    ASSERT_EQ(addReport.at("NODES").as<int64_t>(), 1);
+    ASSERT_EQ(addReport.at("PARALLEL_NODES").as<int64_t>(), 1);
+}
+
+TEST_F(ReferenceNodeTest, ElementwiseBelowThresholdIsSerial) {
+    const ov::Shape shape{2, 1024};
+    auto op = std::make_shared<ov::op::v1::Add>(std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape),
+                                                std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape));
+    const ov::TensorVector inputs{makeTensor(shape, -3.F), makeTensor(shape, 1.F)};
+
+    const auto outputs = execute(op, inputs);
+    compare(evaluateSerially(op, inputs)[0], outputs[0]);
+    ASSERT_EQ(parallelNodes("Add"), 0);
+}
+
+TEST_F(ReferenceNodeTest, ElementwiseChunkErrorIsRethrown) {
+    const ov::Shape shape{16, 4096};
+    auto op = std::make_shared<ov::op::v1::Divide>(std::make_shared<ov::op::v0::Parameter>(ov::element::i32, shape),
+                                                   std::make_shared<ov::op::v0::Parameter>(ov::element::i32, shape));
+    ov::Tensor dividend(ov::element::i32, shape);
+    ov::Tensor divisor(ov::element::i32, shape);
+    std::fill_n(dividend.data<int32_t>(), dividend.get_size(), 7);
+    std::fill_n(divisor.data<int32_t>(), divisor.get_size(), 2);
+    // the division by zero in the last chunk only
+    divisor.data<int32_t>()[divisor.get_size() - 1] = 0;
+
+    ASSERT_THROW(execute(op, {dividend, divisor}), std::domain_error);
+}
+
+TEST_F(ReferenceNodeTest, OuterSplitAfterUnitDims) {
+    // the split axis is the first non unit one, the softmax is computed along the innermost axis
+    const ov::Shape shape{1, 67, 1000};
+    auto op = std::make_shared<ov::op::v8::Softmax>(std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape),
+                                                    -1);
+    const ov::TensorVector inputs{makeTensor(shape, -10.F)};
+
+    const auto outputs = execute(op, inputs);
+    compare(evaluateSerially(op, inputs)[0], outputs[0]);
+    ASSERT_EQ(parallelNodes("Softmax"), 1);
+}
+
+TEST_F(ReferenceNodeTest, OuterAlongDependentAxisIsSerial) {
+    // the softmax is computed along the first non unit axis, so it can not be split
+    const ov::Shape shape{1, 67, 1000};
+    auto op = std::make_shared<ov::op::v8::Softmax>(std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape),
+                                                    1);
+    const ov::TensorVector inputs{makeTensor(shape, -10.F)};
+
+    const auto outputs = execute(op, inputs);
+    compare(evaluateSerially(op, inputs)[0], outputs[0]);
+    ASSERT_EQ(parallelNodes("Softmax"), 0);
+}
+
+}  // namespace
@@ -0,0 +1,65 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include "nodes/common/segment_reduce.h"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+TEST(SegmentReduceTest, SplitCoversAllSegmentsOnce) {
+    const std::vector<size_t> rows{0, 5, 1000, 0, 0, 3, 7, 1, 0, 2000, 4};
+    SegmentReduce segments(rows.size());
+    for (size_t i = 0; i < rows.size(); i++) {
+        segments.setRows(i, rows[i]);
+    }
+    segments.computeWork();
+
+    for (int nthr = 1; nthr <= 16; nthr++) {
+        size_t expectedStart = 0;
+        for (int ithr = 0; ithr < nthr; ithr++) {
+            size_t start = 0;
+            size_t end = 0;
+            segments.split(nthr, ithr, start, end);
+            ASSERT_EQ(start, expectedStart) << "nthr: " << nthr << " ithr: " << ithr;
+            ASSERT_LE(start, end);
+            expectedStart = end;
+        }
+        ASSERT_EQ(expectedStart, rows.size()) << "nthr: " << nthr;
+    }
+}
+
+TEST(SegmentReduceTest, SplitBalancesSkewedSegments) {
+    // a single long segment followed by many short ones
+    constexpr size_t segmentsNum = 1001;
+    SegmentReduce segments(segmentsNum);
+    segments.setRows(0, 1000);
+    for (size_t i = 1; i < segmentsNum; i++) {
+        segments.setRows(i, 1);
+    }
+    segments.computeWork();
+
+    size_t start = 0;
+    size_t end = 0;
+    segments.split(2, 0, start, end);
+    // the work of a segment is its rows and the output row: 1001 for the long one and 2 for each short one, so the first
+    // thread gets 250 short segments instead of the half of them
+    ASSERT_EQ(start, 0U);
+    ASSERT_EQ(end, 251U);
+}
+
+TEST(SegmentReduceTest, MaxRowSkipsNaN) {
+    std::vector<float> dst{1.F, 2.F, 3.F};
+    const std::vector<float> src{0.F, std::numeric_limits<float>::quiet_NaN(), 4.F};
+    maxRow(dst.data(), src.data(), dst.size());
+    ASSERT_EQ(dst, (std::vector<float>{1.F, 2.F, 4.F}));
+}
+
+}  // namespace
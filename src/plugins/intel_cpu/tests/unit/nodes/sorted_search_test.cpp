@@ -0,0 +1,97 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "nodes/common/sorted_search.h"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+class SortedSearchTest : public ::testing::TestWithParam<size_t> {
+protected:
+    void SetUp() override {
+        std::mt19937 generator(42);
+        // the duplicates and the values between the elements are covered by the half steps
+        std::uniform_int_distribution<int> distribution(-100, 100);
+        sorted.resize(GetParam());
+        for (auto& element : sorted) {
+            element = static_cast<float>(distribution(generator)) * 0.5F;
+        }
+        std::sort(sorted.begin(), sorted.end());
+        values.resize(std::max<size_t>(GetParam(), 1000));
+        for (auto& value : values) {
+            value = static_cast<float>(distribution(generator)) * 0.25F;
+        }
+        values[0] = std::numeric_limits<float>::quiet_NaN();
+        values[1] = -std::numeric_limits<float>::infinity();
+        values[2] = std::numeric_limits<float>::infinity();
+    }
+
+    template <typename Precedes, typename Reference>
+    void check(const Precedes& precedes, const Reference& reference) {
+        const SortedSearch<float> search(sorted.data(), sorted.size(), values.size());
+        std::vector<int64_t> out(values.size());
+        search.findAll(values.data(), out.data(), values.size(), precedes);
+        for (size_t i = 0; i < values.size(); i++) {
+            ASSERT_EQ(out[i], reference(values[i])) << "value: " << values[i];
+        }
+    }
+
+    std::vector<float> sorted;
+    std::vector<float> values;
+};
+
+TEST_P(SortedSearchTest, LowerBound) {
+    check(std::less<>(), [&](float value) {
+        return std::lower_bound(sorted.begin(), sorted.end(), value) - sorted.begin();
+    });
+}
+
+TEST_P(SortedSearchTest, UpperBound) {
+    check(NotGreater(), [&](float value) {
+        return std::upper_bound(sorted.begin(), sorted.end(), value) - sorted.begin();
+    });
+}
+
+TEST_P(SortedSearchTest, LessEqual) {
+    check(std::less_equal<>(), [&](float value) {
+        return std::lower_bound(sorted.begin(), sorted.end(), value, std::less_equal<>()) - sorted.begin();
+    });
+}
+
+TEST_P(SortedSearchTest, Rows) {
+    constexpr size_t rows = 4;
+    const size_t sortedRowSize = sorted.size() / rows;
+    const size_t valuesRowSize = values.size() / rows;
+    // the NaN has no place in the sorted rows
+    values[0] = 0.0F;
+    for (size_t row = 0; row < rows; row++) {
+        std::sort(values.begin() + row * valuesRowSize, values.begin() + (row + 1) * valuesRowSize);
+    }
+    std::vector<int32_t> out(rows * valuesRowSize);
+    searchSortedRows(sorted.data(), sortedRowSize, values.data(), out.data(), valuesRowSize, rows, std::less<>());
+    for (size_t i = 0; i < out.size(); i++) {
+        const auto begin = sorted.begin() + (i / valuesRowSize) * sortedRowSize;
+        ASSERT_EQ(out[i], std::lower_bound(begin, begin + sortedRowSize, values[i]) - begin);
+    }
+}
+
+// the sizes of 8192 and more floats (32 KB) are searched in the Eytzinger order
+INSTANTIATE_TEST_SUITE_P(smoke_SortedSearch,
+                         SortedSearchTest,
+                         ::testing::Values(0, 1, 2, 3, 17, 1000, 8192, 20000),
+                         ::testing::PrintToStringParamName());
+
+}  // namespace
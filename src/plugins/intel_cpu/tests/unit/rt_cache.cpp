@@ -7,6 +7,7 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include "cache/clock_cache.h"
 #include "cache/lru_cache.h"
 #include "cache/multi_cache.h"
 #include "common_test_utils/test_assertions.hpp"
@@ -97,6 +98,107 @@ TEST(LruCacheTests, Empty) {
         ASSERT_EQ(cache.get({i}), int());
     }
 }
+TEST(ClockCacheTests, Evict) {
+    constexpr size_t capacity = 10;
+    ClockCache<IntKey, int> cache(capacity);
+    for (size_t i = 0; i < 2 * capacity; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({10}, 10));
+    }
+    ASSERT_EQ(cache.getSize(), 1);
+    OV_ASSERT_NO_THROW(cache.evict(5));
+    OV_ASSERT_NO_THROW(cache.evict(10));
+    int result = cache.get({10});
+    ASSERT_EQ(result, int());
+    ASSERT_EQ(cache.getSize(), 0);
+    ASSERT_EQ(cache.getEvictionsCount(), 1);
+    OV_ASSERT_NO_THROW(cache.evict(0));
+}
+
+TEST(ClockCacheTests, Get) {
+    constexpr int capacity = 10;
+    ClockCache<IntKey, int> cache(capacity);
+    for (int i = 1; i < 2 * capacity; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 1; i < capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+
+    for (int i = capacity; i < 2 * capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), i);
+    }
+    ASSERT_EQ(cache.getEvictionsCount(), capacity - 1);
+}
+
+TEST(ClockCacheTests, ClockPolicy) {
+    constexpr int capacity = 10;
+    ClockCache<IntKey, int> cache(capacity);
+    for (int i = 0; i < capacity; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    // referenced records get the second chance
+    for (int i = 4; i < capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), i);
+    }
+
+    for (int i = 21; i < 25; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+
+    for (int i = 4; i < capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), i);
+    }
+}
+
+TEST(ClockCacheTests, Empty) {
+    constexpr size_t capacity = 0;
+    constexpr int attempts = 10;
+    ClockCache<IntKey, int> cache(capacity);
+    for (int i = 1; i < attempts; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 1; i < attempts; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+}
+
+TEST(ClockCacheTests, SmokeConcurrentAccess) {
+    constexpr size_t capacity = 1000;
+    constexpr int numKeys = 1500;
+    constexpr int numIterations = 10000;
+    constexpr size_t numThreads = 8;
+    ClockCache<IntKey, int> cache(capacity);
+
+    auto testRoutine = [&](int seed) {
+        for (int i = 0; i < numIterations; ++i) {
+            const int key = (seed * 7919 + i) % numKeys;
+            const int value = cache.get({key});
+            if (value == int()) {
+                cache.put({key}, key + 1);
+            } else {
+                ASSERT_EQ(value, key + 1);
+            }
+        }
+    };
+
+    std::vector<std::thread> vecThreads;
+    vecThreads.reserve(numThreads);
+    for (size_t i = 0; i < numThreads; ++i) {
+        vecThreads.emplace_back(testRoutine, static_cast<int>(i));
+    }
+    for (auto& thread : vecThreads) {
+        thread.join();
+    }
+    ASSERT_LE(cache.getSize(), capacity);
+}
+
 namespace {
 template<typename T, typename K>
 class mockBuilder {
@@ -380,3 +482,50 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
         vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
     }
 }
+
+TEST(MultiCacheTests, Statistics) {
+    constexpr int capacity = 10;
+
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+    auto strBuilder = [&](const StringKey& key) { return std::make_shared<std::string>(key.data); };
+
+    MultiCache cache(capacity);
+    for (int i = 0; i < 2 * capacity; ++i) {
+        cache.getOrCreate(IntKey{i}, intBuilder);
+    }
+    for (int i = capacity; i < 2 * capacity; ++i) {
+        cache.getOrCreate(IntKey{i}, intBuilder);
+    }
+    cache.getOrCreate(StringKey{"0"}, strBuilder);
+
+    const auto stats = cache.getStatistics();
+    ASSERT_EQ(stats.hits, capacity);
+    ASSERT_EQ(stats.misses, 2 * capacity + 1);
+    ASSERT_EQ(stats.evictions, capacity);
+    ASSERT_EQ(stats.size, capacity + 1);
+}
+
+TEST(MultiCacheTests, SmokeSharedInstance) {
+    using IntValueType = std::shared_ptr<int>;
+
+    constexpr int capacity = 100;
+    constexpr size_t numThreads = 16;
+
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    MultiCache cache(capacity);
+
+    auto testRoutine = [&]() {
+        for (int i = 0; i < 2 * capacity; ++i) {
+            auto intResult = cache.getOrCreate(IntKey{i % capacity}, intBuilder);
+            ASSERT_NE(intResult.first, IntValueType());
+            ASSERT_EQ(*intResult.first, i % capacity);
+        }
+    };
+
+    std::vector<ScopedThread> vecThreads;
+    vecThreads.reserve(numThreads);
+    for (size_t i = 0; i < numThreads; ++i) {
+        vecThreads.emplace_back(std::thread(testRoutine));
+    }
+}
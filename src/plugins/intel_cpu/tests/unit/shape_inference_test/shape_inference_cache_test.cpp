@@ -0,0 +1,105 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "openvino/core/coordinate_diff.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/max_pool.hpp"
+#include "openvino/op/parameter.hpp"
+#include "shape_inference/shape_inference.hpp"
+#include "shape_inference/shape_inference_cache.hpp"
+
+using namespace ov;
+using namespace ov::intel_cpu;
+
+namespace {
+
+// doubles the first dimension, counts the invocations
+class CountingShapeInfer final : public ShapeInferEmptyPads {
+public:
+    Result infer(const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes,
+                 const std::unordered_map<size_t, MemoryPtr>&) override {
+        ++calls;
+        auto dims = input_shapes.front().get();
+        dims[0] *= 2;
+        return {{dims}, ShapeInferStatus::success};
+    }
+    [[nodiscard]] port_mask_t get_port_mask() const override {
+        return EMPTY_PORT_MASK;
+    }
+
+    int calls = 0;
+};
+
+IShapeInfer::Result inferShapes(IShapeInfer& shapeInfer, const VectorDims& dims) {
+    return shapeInfer.infer({std::cref(dims)}, {});
+}
+
+}  // namespace
+
+TEST(ShapeInferWithCacheTest, RepeatedShapesAreNotInferred) {
+    auto counting = std::make_shared<CountingShapeInfer>();
+    ShapeInferWithCache shapeInfer(counting, 2);
+
+    EXPECT_EQ(inferShapes(shapeInfer, {1, 8}).dims.front(), VectorDims({2, 8}));
+    EXPECT_EQ(inferShapes(shapeInfer, {4, 8}).dims.front(), VectorDims({8, 8}));
+    EXPECT_EQ(counting->calls, 2);
+
+    EXPECT_EQ(inferShapes(shapeInfer, {1, 8}).dims.front(), VectorDims({2, 8}));
+    EXPECT_EQ(inferShapes(shapeInfer, {4, 8}).dims.front(), VectorDims({8, 8}));
+    EXPECT_EQ(counting->calls, 2);
+
+    // the least recently used {1, 8} is evicted
+    EXPECT_EQ(inferShapes(shapeInfer, {3, 8}).dims.front(), VectorDims({6, 8}));
+    EXPECT_EQ(inferShapes(shapeInfer, {1, 8}).dims.front(), VectorDims({2, 8}));
+    EXPECT_EQ(counting->calls, 4);
+}
+
+TEST(ShapeInferWithCacheTest, PaddingsFollowCachedShapes) {
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic(4));
+    auto maxPool = std::make_shared<op::v8::MaxPool>(data,
+                                                     Strides{2, 2},
+                                                     Strides{1, 1},
+                                                     ov::Shape{0, 0},
+                                                     ov::Shape{0, 0},
+                                                     ov::Shape{3, 3},
+                                                     op::RoundingType::FLOOR,
+                                                     op::PadType::SAME_UPPER);
+    ShapeInferWithCache shapeInfer(make_shape_inference(maxPool));
+
+    EXPECT_EQ(inferShapes(shapeInfer, {1, 3, 8, 8}).dims.front(), VectorDims({1, 3, 4, 4}));
+    EXPECT_EQ(shapeInfer.get_pads_begin(), CoordinateDiff({0, 0}));
+    EXPECT_EQ(shapeInfer.get_pads_end(), CoordinateDiff({1, 1}));
+
+    EXPECT_EQ(inferShapes(shapeInfer, {1, 3, 9, 9}).dims.front(), VectorDims({1, 3, 5, 5}));
+    EXPECT_EQ(shapeInfer.get_pads_begin(), CoordinateDiff({1, 1}));
+    EXPECT_EQ(shapeInfer.get_pads_end(), CoordinateDiff({1, 1}));
+
+    // the cached shapes, the paddings must correspond to them as well
+    EXPECT_EQ(inferShapes(shapeInfer, {1, 3, 8, 8}).dims.front(), VectorDims({1, 3, 4, 4}));
+    EXPECT_EQ(shapeInfer.get_pads_begin(), CoordinateDiff({0, 0}));
+    EXPECT_EQ(shapeInfer.get_pads_end(), CoordinateDiff({1, 1}));
+}
+
+TEST(ShapeInferWithCacheTest, OnlyRequestedCachingIsApplied) {
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic(4));
+    auto maxPool = std::make_shared<op::v8::MaxPool>(data,
+                                                     Strides{2, 2},
+                                                     Strides{1, 1},
+                                                     ov::Shape{0, 0},
+                                                     ov::Shape{0, 0},
+                                                     ov::Shape{3, 3});
+    auto add = std::make_shared<op::v1::Add>(data, data);
+
+    EXPECT_FALSE(std::dynamic_pointer_cast<ShapeInferWithCache>(NgraphShapeInferFactory(maxPool).makeShapeInfer()));
+    EXPECT_TRUE(
+        std::dynamic_pointer_cast<ShapeInferWithCache>(NgraphShapeInferFactory(maxPool).makeCachedShapeInfer()));
+    // the element-wise shape inference is not worth caching
+    EXPECT_FALSE(std::dynamic_pointer_cast<ShapeInferWithCache>(NgraphShapeInferFactory(add).makeCachedShapeInfer()));
+}
@@ -0,0 +1,206 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "weights_cache.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+class RepackedWeightsSharingTest : public ::testing::Test {
+protected:
+    MemoryPtr makeSource(float value) {
+        auto memory = std::make_shared<Memory>(eng, desc);
+        auto* data = memory->getDataAs<float>();
+        std::fill(data, data + desc->getShape().getElementsCount(), value);
+        return memory;
+    }
+
+    // "repacking" is a plain copy, counts the invocations
+    WeightsSharing::SharedMemory::Ptr repack(WeightsSharing& cache, const MemoryPtr& source) {
+        auto create = [&]() {
+            ++repacks;
+            auto memory = std::make_shared<Memory>(eng, desc);
+            std::memcpy(memory->getData(), source->getData(), source->getSize());
+            return memory;
+        };
+        const auto key = std::to_string(reinterpret_cast<uintptr_t>(source->getData()));
+        return cache.findOrCreateRepacked(key, source, desc, "copy", create);
+    }
+
+    static std::vector<std::string> persistedFiles(const std::string& dir) {
+        std::vector<std::string> files;
+        for (const auto& entry : std::filesystem::directory_iterator(dir)) {
+            if (entry.path().extension() == ".cpu_weights" &&
+                entry.path().filename().string().rfind("copy_", 0) == 0) {
+                files.push_back(entry.path().string());
+            }
+        }
+        return files;
+    }
+
+    static void removePersisted(const std::string& dir) {
+        for (const auto& path : persistedFiles(dir)) {
+            std::remove(path.c_str());
+        }
+    }
+
+    dnnl::engine eng{dnnl::engine::kind::cpu, 0};
+    MemoryDescPtr desc = std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, Shape{16, 4});
+    int repacks = 0;
+};
+
+}  // namespace
+
+TEST_F(RepackedWeightsSharingTest, SameContentIsShared) {
+    WeightsSharing first(0, true);
+    WeightsSharing second(0, true);
+    // the same weights in the different buffers, i.e. the model was read twice
+    auto source1 = makeSource(1.5f);
+    auto source2 = makeSource(1.5f);
+
+    MemoryPtr repacked1 = *repack(first, source1);
+    MemoryPtr repacked2 = *repack(second, source2);
+    ASSERT_EQ(repacked1, repacked2);
+    ASSERT_EQ(repacks, 1);
+
+    MemoryPtr other = *repack(second, makeSource(2.5f));
+    ASSERT_NE(other, repacked1);
+    ASSERT_EQ(repacks, 2);
+}
+
+TEST_F(RepackedWeightsSharingTest, DisabledByDefault) {
+    WeightsSharing first;
+    WeightsSharing second;
+    auto source1 = makeSource(3.5f);
+    auto source2 = makeSource(3.5f);
+
+    MemoryPtr repacked1 = *repack(first, source1);
+    MemoryPtr repacked2 = *repack(second, source2);
+    ASSERT_NE(repacked1, repacked2);
+    ASSERT_EQ(repacks, 2);
+}
+
+TEST_F(RepackedWeightsSharingTest, ReleasedWithLastUser) {
+    auto source = makeSource(4.5f);
+    {
+        WeightsSharing cache(0, true);
+        MemoryPtr repacked = *repack(cache, source);
+    }
+    WeightsSharing cache(0, true);
+    MemoryPtr repacked = *repack(cache, source);
+    ASSERT_EQ(repacks, 2);
+}
+
+TEST_F(RepackedWeightsSharingTest, Persistence) {
+    const auto dir = std::filesystem::temp_directory_path().string();
+    auto source = makeSource(5.5f);
+    {
+        WeightsSharing cache(0, true, dir);
+        MemoryPtr repacked = *repack(cache, source);
+        ASSERT_EQ(repacks, 1);
+    }
+
+    // the next "process" maps the stored weights instead of repacking
+    WeightsSharing cache(0, true, dir);
+    MemoryPtr repacked = *repack(cache, source);
+    ASSERT_EQ(repacks, 1);
+    ASSERT_EQ(repacked->getSize(), source->getSize());
+    ASSERT_EQ(std::memcmp(repacked->getData(), source->getData(), source->getSize()), 0);
+
+    removePersisted(dir);
+}
+
+TEST_F(RepackedWeightsSharingTest, PersistedFileIsVerified) {
+    const auto dir = std::filesystem::temp_directory_path().string();
+    auto source = makeSource(6.5f);
+    {
+        WeightsSharing cache(0, true, dir);
+        MemoryPtr repacked = *repack(cache, source);
+    }
+    // the file produced by the other layout version is repacked
+    for (const auto& path : persistedFiles(dir)) {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        const uint32_t version = 0xFFFFFFFF;
+        file.seekp(8);
+        file.write(reinterpret_cast<const char*>(&version), sizeof(version));
+    }
+    {
+        WeightsSharing cache(0, true, dir);
+        MemoryPtr repacked = *repack(cache, source);
+        ASSERT_EQ(repacks, 2);
+    }
+    // and overwritten by the valid one
+    WeightsSharing cache(0, true, dir);
+    MemoryPtr repacked = *repack(cache, source);
+    ASSERT_EQ(repacks, 2);
+    ASSERT_EQ(std::memcmp(repacked->getData(), source->getData(), source->getSize()), 0);
+
+    removePersisted(dir);
+}
+
+TEST_F(RepackedWeightsSharingTest, DifferentKeysAreCreatedConcurrently) {
+    // the first repacking waits for the second one, which would dead lock under a store wide lock
+    std::promise<void> secondCreated;
+    auto secondCreatedFuture = secondCreated.get_future();
+    auto source1 = makeSource(7.5f);
+    auto source2 = makeSource(8.5f);
+
+    auto first = std::async(std::launch::async, [&]() {
+        WeightsSharing cache(0, true);
+        MemoryPtr repacked = *cache.findOrCreateRepacked("first", source1, desc, "copy", [&]() {
+            EXPECT_EQ(secondCreatedFuture.wait_for(std::chrono::seconds(30)), std::future_status::ready);
+            return std::make_shared<Memory>(eng, desc);
+        });
+        return repacked;
+    });
+    WeightsSharing cache(0, true);
+    MemoryPtr repacked = *cache.findOrCreateRepacked("second", source2, desc, "copy", [&]() {
+        secondCreated.set_value();
+        return std::make_shared<Memory>(eng, desc);
+    });
+    ASSERT_NE(first.get(), repacked);
+}
+
+TEST_F(RepackedWeightsSharingTest, HashCollisionIsNotShared) {
+    auto& store = RepackedWeightsStore::getInstance();
+    auto source1 = makeSource(9.5f);
+    auto source2 = makeSource(10.5f);
+    auto copyOf = [&](const MemoryPtr& source) {
+        return [&, source]() {
+            ++repacks;
+            auto memory = std::make_shared<Memory>(eng, desc);
+            std::memcpy(memory->getData(), source->getData(), source->getSize());
+            return memory;
+        };
+    };
+
+    // the same key stands for the different content, as on a collision of the content hash
+    auto repacked1 = store.findOrCreate("copy_collision", source1, desc, copyOf(source1));
+    auto repacked2 = store.findOrCreate("copy_collision", source2, desc, copyOf(source2));
+    ASSERT_NE(repacked1, repacked2);
+    ASSERT_EQ(repacks, 2);
+    ASSERT_EQ(std::memcmp(repacked2->getData(), source2->getData(), source2->getSize()), 0);
+
+    // while the same content is still shared
+    auto repacked3 = store.findOrCreate("copy_collision", makeSource(9.5f), desc, copyOf(source1));
+    ASSERT_EQ(repacked1, repacked3);
+    ASSERT_EQ(repacks, 2);
+}